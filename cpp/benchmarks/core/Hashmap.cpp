@@ -0,0 +1,184 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/hashmap/Hashmap.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+namespace {
+
+/// Deterministic Int32 keys with \p num_unique distinct values among \p n.
+Tensor MakeKeys(int64_t n, int64_t num_unique, const Device& device) {
+    std::vector<int> keys(n);
+    std::vector<int> indices(n);
+    std::iota(indices.begin(), indices.end(), 0);
+    std::shuffle(indices.begin(), indices.end(), std::mt19937(0));
+    for (int64_t i = 0; i < n; ++i) {
+        keys[i] = static_cast<int>(indices[i] % num_unique) * 100;
+    }
+    return Tensor(keys, {n}, Dtype::Int32, device);
+}
+
+}  // namespace
+
+// state.range(0): number of keys.
+// state.range(1): target load factor in percent, i.e. the number of unique
+// keys relative to the initial hashmap capacity.
+void HashmapInsert(benchmark::State& state, const Device& device) {
+    int64_t n = state.range(0);
+    int64_t capacity = n * 100 / state.range(1);
+    Tensor keys = MakeKeys(n, n, device);
+    Tensor values = Tensor::Ones({n}, Dtype::Int32, device);
+
+    Tensor addrs, masks;
+    for (auto _ : state) {
+        state.PauseTiming();
+        Hashmap hashmap(capacity, Dtype::Int32, Dtype::Int32, {1}, {1},
+                        device);
+        state.ResumeTiming();
+
+        hashmap.Insert(keys, values, addrs, masks);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+void HashmapInsertDuplicates(benchmark::State& state, const Device& device) {
+    int64_t n = state.range(0);
+    int64_t num_unique = n / 64;
+    int64_t capacity = num_unique * 100 / state.range(1);
+    Tensor keys = MakeKeys(n, num_unique, device);
+    Tensor values = Tensor::Ones({n}, Dtype::Int32, device);
+
+    Tensor addrs, masks;
+    for (auto _ : state) {
+        state.PauseTiming();
+        Hashmap hashmap(capacity, Dtype::Int32, Dtype::Int32, {1}, {1},
+                        device);
+        state.ResumeTiming();
+
+        hashmap.Insert(keys, values, addrs, masks);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+void HashmapFind(benchmark::State& state, const Device& device) {
+    int64_t n = state.range(0);
+    int64_t capacity = n * 100 / state.range(1);
+    Tensor keys = MakeKeys(n, n, device);
+    Tensor values = Tensor::Ones({n}, Dtype::Int32, device);
+
+    Hashmap hashmap(capacity, Dtype::Int32, Dtype::Int32, {1}, {1}, device);
+    Tensor addrs, masks;
+    hashmap.Insert(keys, values, addrs, masks);
+
+    // Warm up.
+    hashmap.Find(keys, addrs, masks);
+
+    for (auto _ : state) {
+        hashmap.Find(keys, addrs, masks);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+void HashmapActivateInt3(benchmark::State& state, const Device& device) {
+    // Mimics voxel block activation: Int32 x 3 keys on a dense 3D grid.
+    int64_t n = state.range(0);
+    int64_t capacity = n * 100 / state.range(1);
+    int64_t side = static_cast<int64_t>(std::cbrt(double(n))) + 1;
+    std::vector<int> coords(n * 3);
+    for (int64_t i = 0; i < n; ++i) {
+        coords[3 * i + 0] = static_cast<int>(i % side);
+        coords[3 * i + 1] = static_cast<int>((i / side) % side);
+        coords[3 * i + 2] = static_cast<int>(i / (side * side));
+    }
+    Tensor keys(coords, {n, 3}, Dtype::Int32, device);
+
+    Tensor addrs, masks;
+    for (auto _ : state) {
+        state.PauseTiming();
+        Hashmap hashmap(capacity, Dtype::Int32, Dtype::Int32, {3}, {1},
+                        device);
+        state.ResumeTiming();
+
+        hashmap.Activate(keys, addrs, masks);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void LoadFactorArgs(benchmark::internal::Benchmark* b) {
+    for (int64_t n : {1 << 16, 1 << 20}) {
+        for (int64_t load_factor : {25, 50, 90}) {
+            b->Args({n, load_factor});
+        }
+    }
+}
+
+BENCHMARK_CAPTURE(HashmapInsert, CPU, Device("CPU:0"))
+        ->Apply(LoadFactorArgs)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(HashmapInsertDuplicates, CPU, Device("CPU:0"))
+        ->Apply(LoadFactorArgs)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(HashmapFind, CPU, Device("CPU:0"))
+        ->Apply(LoadFactorArgs)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(HashmapActivateInt3, CPU, Device("CPU:0"))
+        ->Apply(LoadFactorArgs)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(HashmapInsert, CUDA, Device("CUDA:0"))
+        ->Apply(LoadFactorArgs)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(HashmapInsertDuplicates, CUDA, Device("CUDA:0"))
+        ->Apply(LoadFactorArgs)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(HashmapFind, CUDA, Device("CUDA:0"))
+        ->Apply(LoadFactorArgs)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(HashmapActivateInt3, CUDA, Device("CUDA:0"))
+        ->Apply(LoadFactorArgs)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace core
+}  // namespace open3d
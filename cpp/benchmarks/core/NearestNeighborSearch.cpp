@@ -0,0 +1,138 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/NearestNeighborSearch.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+namespace {
+
+/// Deterministic points uniformly distributed in the unit cube.
+Tensor MakePoints(int64_t n, uint32_t seed, const Device& device) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    std::vector<float> points(n * 3);
+    for (auto& p : points) {
+        p = dist(gen);
+    }
+    return Tensor(points, {n, 3}, Dtype::Float32, device);
+}
+
+}  // namespace
+
+// state.range(0): number of dataset and query points.
+// state.range(1): number of neighbors.
+void KnnSearch(benchmark::State& state, const Device& device) {
+    int64_t n = state.range(0);
+    int knn = static_cast<int>(state.range(1));
+    Tensor dataset_points = MakePoints(n, 0, device);
+    Tensor query_points = MakePoints(n, 1, device);
+
+    NearestNeighborSearch nns(dataset_points);
+    nns.KnnIndex();
+
+    // Warm up.
+    Tensor indices, distances;
+    std::tie(indices, distances) = nns.KnnSearch(query_points, knn);
+
+    for (auto _ : state) {
+        std::tie(indices, distances) = nns.KnnSearch(query_points, knn);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+void KnnIndex(benchmark::State& state, const Device& device) {
+    int64_t n = state.range(0);
+    Tensor dataset_points = MakePoints(n, 0, device);
+
+    for (auto _ : state) {
+        NearestNeighborSearch nns(dataset_points);
+        nns.KnnIndex();
+    }
+}
+
+// state.range(0): number of dataset and query points.
+// state.range(1): max number of neighbors.
+void HybridSearch(benchmark::State& state, const Device& device) {
+    int64_t n = state.range(0);
+    int max_knn = static_cast<int>(state.range(1));
+    // Roughly 30 neighbors in the radius on average.
+    double radius = std::cbrt(30.0 / n);
+    Tensor dataset_points = MakePoints(n, 0, device);
+    Tensor query_points = MakePoints(n, 1, device);
+
+    NearestNeighborSearch nns(dataset_points);
+    nns.HybridIndex();
+
+    // Warm up.
+    Tensor indices, distances;
+    std::tie(indices, distances) =
+            nns.HybridSearch(query_points, radius, max_knn);
+
+    for (auto _ : state) {
+        std::tie(indices, distances) =
+                nns.HybridSearch(query_points, radius, max_knn);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK_CAPTURE(KnnIndex, CPU, Device("CPU:0"))
+        ->Args({1 << 16})
+        ->Args({1 << 20})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(KnnSearch, CPU, Device("CPU:0"))
+        ->Args({1 << 16, 1})
+        ->Args({1 << 16, 16})
+        ->Args({1 << 20, 1})
+        ->Args({1 << 20, 16})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(HybridSearch, CPU, Device("CPU:0"))
+        ->Args({1 << 16, 16})
+        ->Args({1 << 20, 16})
+        ->Unit(benchmark::kMillisecond);
+
+#if defined(BUILD_CUDA_MODULE) && defined(WITH_FAISS)
+BENCHMARK_CAPTURE(KnnSearch, CUDA, Device("CUDA:0"))
+        ->Args({1 << 16, 1})
+        ->Args({1 << 16, 16})
+        ->Args({1 << 20, 1})
+        ->Args({1 << 20, 16})
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
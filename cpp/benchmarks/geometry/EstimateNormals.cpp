@@ -0,0 +1,118 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "open3d/geometry/KDTreeSearchParam.h"
+#include "open3d/geometry/PointCloud.h"
+
+namespace open3d {
+namespace benchmarks {
+
+namespace {
+
+/// Deterministic points on the unit sphere with small radial noise.
+geometry::PointCloud MakeNoisySphere(int num_points) {
+    std::mt19937 gen(0);
+    std::normal_distribution<double> dist(0.0, 1.0);
+
+    geometry::PointCloud pcd;
+    pcd.points_.reserve(num_points);
+    for (int i = 0; i < num_points; ++i) {
+        Eigen::Vector3d p(dist(gen), dist(gen), dist(gen));
+        pcd.points_.push_back(p.normalized() * (1.0 + 0.001 * dist(gen)));
+    }
+    return pcd;
+}
+
+}  // namespace
+
+class EstimateNormalsFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        int num_points = static_cast<int>(state.range(0));
+        if (num_points == static_cast<int>(pcd_.points_.size())) return;
+        pcd_ = MakeNoisySphere(num_points);
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    geometry::PointCloud pcd_;
+};
+
+// state.range(0): number of points.
+// state.range(1): 1 for fast normal computation, 0 otherwise.
+BENCHMARK_DEFINE_F(EstimateNormalsFixture, KNN)(benchmark::State& state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        pcd_.normals_.clear();
+        state.ResumeTiming();
+
+        pcd_.EstimateNormals(geometry::KDTreeSearchParamKNN(30),
+                             state.range(1) != 0);
+    }
+}
+
+BENCHMARK_DEFINE_F(EstimateNormalsFixture, Hybrid)(benchmark::State& state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        pcd_.normals_.clear();
+        state.ResumeTiming();
+
+        pcd_.EstimateNormals(geometry::KDTreeSearchParamHybrid(0.05, 30),
+                             state.range(1) != 0);
+    }
+}
+
+BENCHMARK_DEFINE_F(EstimateNormalsFixture, OrientConsistentTangentPlane)
+(benchmark::State& state) {
+    pcd_.EstimateNormals(geometry::KDTreeSearchParamKNN(30));
+    for (auto _ : state) {
+        pcd_.OrientNormalsConsistentTangentPlane(10);
+    }
+}
+
+BENCHMARK_REGISTER_F(EstimateNormalsFixture, KNN)
+        ->Args({1 << 16, 1})
+        ->Args({1 << 16, 0})
+        ->Args({1 << 20, 1})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_REGISTER_F(EstimateNormalsFixture, Hybrid)
+        ->Args({1 << 16, 1})
+        ->Args({1 << 20, 1})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_REGISTER_F(EstimateNormalsFixture, OrientConsistentTangentPlane)
+        ->Args({1 << 14})
+        ->Args({1 << 17})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
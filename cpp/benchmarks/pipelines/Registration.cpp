@@ -0,0 +1,163 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/registration/Registration.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+
+#include "open3d/geometry/KDTreeSearchParam.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/pipelines/registration/ColoredICP.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/pipelines/registration/TransformationEstimation.h"
+
+namespace open3d {
+namespace benchmarks {
+
+namespace {
+
+/// Deterministic colored wavy surface z = 0.2 sin(3x) cos(3y) on [-1, 1]^2
+/// with small jitter, with normals estimated from 30 nearest neighbors.
+geometry::PointCloud MakeWavySurface(int num_points, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> xy(-1.0, 1.0);
+    std::normal_distribution<double> noise(0.0, 0.002);
+
+    geometry::PointCloud pcd;
+    pcd.points_.reserve(num_points);
+    pcd.colors_.reserve(num_points);
+    for (int i = 0; i < num_points; ++i) {
+        double x = xy(gen), y = xy(gen);
+        double z = 0.2 * std::sin(3 * x) * std::cos(3 * y) + noise(gen);
+        pcd.points_.emplace_back(x, y, z);
+        pcd.colors_.emplace_back(0.5 + 0.5 * std::sin(5 * x),
+                                 0.5 + 0.5 * std::cos(5 * y), 0.5 + z);
+    }
+    pcd.EstimateNormals(geometry::KDTreeSearchParamKNN(30));
+    return pcd;
+}
+
+Eigen::Matrix4d MakePerturbation() {
+    Eigen::Matrix4d T = Eigen::Matrix4d::Identity();
+    T.block<3, 3>(0, 0) =
+            geometry::Geometry3D::GetRotationMatrixFromXYZ({0.02, -0.03, 0.05});
+    T.block<3, 1>(0, 3) = Eigen::Vector3d(0.02, -0.01, 0.015);
+    return T;
+}
+
+class RegistrationFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        int num_points = static_cast<int>(state.range(0));
+        if (num_points == num_points_) return;
+        num_points_ = num_points;
+        target_ = MakeWavySurface(num_points, 0);
+        source_ = MakeWavySurface(num_points, 1);
+        source_.Transform(MakePerturbation());
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+
+    int num_points_ = 0;
+    geometry::PointCloud source_;
+    geometry::PointCloud target_;
+    const double max_correspondence_distance_ = 0.05;
+};
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(RegistrationFixture, ICPPointToPoint)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        pipelines::registration::RegistrationICP(
+                source_, target_, max_correspondence_distance_,
+                Eigen::Matrix4d::Identity(),
+                pipelines::registration::TransformationEstimationPointToPoint(),
+                pipelines::registration::ICPConvergenceCriteria(1e-6, 1e-6,
+                                                                30));
+    }
+}
+
+BENCHMARK_DEFINE_F(RegistrationFixture, ICPPointToPlane)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        pipelines::registration::RegistrationICP(
+                source_, target_, max_correspondence_distance_,
+                Eigen::Matrix4d::Identity(),
+                pipelines::registration::TransformationEstimationPointToPlane(),
+                pipelines::registration::ICPConvergenceCriteria(1e-6, 1e-6,
+                                                                30));
+    }
+}
+
+BENCHMARK_DEFINE_F(RegistrationFixture, ColoredICP)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        pipelines::registration::RegistrationColoredICP(
+                source_, target_, max_correspondence_distance_,
+                Eigen::Matrix4d::Identity(),
+                pipelines::registration::
+                        TransformationEstimationForColoredICP(),
+                pipelines::registration::ICPConvergenceCriteria(1e-6, 1e-6,
+                                                                30));
+    }
+}
+
+BENCHMARK_DEFINE_F(RegistrationFixture, ComputeFPFHFeature)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        pipelines::registration::ComputeFPFHFeature(
+                target_, geometry::KDTreeSearchParamHybrid(0.1, 100));
+    }
+}
+
+BENCHMARK_REGISTER_F(RegistrationFixture, ICPPointToPoint)
+        ->Args({1 << 14})
+        ->Args({1 << 17})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_REGISTER_F(RegistrationFixture, ICPPointToPlane)
+        ->Args({1 << 14})
+        ->Args({1 << 17})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_REGISTER_F(RegistrationFixture, ColoredICP)
+        ->Args({1 << 14})
+        ->Args({1 << 17})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_REGISTER_F(RegistrationFixture, ComputeFPFHFeature)
+        ->Args({1 << 14})
+        ->Args({1 << 17})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,156 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/integration/ScalableTSDFVolume.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/geometry/Image.h"
+#include "open3d/geometry/RGBDImage.h"
+
+namespace open3d {
+namespace benchmarks {
+
+namespace {
+
+// Same synthetic scene as the t::geometry::TSDFVoxelGrid benchmark: a sphere
+// floating in front of a wall, observed by a camera sliding along the x axis.
+static const int kWidth = 640;
+static const int kHeight = 480;
+static const double kFx = 525.0, kFy = 525.0, kCx = 319.5, kCy = 239.5;
+
+Eigen::Matrix4d SyntheticExtrinsic(int frame) {
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic(0, 3) = -0.01 * frame;
+    return extrinsic;
+}
+
+std::shared_ptr<geometry::RGBDImage> SyntheticRGBD(int frame) {
+    const double cam_x = 0.01 * frame;
+    const double sphere_x = -cam_x, sphere_z = 1.5, sphere_r = 0.4;
+    const double wall_z = 2.0;
+
+    geometry::Image depth, color;
+    depth.Prepare(kWidth, kHeight, 1, 2);
+    color.Prepare(kWidth, kHeight, 3, 1);
+    for (int v = 0; v < kHeight; ++v) {
+        for (int u = 0; u < kWidth; ++u) {
+            double dx = (u - kCx) / kFx, dy = (v - kCy) / kFy;
+            double a = dx * dx + dy * dy + 1;
+            double b = -2 * (dx * sphere_x + sphere_z);
+            double c = sphere_x * sphere_x + sphere_z * sphere_z -
+                       sphere_r * sphere_r;
+            double disc = b * b - 4 * a * c;
+            double z = wall_z;
+            if (disc >= 0) {
+                z = (-b - std::sqrt(disc)) / (2 * a);
+            }
+
+            *depth.PointerAt<uint16_t>(u, v) =
+                    static_cast<uint16_t>(z * 1000.0);
+            *color.PointerAt<uint8_t>(u, v, 0) =
+                    static_cast<uint8_t>((u * 7) % 256);
+            *color.PointerAt<uint8_t>(u, v, 1) =
+                    static_cast<uint8_t>((v * 5) % 256);
+            *color.PointerAt<uint8_t>(u, v, 2) = static_cast<uint8_t>(z * 100);
+        }
+    }
+    return geometry::RGBDImage::CreateFromColorAndDepth(color, depth, 1000.0,
+                                                        3.0, false);
+}
+
+}  // namespace
+
+class ScalableTSDFVolumeFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        if (!rgbds_.empty()) return;
+        for (int i = 0; i < 10; ++i) {
+            rgbds_.push_back(SyntheticRGBD(i));
+        }
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+
+    std::shared_ptr<pipelines::integration::ScalableTSDFVolume>
+    IntegrateAll() const {
+        auto volume =
+                std::make_shared<pipelines::integration::ScalableTSDFVolume>(
+                        0.008, 0.04,
+                        pipelines::integration::TSDFVolumeColorType::RGB8);
+        for (size_t i = 0; i < rgbds_.size(); ++i) {
+            volume->Integrate(*rgbds_[i], intrinsic_,
+                              SyntheticExtrinsic(static_cast<int>(i)));
+        }
+        return volume;
+    }
+
+    std::vector<std::shared_ptr<geometry::RGBDImage>> rgbds_;
+    camera::PinholeCameraIntrinsic intrinsic_ = camera::PinholeCameraIntrinsic(
+            kWidth, kHeight, kFx, kFy, kCx, kCy);
+};
+
+BENCHMARK_DEFINE_F(ScalableTSDFVolumeFixture, Integrate)
+(benchmark::State& state) {
+    pipelines::integration::ScalableTSDFVolume volume(
+            0.008, 0.04, pipelines::integration::TSDFVolumeColorType::RGB8);
+    for (auto _ : state) {
+        volume.Integrate(*rgbds_[0], intrinsic_, SyntheticExtrinsic(0));
+    }
+}
+
+BENCHMARK_DEFINE_F(ScalableTSDFVolumeFixture, ExtractPointCloud)
+(benchmark::State& state) {
+    auto volume = IntegrateAll();
+    for (auto _ : state) {
+        volume->ExtractPointCloud();
+    }
+}
+
+BENCHMARK_DEFINE_F(ScalableTSDFVolumeFixture, ExtractTriangleMesh)
+(benchmark::State& state) {
+    auto volume = IntegrateAll();
+    for (auto _ : state) {
+        volume->ExtractTriangleMesh();
+    }
+}
+
+BENCHMARK_REGISTER_F(ScalableTSDFVolumeFixture, Integrate)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_REGISTER_F(ScalableTSDFVolumeFixture, ExtractPointCloud)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_REGISTER_F(ScalableTSDFVolumeFixture, ExtractTriangleMesh)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,253 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/TSDFVoxelGrid.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+namespace {
+
+// Synthetic scene: a sphere floating in front of a wall, observed by a
+// PrimeSense-like camera sliding along the x axis. Inputs are generated
+// analytically so that the benchmark is deterministic and runs offline.
+static const int kWidth = 640;
+static const int kHeight = 480;
+static const float kFx = 525.0f, kFy = 525.0f, kCx = 319.5f, kCy = 239.5f;
+static const float kDepthScale = 1000.0f;
+static const float kDepthMax = 3.0f;
+
+core::Tensor SyntheticIntrinsics() {
+    return core::Tensor(
+            std::vector<float>({kFx, 0, kCx, 0, kFy, kCy, 0, 0, 1}), {3, 3},
+            core::Dtype::Float32);
+}
+
+core::Tensor SyntheticExtrinsics(int frame, const core::Device& device) {
+    core::Tensor extrinsics =
+            core::Tensor::Eye(4, core::Dtype::Float32, device);
+    extrinsics[0][3] = -0.01f * frame;
+    return extrinsics;
+}
+
+/// Depth (UInt16, millimeters) and color (UInt8, 3 channels) of the scene
+/// seen from frame \p frame.
+std::pair<Image, Image> SyntheticRGBD(int frame, const core::Device& device) {
+    const float cam_x = 0.01f * frame;
+    const float sphere_x = -cam_x, sphere_z = 1.5f, sphere_r = 0.4f;
+    const float wall_z = 2.0f;
+
+    std::vector<uint16_t> depth(kWidth * kHeight);
+    std::vector<uint8_t> color(kWidth * kHeight * 3);
+    for (int v = 0; v < kHeight; ++v) {
+        for (int u = 0; u < kWidth; ++u) {
+            // Ray with unit z component, so the ray parameter is the depth.
+            float dx = (u - kCx) / kFx, dy = (v - kCy) / kFy;
+            float a = dx * dx + dy * dy + 1;
+            float b = -2 * (dx * sphere_x + sphere_z);
+            float c = sphere_x * sphere_x + sphere_z * sphere_z -
+                      sphere_r * sphere_r;
+            float disc = b * b - 4 * a * c;
+            float z = wall_z;
+            if (disc >= 0) {
+                z = (-b - std::sqrt(disc)) / (2 * a);
+            }
+
+            int idx = v * kWidth + u;
+            depth[idx] = static_cast<uint16_t>(z * kDepthScale);
+            color[3 * idx + 0] = static_cast<uint8_t>((u * 7) % 256);
+            color[3 * idx + 1] = static_cast<uint8_t>((v * 5) % 256);
+            color[3 * idx + 2] = static_cast<uint8_t>(z * 100);
+        }
+    }
+
+    return std::make_pair(
+            Image(core::Tensor(depth, {kHeight, kWidth, 1},
+                               core::Dtype::UInt16, device)),
+            Image(core::Tensor(color, {kHeight, kWidth, 3}, core::Dtype::UInt8,
+                               device)));
+}
+
+TSDFVoxelGrid IntegrateSyntheticFrames(int num_frames,
+                                       const core::Device& device) {
+    TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                              {"weight", core::Dtype::UInt16},
+                              {"color", core::Dtype::UInt16}},
+                             0.008f, 0.04f, 16, 10000, device);
+    core::Tensor intrinsics = SyntheticIntrinsics();
+    for (int i = 0; i < num_frames; ++i) {
+        Image depth, color;
+        std::tie(depth, color) = SyntheticRGBD(i, device);
+        voxel_grid.Integrate(depth, color, intrinsics,
+                             SyntheticExtrinsics(i, device), kDepthScale,
+                             kDepthMax);
+    }
+    return voxel_grid;
+}
+
+}  // namespace
+
+void Integrate(benchmark::State& state, const core::Device& device) {
+    TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                              {"weight", core::Dtype::UInt16},
+                              {"color", core::Dtype::UInt16}},
+                             0.008f, 0.04f, 16, 10000, device);
+    core::Tensor intrinsics = SyntheticIntrinsics();
+    core::Tensor extrinsics = SyntheticExtrinsics(0, device);
+    Image depth, color;
+    std::tie(depth, color) = SyntheticRGBD(0, device);
+
+    // Warm up.
+    voxel_grid.Integrate(depth, color, intrinsics, extrinsics, kDepthScale,
+                         kDepthMax);
+
+    for (auto _ : state) {
+        voxel_grid.Integrate(depth, color, intrinsics, extrinsics, kDepthScale,
+                             kDepthMax);
+    }
+}
+
+void IntegrateBatch(benchmark::State& state, const core::Device& device) {
+    const int num_frames = 10;
+    core::Tensor intrinsics = SyntheticIntrinsics();
+    std::vector<Image> depths, colors;
+    std::vector<core::Tensor> extrinsics;
+    for (int i = 0; i < num_frames; ++i) {
+        Image depth, color;
+        std::tie(depth, color) = SyntheticRGBD(i, device);
+        depths.push_back(depth);
+        colors.push_back(color);
+        extrinsics.push_back(SyntheticExtrinsics(i, device));
+    }
+
+    for (auto _ : state) {
+        TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                  {"weight", core::Dtype::UInt16},
+                                  {"color", core::Dtype::UInt16}},
+                                 0.008f, 0.04f, 16, 10000, device);
+        voxel_grid.IntegrateBatch(depths, colors, intrinsics, extrinsics,
+                                  kDepthScale, kDepthMax);
+    }
+}
+
+void IntegrateSequential(benchmark::State& state,
+                         const core::Device& device) {
+    for (auto _ : state) {
+        TSDFVoxelGrid voxel_grid = IntegrateSyntheticFrames(10, device);
+    }
+}
+
+void ExtractSurfacePoints(benchmark::State& state,
+                          const core::Device& device) {
+    TSDFVoxelGrid voxel_grid = IntegrateSyntheticFrames(10, device);
+
+    // Warm up.
+    PointCloud pcd = voxel_grid.ExtractSurfacePoints();
+    (void)pcd;
+
+    for (auto _ : state) {
+        PointCloud pcd = voxel_grid.ExtractSurfacePoints();
+    }
+}
+
+void ExtractSurfaceMesh(benchmark::State& state, const core::Device& device) {
+    TSDFVoxelGrid voxel_grid = IntegrateSyntheticFrames(10, device);
+
+    // Warm up.
+    TriangleMesh mesh = voxel_grid.ExtractSurfaceMesh();
+    (void)mesh;
+
+    for (auto _ : state) {
+        TriangleMesh mesh = voxel_grid.ExtractSurfaceMesh();
+    }
+}
+
+void RayCast(benchmark::State& state, const core::Device& device) {
+    TSDFVoxelGrid voxel_grid = IntegrateSyntheticFrames(10, device);
+    core::Tensor intrinsics = SyntheticIntrinsics();
+    core::Tensor extrinsics = SyntheticExtrinsics(5, device);
+
+    // Warm up.
+    auto maps = voxel_grid.RayCast(intrinsics, extrinsics, kWidth, kHeight,
+                                   kDepthScale, 0.1f, kDepthMax);
+    (void)maps;
+
+    for (auto _ : state) {
+        auto maps = voxel_grid.RayCast(intrinsics, extrinsics, kWidth, kHeight,
+                                       kDepthScale, 0.1f, kDepthMax);
+    }
+}
+
+BENCHMARK_CAPTURE(Integrate, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(IntegrateSequential, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(IntegrateBatch, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(ExtractSurfacePoints, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(ExtractSurfaceMesh, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(RayCast, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(Integrate, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(IntegrateSequential, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(IntegrateBatch, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(ExtractSurfacePoints, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(ExtractSurfaceMesh, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(RayCast, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
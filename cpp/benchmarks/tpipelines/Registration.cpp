@@ -0,0 +1,141 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Registration.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/KDTreeSearchParam.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/registration/TransformationEstimation.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+namespace {
+
+/// Deterministic wavy surface z = 0.2 sin(3x) cos(3y) on [-1, 1]^2 with small
+/// jitter and estimated normals, converted to a tensor point cloud.
+geometry::PointCloud MakeWavySurface(int num_points,
+                                     uint32_t seed,
+                                     const Eigen::Matrix4d& transformation,
+                                     const core::Device& device) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> xy(-1.0, 1.0);
+    std::normal_distribution<double> noise(0.0, 0.002);
+
+    open3d::geometry::PointCloud pcd;
+    pcd.points_.reserve(num_points);
+    for (int i = 0; i < num_points; ++i) {
+        double x = xy(gen), y = xy(gen);
+        double z = 0.2 * std::sin(3 * x) * std::cos(3 * y) + noise(gen);
+        pcd.points_.emplace_back(x, y, z);
+    }
+    pcd.EstimateNormals(open3d::geometry::KDTreeSearchParamKNN(30));
+    pcd.Transform(transformation);
+    return geometry::PointCloud::FromLegacyPointCloud(
+            pcd, core::Dtype::Float32, device);
+}
+
+Eigen::Matrix4d MakePerturbation() {
+    Eigen::Matrix4d T = Eigen::Matrix4d::Identity();
+    T.block<3, 3>(0, 0) =
+            open3d::geometry::Geometry3D::GetRotationMatrixFromXYZ(
+                    {0.02, -0.03, 0.05});
+    T.block<3, 1>(0, 3) = Eigen::Vector3d(0.02, -0.01, 0.015);
+    return T;
+}
+
+}  // namespace
+
+static void BenchmarkRegistrationICP(
+        benchmark::State& state,
+        const core::Device& device,
+        const TransformationEstimation& estimation) {
+    int num_points = static_cast<int>(state.range(0));
+    geometry::PointCloud source =
+            MakeWavySurface(num_points, 1, MakePerturbation(), device);
+    geometry::PointCloud target = MakeWavySurface(
+            num_points, 0, Eigen::Matrix4d::Identity(), device);
+    core::Tensor init = core::Tensor::Eye(4, core::Dtype::Float32, device);
+    const double max_correspondence_distance = 0.05;
+
+    // Warm up.
+    RegistrationResult result = RegistrationICP(
+            source, target, max_correspondence_distance, init, estimation,
+            ICPConvergenceCriteria(1e-6, 1e-6, 1));
+    (void)result;
+
+    for (auto _ : state) {
+        RegistrationResult result = RegistrationICP(
+                source, target, max_correspondence_distance, init, estimation,
+                ICPConvergenceCriteria(1e-6, 1e-6, 30));
+    }
+}
+
+void ICPPointToPoint(benchmark::State& state, const core::Device& device) {
+    BenchmarkRegistrationICP(state, device,
+                             TransformationEstimationPointToPoint());
+}
+
+void ICPPointToPlane(benchmark::State& state, const core::Device& device) {
+    BenchmarkRegistrationICP(state, device,
+                             TransformationEstimationPointToPlane());
+}
+
+BENCHMARK_CAPTURE(ICPPointToPoint, CPU, core::Device("CPU:0"))
+        ->Args({1 << 14})
+        ->Args({1 << 17})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(ICPPointToPlane, CPU, core::Device("CPU:0"))
+        ->Args({1 << 14})
+        ->Args({1 << 17})
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(ICPPointToPoint, CUDA, core::Device("CUDA:0"))
+        ->Args({1 << 14})
+        ->Args({1 << 17})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(ICPPointToPlane, CUDA, core::Device("CUDA:0"))
+        ->Args({1 << 14})
+        ->Args({1 << 17})
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
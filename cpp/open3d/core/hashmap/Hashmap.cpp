@@ -36,6 +36,7 @@
 #include "open3d/core/hashmap/DeviceHashmap.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace core {
@@ -72,6 +73,7 @@ Hashmap::Hashmap(int64_t init_capacity,
 }
 
 void Hashmap::Rehash(int64_t buckets) {
+    OPEN3D_PROFILE_SCOPE("core::Hashmap::Rehash");
     return device_hashmap_->Rehash(buckets);
 }
 
@@ -79,6 +81,7 @@ void Hashmap::Insert(const Tensor& input_keys,
                      const Tensor& input_values,
                      Tensor& output_addrs,
                      Tensor& output_masks) {
+    OPEN3D_PROFILE_SCOPE("core::Hashmap::Insert");
     SizeVector input_key_elem_shape(input_keys.GetShape());
     input_key_elem_shape.erase(input_key_elem_shape.begin());
     AssertKeyDtype(input_keys.GetDtype(), input_key_elem_shape);
@@ -120,6 +123,7 @@ void Hashmap::Insert(const Tensor& input_keys,
 void Hashmap::Activate(const Tensor& input_keys,
                        Tensor& output_addrs,
                        Tensor& output_masks) {
+    OPEN3D_PROFILE_SCOPE("core::Hashmap::Activate");
     SizeVector input_key_elem_shape(input_keys.GetShape());
     input_key_elem_shape.erase(input_key_elem_shape.begin());
     AssertKeyDtype(input_keys.GetDtype(), input_key_elem_shape);
@@ -148,6 +152,7 @@ void Hashmap::Activate(const Tensor& input_keys,
 void Hashmap::Find(const Tensor& input_keys,
                    Tensor& output_addrs,
                    Tensor& output_masks) {
+    OPEN3D_PROFILE_SCOPE("core::Hashmap::Find");
     SizeVector input_key_elem_shape(input_keys.GetShape());
     input_key_elem_shape.erase(input_key_elem_shape.begin());
     AssertKeyDtype(input_keys.GetDtype(), input_key_elem_shape);
@@ -173,6 +178,7 @@ void Hashmap::Find(const Tensor& input_keys,
 }
 
 void Hashmap::Erase(const Tensor& input_keys, Tensor& output_masks) {
+    OPEN3D_PROFILE_SCOPE("core::Hashmap::Erase");
     SizeVector input_key_elem_shape(input_keys.GetShape());
     input_key_elem_shape.erase(input_key_elem_shape.begin());
     AssertKeyDtype(input_keys.GetDtype(), input_key_elem_shape);
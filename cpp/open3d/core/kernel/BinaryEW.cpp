@@ -30,6 +30,7 @@
 
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/KernelProfiler.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -45,6 +46,39 @@ const std::unordered_set<BinaryEWOpCode, utility::hash_enum_class>
                 BinaryEWOpCode::Ne,
         };
 
+static const char* BinaryEWOpName(BinaryEWOpCode op_code) {
+    switch (op_code) {
+        case BinaryEWOpCode::Add:
+            return "BinaryEW::Add";
+        case BinaryEWOpCode::Sub:
+            return "BinaryEW::Sub";
+        case BinaryEWOpCode::Mul:
+            return "BinaryEW::Mul";
+        case BinaryEWOpCode::Div:
+            return "BinaryEW::Div";
+        case BinaryEWOpCode::LogicalAnd:
+            return "BinaryEW::LogicalAnd";
+        case BinaryEWOpCode::LogicalOr:
+            return "BinaryEW::LogicalOr";
+        case BinaryEWOpCode::LogicalXor:
+            return "BinaryEW::LogicalXor";
+        case BinaryEWOpCode::Gt:
+            return "BinaryEW::Gt";
+        case BinaryEWOpCode::Lt:
+            return "BinaryEW::Lt";
+        case BinaryEWOpCode::Ge:
+            return "BinaryEW::Ge";
+        case BinaryEWOpCode::Le:
+            return "BinaryEW::Le";
+        case BinaryEWOpCode::Eq:
+            return "BinaryEW::Eq";
+        case BinaryEWOpCode::Ne:
+            return "BinaryEW::Ne";
+        default:
+            return "BinaryEW";
+    }
+}
+
 void BinaryEW(const Tensor& lhs,
               const Tensor& rhs,
               Tensor& dst,
@@ -68,6 +102,12 @@ void BinaryEW(const Tensor& lhs,
                 broadcasted_input_shape, dst.GetShape());
     }
 
+    ScopeKernelProfiler profiler(
+            BinaryEWOpName(op_code), lhs.GetDevice(), dst.NumElements(),
+            lhs.NumElements() * lhs.GetDtype().ByteSize() +
+                    rhs.NumElements() * rhs.GetDtype().ByteSize() +
+                    dst.NumElements() * dst.GetDtype().ByteSize());
+
     Device::DeviceType device_type = lhs.GetDevice().GetType();
     if (device_type == Device::DeviceType::CPU) {
         BinaryEWCPU(lhs, rhs, dst, op_code);
@@ -30,6 +30,7 @@
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/KernelProfiler.h"
 #include "open3d/core/kernel/UnaryEW.h"
 #include "open3d/utility/Console.h"
 
@@ -52,6 +53,19 @@ void IndexGet(const Tensor& src,
         return;
     }
 
+    // Each output element is read from src and written to dst.
+    int64_t num_index_bytes = 0;
+    if (KernelProfiler::IsEnabled()) {
+        for (const Tensor& index_tensor : index_tensors) {
+            num_index_bytes += index_tensor.NumElements() *
+                               index_tensor.GetDtype().ByteSize();
+        }
+    }
+    ScopeKernelProfiler profiler(
+            "IndexGet", src.GetDevice(), dst.NumElements(),
+            2 * dst.NumElements() * dst.GetDtype().ByteSize() +
+                    num_index_bytes);
+
     if (src.GetDevice().GetType() == Device::DeviceType::CPU) {
         IndexGetCPU(src, dst, index_tensors, indexed_shape, indexed_strides);
     } else if (src.GetDevice().GetType() == Device::DeviceType::CUDA) {
@@ -72,6 +86,18 @@ void IndexSet(const Tensor& src,
     // however, src may be on a different device.
     Tensor src_same_device = src.To(dst.GetDevice());
 
+    int64_t num_index_bytes = 0;
+    if (KernelProfiler::IsEnabled()) {
+        for (const Tensor& index_tensor : index_tensors) {
+            num_index_bytes += index_tensor.NumElements() *
+                               index_tensor.GetDtype().ByteSize();
+        }
+    }
+    ScopeKernelProfiler profiler(
+            "IndexSet", dst.GetDevice(), src.NumElements(),
+            2 * src.NumElements() * src.GetDtype().ByteSize() +
+                    num_index_bytes);
+
     if (dst.GetDevice().GetType() == Device::DeviceType::CPU) {
         IndexSetCPU(src_same_device, dst, index_tensors, indexed_shape,
                     indexed_strides);
@@ -28,6 +28,7 @@
 
 #include "open3d/core/kernel/BinaryEW.h"
 #include "open3d/core/kernel/IndexGetSet.h"
+#include "open3d/core/kernel/KernelProfiler.h"
 #include "open3d/core/kernel/NonZero.h"
 #include "open3d/core/kernel/Reduction.h"
 #include "open3d/core/kernel/UnaryEW.h"
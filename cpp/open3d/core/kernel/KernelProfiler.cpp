@@ -0,0 +1,171 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/KernelProfiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/utility/Timer.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+namespace {
+
+std::atomic<bool> g_kernel_profiler_enabled{false};
+
+std::mutex &GetStatsMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::map<std::pair<std::string, std::string>, KernelOpStats> &GetStatsMap() {
+    static std::map<std::pair<std::string, std::string>, KernelOpStats> stats;
+    return stats;
+}
+
+void SynchronizeIfCUDA(const Device &device) {
+#ifdef BUILD_CUDA_MODULE
+    // Not checked, since this is also called from a destructor. Errors are
+    // reported by the next checked CUDA call.
+    if (device.GetType() == Device::DeviceType::CUDA) {
+        cudaDeviceSynchronize();
+    }
+#endif
+}
+
+}  // namespace
+
+void KernelProfiler::SetEnabled(bool enabled) {
+    g_kernel_profiler_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool KernelProfiler::IsEnabled() {
+    return g_kernel_profiler_enabled.load(std::memory_order_relaxed);
+}
+
+void KernelProfiler::Reset() {
+    std::lock_guard<std::mutex> lock(GetStatsMutex());
+    GetStatsMap().clear();
+}
+
+std::vector<KernelOpStats> KernelProfiler::GetStats() {
+    std::vector<KernelOpStats> stats;
+    {
+        std::lock_guard<std::mutex> lock(GetStatsMutex());
+        for (const auto &kv : GetStatsMap()) {
+            stats.push_back(kv.second);
+        }
+    }
+    std::sort(stats.begin(), stats.end(),
+              [](const KernelOpStats &a, const KernelOpStats &b) {
+                  return a.total_ms_ > b.total_ms_;
+              });
+    return stats;
+}
+
+std::string KernelProfiler::GetStatsTable() {
+    std::string table = fmt::format(
+            "{:<24} {:<16} {:>10} {:>14} {:>12} {:>14} {:>12} {:>10}\n", "Op",
+            "Device", "Count", "Elements", "Elems/call", "MBytes",
+            "Total (ms)", "GB/s");
+    for (const KernelOpStats &s : GetStats()) {
+        table += fmt::format(
+                "{:<24} {:<16} {:>10} {:>14} {:>12} {:>14.3f} {:>12.3f} "
+                "{:>10.3f}\n",
+                s.op_name_, s.device_, s.count_, s.num_elements_,
+                s.count_ > 0 ? s.num_elements_ / s.count_ : 0,
+                s.num_bytes_ / 1e6, s.total_ms_,
+                s.total_ms_ > 0 ? s.num_bytes_ / (s.total_ms_ * 1e6) : 0.0);
+    }
+    return table;
+}
+
+void KernelProfiler::Record(const std::string &op_name,
+                            const std::string &device,
+                            int64_t num_elements,
+                            int64_t num_bytes,
+                            double time_ms) {
+    std::lock_guard<std::mutex> lock(GetStatsMutex());
+    KernelOpStats &stats = GetStatsMap()[std::make_pair(op_name, device)];
+    if (stats.count_ == 0) {
+        stats.op_name_ = op_name;
+        stats.device_ = device;
+    }
+    stats.count_++;
+    stats.num_elements_ += num_elements;
+    stats.num_bytes_ += num_bytes;
+    stats.total_ms_ += time_ms;
+}
+
+ScopeKernelProfiler::ScopeKernelProfiler(const char *op_name,
+                                         const Device &device,
+                                         int64_t num_elements,
+                                         int64_t num_bytes)
+    : ScopeKernelProfiler(op_name, device, device, num_elements, num_bytes) {}
+
+ScopeKernelProfiler::ScopeKernelProfiler(const char *op_name,
+                                         const Device &src_device,
+                                         const Device &dst_device,
+                                         int64_t num_elements,
+                                         int64_t num_bytes)
+    : enabled_(KernelProfiler::IsEnabled()) {
+    if (enabled_) {
+        op_name_ = op_name;
+        src_device_ = src_device;
+        dst_device_ = dst_device;
+        num_elements_ = num_elements;
+        num_bytes_ = num_bytes;
+        // Exclude pending asynchronous work from the timing.
+        SynchronizeIfCUDA(src_device_);
+        SynchronizeIfCUDA(dst_device_);
+        start_ms_ = utility::Timer::GetSystemTimeInMilliseconds();
+    }
+}
+
+ScopeKernelProfiler::~ScopeKernelProfiler() {
+    if (enabled_) {
+        SynchronizeIfCUDA(src_device_);
+        SynchronizeIfCUDA(dst_device_);
+        double time_ms =
+                utility::Timer::GetSystemTimeInMilliseconds() - start_ms_;
+        std::string device = src_device_.ToString();
+        if (src_device_ != dst_device_) {
+            device += "->" + dst_device_.ToString();
+        }
+        KernelProfiler::Record(op_name_, device, num_elements_, num_bytes_,
+                               time_ms);
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
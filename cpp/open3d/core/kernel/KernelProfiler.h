@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Device.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Accumulated counters of one kernel op on one device.
+struct KernelOpStats {
+    /// Op name, e.g. "BinaryEW::Add".
+    std::string op_name_;
+    /// Device the op ran on, e.g. "CUDA:0", or "CPU:0->CUDA:0" for copies.
+    std::string device_;
+    /// Number of calls.
+    int64_t count_ = 0;
+    /// Number of output elements processed.
+    int64_t num_elements_ = 0;
+    /// Number of bytes read and written, without caching effects.
+    int64_t num_bytes_ = 0;
+    /// Wall time in milliseconds. CUDA ops are synchronized before timing.
+    double total_ms_ = 0;
+};
+
+/// \class KernelProfiler
+///
+/// \brief Optional per-op counters for the tensor kernel dispatch layer.
+///
+/// When enabled, every dispatched kernel (BinaryEW, UnaryEW, Copy,
+/// Reduction, IndexGet, IndexSet) records its call count, processed
+/// elements, moved bytes and wall time, grouped by op and device. This
+/// helps to spot redundant copies and the overhead of many tiny ops. When
+/// disabled, the cost is a single atomic load per dispatched kernel.
+class KernelProfiler {
+public:
+    static void SetEnabled(bool enabled);
+    static bool IsEnabled();
+
+    /// Clear all counters.
+    static void Reset();
+
+    /// Returns the counters, sorted by decreasing total time.
+    static std::vector<KernelOpStats> GetStats();
+
+    /// Returns the counters formatted as a table.
+    static std::string GetStatsTable();
+
+    static void Record(const std::string &op_name,
+                       const std::string &device,
+                       int64_t num_elements,
+                       int64_t num_bytes,
+                       double time_ms);
+};
+
+/// \class ScopeKernelProfiler
+///
+/// \brief Records the enclosing kernel dispatch with the KernelProfiler, if
+/// it is enabled.
+class ScopeKernelProfiler {
+public:
+    /// \param op_name Op name, must have static storage duration.
+    /// \param device Device the op runs on.
+    /// \param num_elements Number of output elements.
+    /// \param num_bytes Number of bytes read and written.
+    ScopeKernelProfiler(const char *op_name,
+                        const Device &device,
+                        int64_t num_elements,
+                        int64_t num_bytes);
+
+    /// Constructor for ops moving data from \p src_device to \p dst_device.
+    ScopeKernelProfiler(const char *op_name,
+                        const Device &src_device,
+                        const Device &dst_device,
+                        int64_t num_elements,
+                        int64_t num_bytes);
+
+    ~ScopeKernelProfiler();
+
+    ScopeKernelProfiler(const ScopeKernelProfiler &) = delete;
+    ScopeKernelProfiler &operator=(const ScopeKernelProfiler &) = delete;
+
+private:
+    bool enabled_;
+    const char *op_name_ = nullptr;
+    Device src_device_;
+    Device dst_device_;
+    int64_t num_elements_ = 0;
+    int64_t num_bytes_ = 0;
+    double start_ms_ = 0;
+};
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -27,11 +27,35 @@
 #include "open3d/core/kernel/Reduction.h"
 
 #include "open3d/core/SizeVector.h"
+#include "open3d/core/kernel/KernelProfiler.h"
 
 namespace open3d {
 namespace core {
 namespace kernel {
 
+static const char* ReductionOpName(ReductionOpCode op_code) {
+    switch (op_code) {
+        case ReductionOpCode::Sum:
+            return "Reduction::Sum";
+        case ReductionOpCode::Prod:
+            return "Reduction::Prod";
+        case ReductionOpCode::Min:
+            return "Reduction::Min";
+        case ReductionOpCode::Max:
+            return "Reduction::Max";
+        case ReductionOpCode::ArgMin:
+            return "Reduction::ArgMin";
+        case ReductionOpCode::ArgMax:
+            return "Reduction::ArgMax";
+        case ReductionOpCode::All:
+            return "Reduction::All";
+        case ReductionOpCode::Any:
+            return "Reduction::Any";
+        default:
+            return "Reduction";
+    }
+}
+
 void Reduction(const Tensor& src,
                Tensor& dst,
                const SizeVector& dims,
@@ -88,6 +112,11 @@ void Reduction(const Tensor& src,
                           dst.GetDevice().ToString());
     }
 
+    ScopeKernelProfiler profiler(
+            ReductionOpName(op_code), src.GetDevice(), src.NumElements(),
+            src.NumElements() * src.GetDtype().ByteSize() +
+                    dst.NumElements() * dst.GetDtype().ByteSize());
+
     Device::DeviceType device_type = src.GetDevice().GetType();
     if (device_type == Device::DeviceType::CPU) {
         ReductionCPU(src, dst, dims, keepdim, op_code);
@@ -28,12 +28,42 @@
 
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/KernelProfiler.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
 namespace core {
 namespace kernel {
 
+static const char* UnaryEWOpName(UnaryEWOpCode op_code) {
+    switch (op_code) {
+        case UnaryEWOpCode::Sqrt:
+            return "UnaryEW::Sqrt";
+        case UnaryEWOpCode::Sin:
+            return "UnaryEW::Sin";
+        case UnaryEWOpCode::Cos:
+            return "UnaryEW::Cos";
+        case UnaryEWOpCode::Neg:
+            return "UnaryEW::Neg";
+        case UnaryEWOpCode::Exp:
+            return "UnaryEW::Exp";
+        case UnaryEWOpCode::Abs:
+            return "UnaryEW::Abs";
+        case UnaryEWOpCode::Floor:
+            return "UnaryEW::Floor";
+        case UnaryEWOpCode::Ceil:
+            return "UnaryEW::Ceil";
+        case UnaryEWOpCode::Round:
+            return "UnaryEW::Round";
+        case UnaryEWOpCode::Trunc:
+            return "UnaryEW::Trunc";
+        case UnaryEWOpCode::LogicalNot:
+            return "UnaryEW::LogicalNot";
+        default:
+            return "UnaryEW";
+    }
+}
+
 void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
     // Check shape
     if (!shape_util::CanBeBrocastedToShape(src.GetShape(), dst.GetShape())) {
@@ -49,6 +79,11 @@ void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
                           src_device.ToString(), dst_device.ToString());
     }
 
+    ScopeKernelProfiler profiler(
+            UnaryEWOpName(op_code), src_device, dst.NumElements(),
+            src.NumElements() * src.GetDtype().ByteSize() +
+                    dst.NumElements() * dst.GetDtype().ByteSize());
+
     if (src_device.GetType() == Device::DeviceType::CPU) {
         UnaryEWCPU(src, dst, op_code);
     } else if (src_device.GetType() == Device::DeviceType::CUDA) {
@@ -78,6 +113,11 @@ void Copy(const Tensor& src, Tensor& dst) {
          dst_device_type != Device::DeviceType::CUDA)) {
         utility::LogError("Copy: Unimplemented device");
     }
+    ScopeKernelProfiler profiler(
+            "Copy", src.GetDevice(), dst.GetDevice(), dst.NumElements(),
+            src.NumElements() * src.GetDtype().ByteSize() +
+                    dst.NumElements() * dst.GetDtype().ByteSize());
+
     if (src_device_type == Device::DeviceType::CPU &&
         dst_device_type == Device::DeviceType::CPU) {
         CopyCPU(src, dst);
@@ -28,6 +28,7 @@
 
 #include "open3d/core/CoreUtil.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace core {
@@ -96,6 +97,7 @@ bool NearestNeighborSearch::HybridIndex() {
 
 std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
         const Tensor& query_points, int knn) {
+    OPEN3D_PROFILE_SCOPE("core::nns::NearestNeighborSearch::KnnSearch");
 #ifdef WITH_FAISS
     if (faiss_index_) {
         return faiss_index_->SearchKnn(query_points, knn);
@@ -111,6 +113,7 @@ std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
 
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
         const Tensor& query_points, double radius) {
+    OPEN3D_PROFILE_SCOPE("core::nns::NearestNeighborSearch::FixedRadiusSearch");
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
         if (fixed_radius_index_) {
             return fixed_radius_index_->SearchRadius(query_points, radius);
@@ -132,6 +135,7 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
 
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::MultiRadiusSearch(
         const Tensor& query_points, const Tensor& radii) {
+    OPEN3D_PROFILE_SCOPE("core::nns::NearestNeighborSearch::MultiRadiusSearch");
     AssertNotCUDA(query_points);
     if (!nanoflann_index_) {
         utility::LogError(
@@ -153,6 +157,7 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::MultiRadiusSearch(
 
 std::pair<Tensor, Tensor> NearestNeighborSearch::HybridSearch(
         const Tensor& query_points, double radius, int max_knn) {
+    OPEN3D_PROFILE_SCOPE("core::nns::NearestNeighborSearch::HybridSearch");
 #ifdef WITH_FAISS
     if (faiss_index_) {
         return faiss_index_->SearchHybrid(query_points, radius, max_knn);
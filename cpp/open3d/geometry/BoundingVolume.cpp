@@ -27,12 +27,16 @@
 #include "open3d/geometry/BoundingVolume.h"
 
 #include <Eigen/Eigenvalues>
+#include <algorithm>
+#include <array>
+#include <limits>
 #include <numeric>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/Qhull.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Eigen.h"
 
 namespace open3d {
 namespace geometry {
@@ -145,54 +149,349 @@ OrientedBoundingBox OrientedBoundingBox::CreateFromAxisAlignedBoundingBox(
     return obox;
 }
 
-OrientedBoundingBox OrientedBoundingBox::CreateFromPoints(
-        const std::vector<Eigen::Vector3d>& points) {
-    PointCloud hull_pcd;
-    hull_pcd.points_ = std::get<0>(Qhull::ComputeConvexHull(points))->vertices_;
+namespace {
+
+/// Mean and covariance of the \p n points returned by \p point_at, with the
+/// cumulants summed per thread.
+template <typename PointAt>
+std::tuple<Eigen::Vector3d, Eigen::Matrix3d> ComputeMeanAndCovarianceParallel(
+        size_t n, const PointAt& point_at) {
+    utility::MeanAndCovarianceAccumulator accumulator;
+#pragma omp parallel
+    {
+        utility::MeanAndCovarianceAccumulator local;
+#pragma omp for schedule(static) nowait
+        for (int64_t i = 0; i < int64_t(n); i++) {
+            local.Add(point_at(i));
+        }
+#pragma omp critical
+        { accumulator.Merge(local); }
+    }
+    return accumulator.GetMeanAndCovariance();
+}
 
-    Eigen::Vector3d mean;
-    Eigen::Matrix3d cov;
-    std::tie(mean, cov) = hull_pcd.ComputeMeanAndCovariance();
-
-    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> es(cov);
-    Eigen::Vector3d evals = es.eigenvalues();
-    Eigen::Matrix3d R = es.eigenvectors();
-    R.col(0) /= R.col(0).norm();
-    R.col(1) /= R.col(1).norm();
-    R.col(2) /= R.col(2).norm();
-
-    if (evals(1) > evals(0)) {
-        std::swap(evals(1), evals(0));
-        Eigen::Vector3d tmp = R.col(1);
-        R.col(1) = R.col(0);
-        R.col(0) = tmp;
+/// Fits the box with axes \p R (relative to \p origin) tightly around the
+/// \p n points returned by \p point_at.
+template <typename PointAt>
+OrientedBoundingBox FitBoxWithAxes(size_t n,
+                                   const PointAt& point_at,
+                                   const Eigen::Vector3d& origin,
+                                   const Eigen::Matrix3d& R,
+                                   bool parallel) {
+    const double inf = std::numeric_limits<double>::infinity();
+    Eigen::Vector3d min_bound = Eigen::Vector3d::Constant(inf);
+    Eigen::Vector3d max_bound = Eigen::Vector3d::Constant(-inf);
+    const Eigen::Matrix3d Rt = R.transpose();
+#pragma omp parallel if (parallel)
+    {
+        Eigen::Vector3d local_min = Eigen::Vector3d::Constant(inf);
+        Eigen::Vector3d local_max = Eigen::Vector3d::Constant(-inf);
+#pragma omp for schedule(static) nowait
+        for (int64_t i = 0; i < int64_t(n); i++) {
+            Eigen::Vector3d pt = Rt * (point_at(i) - origin);
+            local_min = local_min.cwiseMin(pt);
+            local_max = local_max.cwiseMax(pt);
+        }
+#pragma omp critical
+        {
+            min_bound = min_bound.cwiseMin(local_min);
+            max_bound = max_bound.cwiseMax(local_max);
+        }
     }
-    if (evals(2) > evals(0)) {
-        std::swap(evals(2), evals(0));
-        Eigen::Vector3d tmp = R.col(2);
-        R.col(2) = R.col(0);
-        R.col(0) = tmp;
+
+    OrientedBoundingBox obox;
+    obox.center_ = R * ((min_bound + max_bound) * 0.5) + origin;
+    obox.R_ = R;
+    obox.extent_ = max_bound - min_bound;
+    return obox;
+}
+
+double Cross2D(const Eigen::Vector2d& o,
+               const Eigen::Vector2d& a,
+               const Eigen::Vector2d& b) {
+    return (a(0) - o(0)) * (b(1) - o(1)) - (a(1) - o(1)) * (b(0) - o(0));
+}
+
+/// Counter-clockwise convex hull of 2D points (Andrew's monotone chain),
+/// without collinear vertices.
+std::vector<Eigen::Vector2d> ComputeConvexHull2D(
+        std::vector<Eigen::Vector2d> points) {
+    std::sort(points.begin(), points.end(),
+              [](const Eigen::Vector2d& a, const Eigen::Vector2d& b) {
+                  return a(0) < b(0) || (a(0) == b(0) && a(1) < b(1));
+              });
+    if (points.size() < 3) {
+        return points;
     }
-    if (evals(2) > evals(1)) {
-        std::swap(evals(2), evals(1));
-        Eigen::Vector3d tmp = R.col(2);
-        R.col(2) = R.col(1);
-        R.col(1) = tmp;
+    std::vector<Eigen::Vector2d> hull(2 * points.size());
+    size_t k = 0;
+    for (size_t i = 0; i < points.size(); i++) {
+        while (k >= 2 && Cross2D(hull[k - 2], hull[k - 1], points[i]) <= 0) {
+            k--;
+        }
+        hull[k++] = points[i];
     }
+    for (size_t i = points.size() - 1, t = k + 1; i > 0; i--) {
+        while (k >= t &&
+               Cross2D(hull[k - 2], hull[k - 1], points[i - 1]) <= 0) {
+            k--;
+        }
+        hull[k++] = points[i - 1];
+    }
+    hull.resize(k - 1);
+    return hull;
+}
 
-    for (auto& pt : hull_pcd.points_) {
-        pt = R.transpose() * (pt - mean);
+/// Returns the unit direction of one side of the minimum area rectangle
+/// enclosing the convex polygon \p hull (counter-clockwise), found with
+/// rotating calipers.
+Eigen::Vector2d ComputeMinimumAreaRectangleAxis(
+        const std::vector<Eigen::Vector2d>& hull) {
+    const size_t h = hull.size();
+    Eigen::Vector2d best_axis(1, 0);
+    if (h < 3) {
+        if (h == 2 && hull[0] != hull[1]) {
+            best_axis = (hull[1] - hull[0]).normalized();
+        }
+        return best_axis;
     }
-    const auto aabox = hull_pcd.GetAxisAlignedBoundingBox();
 
-    OrientedBoundingBox obox;
-    obox.center_ = R * aabox.GetCenter() + mean;
-    obox.R_ = R;
-    obox.extent_ = aabox.GetExtent();
+    // Calipers: vertices with the largest projection on the edge direction
+    // (right), the edge normal (top) and the smallest one on the edge
+    // direction (left). They only move forward as the edges rotate.
+    size_t right = 0, top = 0, left = 0;
+    double best_area = std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i < h; i++) {
+        const Eigen::Vector2d& p = hull[i];
+        Eigen::Vector2d d = hull[(i + 1) % h] - p;
+        double length = d.norm();
+        if (length == 0) continue;
+        d /= length;
+        Eigen::Vector2d normal(-d(1), d(0));
+        if (i == 0) {
+            for (size_t j = 1; j < h; j++) {
+                if (hull[j].dot(d) > hull[right].dot(d)) right = j;
+                if (hull[j].dot(normal) > hull[top].dot(normal)) top = j;
+                if (hull[j].dot(d) < hull[left].dot(d)) left = j;
+            }
+        } else {
+            for (size_t s = 0; s < h && hull[(right + 1) % h].dot(d) >
+                                                hull[right].dot(d);
+                 s++) {
+                right = (right + 1) % h;
+            }
+            for (size_t s = 0; s < h && hull[(top + 1) % h].dot(normal) >
+                                                hull[top].dot(normal);
+                 s++) {
+                top = (top + 1) % h;
+            }
+            for (size_t s = 0;
+                 s < h && hull[(left + 1) % h].dot(d) < hull[left].dot(d);
+                 s++) {
+                left = (left + 1) % h;
+            }
+        }
+        double width = (hull[right] - hull[left]).dot(d);
+        double height = (hull[top] - p).dot(normal);
+        if (width * height < best_area) {
+            best_area = width * height;
+            best_axis = d;
+        }
+    }
+    return best_axis;
+}
 
+/// Minimum volume box among the ones with a face flush with a facet of the
+/// convex hull (\p hull_vertices, \p hull_triangles), in parallel over the
+/// distinct facet normals.
+OrientedBoundingBox ComputeMinimumVolumeBox(
+        const std::vector<Eigen::Vector3d>& hull_vertices,
+        const std::vector<Eigen::Vector3i>& hull_triangles,
+        const OrientedBoundingBox& initial_box) {
+    std::vector<Eigen::Vector3d> normals;
+    normals.reserve(hull_triangles.size());
+    for (const auto& triangle : hull_triangles) {
+        Eigen::Vector3d normal =
+                (hull_vertices[triangle(1)] - hull_vertices[triangle(0)])
+                        .cross(hull_vertices[triangle(2)] -
+                               hull_vertices[triangle(0)]);
+        double norm = normal.norm();
+        if (norm == 0) continue;
+        normal /= norm;
+        // A facet and the opposite one give the same boxes.
+        if (normal(0) < 0 || (normal(0) == 0 && normal(1) < 0) ||
+            (normal(0) == 0 && normal(1) == 0 && normal(2) < 0)) {
+            normal = -normal;
+        }
+        normals.push_back(normal);
+    }
+    // Coplanar facets of the triangulated hull share their normal.
+    std::sort(normals.begin(), normals.end(),
+              [](const Eigen::Vector3d& a, const Eigen::Vector3d& b) {
+                  return std::lexicographical_compare(a.data(), a.data() + 3,
+                                                      b.data(), b.data() + 3);
+              });
+    normals.erase(std::unique(normals.begin(), normals.end(),
+                              [](const Eigen::Vector3d& a,
+                                 const Eigen::Vector3d& b) {
+                                  return (a - b).norm() < 1e-9;
+                              }),
+                  normals.end());
+
+    auto hull_vertex = [&](int64_t i) -> const Eigen::Vector3d& {
+        return hull_vertices[i];
+    };
+    const Eigen::Vector3d origin = initial_box.center_;
+    OrientedBoundingBox best_box = initial_box;
+    double best_volume = initial_box.Volume();
+#pragma omp parallel
+    {
+        OrientedBoundingBox local_box = initial_box;
+        double local_volume = best_volume;
+        std::vector<Eigen::Vector2d> projected(hull_vertices.size());
+#pragma omp for schedule(dynamic) nowait
+        for (int64_t n = 0; n < int64_t(normals.size()); n++) {
+            const Eigen::Vector3d& normal = normals[n];
+            Eigen::Vector3d u = normal.unitOrthogonal();
+            Eigen::Vector3d v = normal.cross(u);
+            for (size_t i = 0; i < hull_vertices.size(); i++) {
+                Eigen::Vector3d d = hull_vertices[i] - origin;
+                projected[i] = Eigen::Vector2d(d.dot(u), d.dot(v));
+            }
+            Eigen::Vector2d axis = ComputeMinimumAreaRectangleAxis(
+                    ComputeConvexHull2D(projected));
+
+            Eigen::Matrix3d R;
+            R.col(0) = axis(0) * u + axis(1) * v;
+            R.col(1) = normal.cross(R.col(0));
+            R.col(2) = normal;
+            OrientedBoundingBox box = FitBoxWithAxes(
+                    hull_vertices.size(), hull_vertex, origin, R, false);
+            if (box.Volume() < local_volume) {
+                local_volume = box.Volume();
+                local_box = box;
+            }
+        }
+#pragma omp critical
+        {
+            if (local_volume < best_volume) {
+                best_volume = local_volume;
+                best_box = local_box;
+            }
+        }
+    }
+
+    // Order the axes by decreasing extent, keeping a right-handed frame.
+    if (best_box.R_ != initial_box.R_) {
+        std::array<int, 3> order = {0, 1, 2};
+        std::sort(order.begin(), order.end(), [&](int a, int b) {
+            return best_box.extent_(a) > best_box.extent_(b);
+        });
+        Eigen::Matrix3d R;
+        Eigen::Vector3d extent;
+        for (int i = 0; i < 3; i++) {
+            R.col(i) = best_box.R_.col(order[i]);
+            extent(i) = best_box.extent_(order[i]);
+        }
+        if (R.determinant() < 0) {
+            R.col(2) = -R.col(2);
+        }
+        best_box.R_ = R;
+        best_box.extent_ = extent;
+    }
+    return best_box;
+}
+
+OrientedBoundingBox CreateFromConvexHull(
+        const std::vector<Eigen::Vector3d>& points,
+        OrientedBoundingBox::CreationMethod method) {
+    std::shared_ptr<TriangleMesh> hull;
+    std::tie(hull, std::ignore) = Qhull::ComputeConvexHull(points);
+    const std::vector<Eigen::Vector3d>& hull_vertices = hull->vertices_;
+
+    Eigen::Vector3d mean;
+    Eigen::Matrix3d cov;
+    std::vector<size_t> all_idx(hull_vertices.size());
+    std::iota(all_idx.begin(), all_idx.end(), 0);
+    std::tie(mean, cov) = utility::ComputeMeanAndCovariance(hull_vertices,
+                                                            all_idx);
+    OrientedBoundingBox obox = FitBoxWithAxes(
+            hull_vertices.size(),
+            [&](int64_t i) -> const Eigen::Vector3d& {
+                return hull_vertices[i];
+            },
+            mean, utility::ComputePrincipalAxes(cov), false);
+    if (method == OrientedBoundingBox::CreationMethod::MinimumVolume) {
+        obox = ComputeMinimumVolumeBox(hull_vertices, hull->triangles_, obox);
+    }
     return obox;
 }
 
+}  // unnamed namespace
+
+OrientedBoundingBox OrientedBoundingBox::CreateFromPoints(
+        const std::vector<Eigen::Vector3d>& points, CreationMethod method) {
+    if (method != CreationMethod::PCA) {
+        return CreateFromConvexHull(points, method);
+    }
+    if (points.empty()) {
+        utility::LogError("[CreateFromPoints] points is empty.");
+    }
+    auto point_at = [&](int64_t i) -> const Eigen::Vector3d& {
+        return points[i];
+    };
+    Eigen::Vector3d mean;
+    Eigen::Matrix3d cov;
+    std::tie(mean, cov) =
+            ComputeMeanAndCovarianceParallel(points.size(), point_at);
+    return FitBoxWithAxes(points.size(), point_at, mean,
+                          utility::ComputePrincipalAxes(cov), true);
+}
+
+std::vector<OrientedBoundingBox> OrientedBoundingBox::CreateFromPointIndices(
+        const std::vector<Eigen::Vector3d>& points,
+        const std::vector<std::vector<size_t>>& indices,
+        CreationMethod method) {
+    std::vector<OrientedBoundingBox> boxes(indices.size());
+    int num_fallbacks = 0;
+#pragma omp parallel for schedule(dynamic) reduction(+ : num_fallbacks)
+    for (int64_t c = 0; c < int64_t(indices.size()); c++) {
+        const std::vector<size_t>& cluster = indices[c];
+        if (cluster.empty()) continue;
+        if (method != CreationMethod::PCA) {
+            std::vector<Eigen::Vector3d> cluster_points(cluster.size());
+            for (size_t i = 0; i < cluster.size(); i++) {
+                cluster_points[i] = points[cluster[i]];
+            }
+            // Qhull throws for degenerate clusters, which must not escape
+            // the parallel region.
+            try {
+                boxes[c] = CreateFromConvexHull(cluster_points, method);
+                continue;
+            } catch (...) {
+                num_fallbacks++;
+            }
+        }
+        Eigen::Vector3d mean;
+        Eigen::Matrix3d cov;
+        std::tie(mean, cov) =
+                utility::ComputeMeanAndCovariance(points, cluster);
+        boxes[c] = FitBoxWithAxes(
+                cluster.size(),
+                [&](int64_t i) -> const Eigen::Vector3d& {
+                    return points[cluster[i]];
+                },
+                mean, utility::ComputePrincipalAxes(cov), false);
+    }
+    if (num_fallbacks > 0) {
+        utility::LogDebug(
+                "[CreateFromPointIndices] {} clusters without a convex hull "
+                "were fitted with PCA.",
+                num_fallbacks);
+    }
+    return boxes;
+}
+
 AxisAlignedBoundingBox& AxisAlignedBoundingBox::Clear() {
     min_bound_.setZero();
     max_bound_.setZero();
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <vector>
 
 #include "open3d/geometry/Geometry3D.h"
 
@@ -43,6 +44,18 @@ class AxisAlignedBoundingBox;
 /// maxtrix and extent.
 class OrientedBoundingBox : public Geometry3D {
 public:
+    /// \enum CreationMethod
+    ///
+    /// \brief Specifies how the box is fitted to a set of points.
+    enum class CreationMethod {
+        /// PCA of the convex hull vertices.
+        ConvexHullPCA,
+        /// PCA of all the points, without a convex hull.
+        PCA,
+        /// Smallest box with a face flush with a convex hull facet.
+        MinimumVolume
+    };
+
     /// \brief Default constructor.
     ///
     /// Creates an empty Oriented Bounding Box.
@@ -124,8 +137,28 @@ public:
     /// bounding box that could be computed for example with O'Rourke's
     /// algorithm (cf. http://cs.smith.edu/~jorourke/Papers/MinVolBox.pdf,
     /// https://www.geometrictools.com/Documentation/MinimumVolumeBox.pdf)
+    ///
+    /// \param points The points to enclose.
+    /// \param method CreationMethod::PCA skips the convex hull and computes
+    /// the covariance and the extents in parallel over all the points. It is
+    /// the fastest and also accepts degenerate (e.g. planar) inputs.
+    /// CreationMethod::MinimumVolume searches the convex hull facet normals
+    /// and fits a minimum area rectangle with rotating calipers to the hull
+    /// projected along each of them, which yields a box no larger than the
+    /// ConvexHullPCA one.
     static OrientedBoundingBox CreateFromPoints(
-            const std::vector<Eigen::Vector3d>& points);
+            const std::vector<Eigen::Vector3d>& points,
+            CreationMethod method = CreationMethod::ConvexHullPCA);
+
+    /// Creates an oriented bounding box for each list of \p indices into
+    /// \p points, in parallel over the lists and without copying the points
+    /// for CreationMethod::PCA. Lists the convex hull cannot be computed for
+    /// (e.g. planar clusters) fall back to CreationMethod::PCA, and empty
+    /// lists yield an empty box.
+    static std::vector<OrientedBoundingBox> CreateFromPointIndices(
+            const std::vector<Eigen::Vector3d>& points,
+            const std::vector<std::vector<size_t>>& indices,
+            CreationMethod method = CreationMethod::PCA);
 
 public:
     /// The center point of the bounding box.
@@ -0,0 +1,276 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/Distance.h"
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Squared distance from \p p to the triangle (a, b, c), following the
+/// Voronoi region tests of Ericson, "Real-Time Collision Detection", 2004.
+double PointTriangleDistance2(const Eigen::Vector3d &p,
+                              const Eigen::Vector3d &a,
+                              const Eigen::Vector3d &b,
+                              const Eigen::Vector3d &c) {
+    const Eigen::Vector3d ab = b - a;
+    const Eigen::Vector3d ac = c - a;
+    const Eigen::Vector3d ap = p - a;
+    const double d1 = ab.dot(ap);
+    const double d2 = ac.dot(ap);
+    if (d1 <= 0 && d2 <= 0) return ap.squaredNorm();
+
+    const Eigen::Vector3d bp = p - b;
+    const double d3 = ab.dot(bp);
+    const double d4 = ac.dot(bp);
+    if (d3 >= 0 && d4 <= d3) return bp.squaredNorm();
+
+    const double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+        const double v = d1 / (d1 - d3);
+        return (ap - v * ab).squaredNorm();
+    }
+
+    const Eigen::Vector3d cp = p - c;
+    const double d5 = ab.dot(cp);
+    const double d6 = ac.dot(cp);
+    if (d6 >= 0 && d5 <= d6) return cp.squaredNorm();
+
+    const double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+        const double w = d2 / (d2 - d6);
+        return (ap - w * ac).squaredNorm();
+    }
+
+    const double va = d3 * d6 - d5 * d4;
+    if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) {
+        const double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        return (bp - w * (c - b)).squaredNorm();
+    }
+
+    const double denom = 1.0 / (va + vb + vc);
+    const double v = vb * denom;
+    const double w = vc * denom;
+    return (ap - ab * v - ac * w).squaredNorm();
+}
+
+/// Bounding volume hierarchy over the triangles of a mesh for closest point
+/// queries. Nodes are split at the median centroid along their longest axis.
+class TriangleBVH {
+public:
+    explicit TriangleBVH(const TriangleMesh &mesh) : mesh_(mesh) {
+        const int num_triangles = int(mesh.triangles_.size());
+        order_.resize(num_triangles);
+        std::iota(order_.begin(), order_.end(), 0);
+        centroids_.resize(num_triangles);
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < num_triangles; i++) {
+            const Eigen::Vector3i &t = mesh.triangles_[i];
+            centroids_[i] = (mesh.vertices_[t(0)] + mesh.vertices_[t(1)] +
+                             mesh.vertices_[t(2)]) /
+                            3.0;
+        }
+        if (num_triangles > 0) {
+            nodes_.reserve(2 * (num_triangles / kLeafSize + 1));
+            Build(0, num_triangles);
+        }
+    }
+
+    /// Returns the squared distance from \p p to the closest triangle, or
+    /// \p bound2 if no triangle is closer than sqrt(bound2).
+    double Distance2(const Eigen::Vector3d &p, double bound2) const {
+        if (nodes_.empty()) return bound2;
+        double best2 = bound2;
+        int stack[64];
+        int stack_size = 0;
+        stack[stack_size++] = 0;
+        while (stack_size > 0) {
+            const Node &node = nodes_[stack[--stack_size]];
+            if (BoxDistance2(node, p) >= best2) continue;
+            if (node.left < 0) {
+                for (int k = node.begin; k < node.end; k++) {
+                    const Eigen::Vector3i &t = mesh_.triangles_[order_[k]];
+                    best2 = std::min(best2,
+                                     PointTriangleDistance2(
+                                             p, mesh_.vertices_[t(0)],
+                                             mesh_.vertices_[t(1)],
+                                             mesh_.vertices_[t(2)]));
+                }
+                continue;
+            }
+            // Visit the closer child first to tighten the bound early.
+            int near = node.left, far = node.right;
+            if (BoxDistance2(nodes_[near], p) >
+                BoxDistance2(nodes_[far], p)) {
+                std::swap(near, far);
+            }
+            stack[stack_size++] = far;
+            stack[stack_size++] = near;
+        }
+        return best2;
+    }
+
+private:
+    static constexpr int kLeafSize = 4;
+
+    struct Node {
+        Eigen::Vector3d min_bound;
+        Eigen::Vector3d max_bound;
+        int begin;
+        int end;
+        int left;
+        int right;
+    };
+
+    static double BoxDistance2(const Node &node, const Eigen::Vector3d &p) {
+        return (node.min_bound - p)
+                .cwiseMax(p - node.max_bound)
+                .cwiseMax(0.0)
+                .squaredNorm();
+    }
+
+    int Build(int begin, int end) {
+        const int index = int(nodes_.size());
+        nodes_.push_back(Node());
+        Node node;
+        node.begin = begin;
+        node.end = end;
+        node.left = node.right = -1;
+        node.min_bound = Eigen::Vector3d::Constant(
+                std::numeric_limits<double>::max());
+        node.max_bound = -node.min_bound;
+        Eigen::Vector3d centroid_min = node.min_bound;
+        Eigen::Vector3d centroid_max = node.max_bound;
+        for (int k = begin; k < end; k++) {
+            const Eigen::Vector3i &t = mesh_.triangles_[order_[k]];
+            for (int j = 0; j < 3; j++) {
+                node.min_bound = node.min_bound.cwiseMin(mesh_.vertices_[t(j)]);
+                node.max_bound = node.max_bound.cwiseMax(mesh_.vertices_[t(j)]);
+            }
+            centroid_min = centroid_min.cwiseMin(centroids_[order_[k]]);
+            centroid_max = centroid_max.cwiseMax(centroids_[order_[k]]);
+        }
+        if (end - begin > kLeafSize) {
+            int axis;
+            (centroid_max - centroid_min).maxCoeff(&axis);
+            const int mid = (begin + end) / 2;
+            std::nth_element(order_.begin() + begin, order_.begin() + mid,
+                             order_.begin() + end, [&](int a, int b) {
+                                 return centroids_[a](axis) <
+                                        centroids_[b](axis);
+                             });
+            node.left = Build(begin, mid);
+            node.right = Build(mid, end);
+        }
+        nodes_[index] = node;
+        return index;
+    }
+
+    const TriangleMesh &mesh_;
+    std::vector<int> order_;
+    std::vector<Eigen::Vector3d> centroids_;
+    std::vector<Node> nodes_;
+};
+
+}  // unnamed namespace
+
+std::vector<double> PointCloud::ComputeTriangleMeshDistance(
+        const TriangleMesh &mesh, double max_distance /* = 0.0 */) const {
+    std::vector<double> distances(points_.size());
+    if (!mesh.HasTriangles()) {
+        utility::LogWarning(
+                "[ComputeTriangleMeshDistance] The mesh has no triangles.");
+        std::fill(distances.begin(), distances.end(),
+                  max_distance > 0.0 ? max_distance : 0.0);
+        return distances;
+    }
+    TriangleBVH bvh(mesh);
+    const double bound2 = max_distance > 0.0
+                                  ? max_distance * max_distance
+                                  : std::numeric_limits<double>::infinity();
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < (int)points_.size(); i++) {
+        distances[i] = std::sqrt(bvh.Distance2(points_[i], bound2));
+    }
+    return distances;
+}
+
+DistanceSummary DistanceSummary::FromDistances(
+        const std::vector<double> &source_to_target,
+        const std::vector<double> &target_to_source) {
+    auto mean = [](const std::vector<double> &distances) {
+        return distances.empty()
+                       ? 0.0
+                       : std::accumulate(distances.begin(), distances.end(),
+                                         0.0) /
+                                 distances.size();
+    };
+    auto max = [](const std::vector<double> &distances) {
+        return distances.empty() ? 0.0
+                                 : *std::max_element(distances.begin(),
+                                                     distances.end());
+    };
+    DistanceSummary summary;
+    summary.mean_source_to_target_ = mean(source_to_target);
+    summary.mean_target_to_source_ = mean(target_to_source);
+    summary.max_source_to_target_ = max(source_to_target);
+    summary.max_target_to_source_ = max(target_to_source);
+    summary.hausdorff_distance_ = std::max(summary.max_source_to_target_,
+                                           summary.max_target_to_source_);
+    summary.chamfer_distance_ =
+            summary.mean_source_to_target_ + summary.mean_target_to_source_;
+    return summary;
+}
+
+DistanceSummary ComputeDistanceSummary(const PointCloud &source,
+                                       const PointCloud &target,
+                                       double max_distance /* = 0.0 */) {
+    return DistanceSummary::FromDistances(
+            source.ComputePointCloudDistance(target, max_distance),
+            target.ComputePointCloudDistance(source, max_distance));
+}
+
+DistanceSummary ComputeDistanceSummary(const PointCloud &source,
+                                       const TriangleMesh &target,
+                                       double max_distance /* = 0.0 */) {
+    PointCloud vertices;
+    vertices.points_ = target.vertices_;
+    return DistanceSummary::FromDistances(
+            source.ComputeTriangleMeshDistance(target, max_distance),
+            vertices.ComputePointCloudDistance(source, max_distance));
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,95 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace geometry {
+
+/// \class DistanceSummary
+///
+/// \brief Summary statistics of the distances from a source geometry to a
+/// target geometry and back.
+class DistanceSummary {
+public:
+    DistanceSummary() {}
+    ~DistanceSummary() {}
+
+    /// Summarizes distances from source points to the target, and from target
+    /// points to the source.
+    static DistanceSummary FromDistances(
+            const std::vector<double> &source_to_target,
+            const std::vector<double> &target_to_source);
+
+public:
+    /// Mean distance from the source points to the target.
+    double mean_source_to_target_ = 0.0;
+    /// Mean distance from the target points to the source.
+    double mean_target_to_source_ = 0.0;
+    /// Maximum distance from the source points to the target, i.e. the
+    /// directed Hausdorff distance.
+    double max_source_to_target_ = 0.0;
+    /// Maximum distance from the target points to the source.
+    double max_target_to_source_ = 0.0;
+    /// Symmetric Hausdorff distance, the larger of both maximum distances.
+    double hausdorff_distance_ = 0.0;
+    /// Chamfer distance, the sum of both mean distances.
+    double chamfer_distance_ = 0.0;
+};
+
+/// \brief Function to compute the Hausdorff and Chamfer distances between two
+/// point clouds.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param max_distance If positive, searches are bounded by this distance, and
+/// larger distances are counted as max_distance.
+DistanceSummary ComputeDistanceSummary(const PointCloud &source,
+                                       const PointCloud &target,
+                                       double max_distance = 0.0);
+
+/// \brief Function to compute the Hausdorff and Chamfer distances between a
+/// point cloud and a mesh.
+///
+/// Distances from the source points are measured to the triangles of the
+/// mesh, and distances from the target to the source are measured from the
+/// mesh vertices.
+///
+/// \param source The source point cloud.
+/// \param target The target triangle mesh.
+/// \param max_distance If positive, searches are bounded by this distance, and
+/// larger distances are counted as max_distance.
+DistanceSummary ComputeDistanceSummary(const PointCloud &source,
+                                       const TriangleMesh &target,
+                                       double max_distance = 0.0);
+
+}  // namespace geometry
+}  // namespace open3d
@@ -24,8 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Eigenvalues>
-#include <queue>
+#include <algorithm>
+#include <numeric>
 #include <tuple>
 
 #include "open3d/geometry/KDTreeFlann.h"
@@ -286,21 +289,95 @@ struct WeightedEdge {
     double weight_;
 };
 
-// Minimum Spanning Tree algorithm (Kruskal's algorithm)
-std::vector<WeightedEdge> Kruskal(std::vector<WeightedEdge> &edges,
+// Strict total order on edges (weight, then vertices), so that the minimum
+// spanning tree is unique and does not depend on the number of threads.
+bool EdgeLess(const WeightedEdge &e0, const WeightedEdge &e1) {
+    return std::tie(e0.weight_, e0.v0_, e0.v1_) <
+           std::tie(e1.weight_, e1.v0_, e1.v1_);
+}
+
+// Undirected edge v0 < v1 packed in a single key for sorting.
+size_t EdgeKey(size_t v0, size_t v1, size_t n_vertices) {
+    return std::min(v0, v1) * n_vertices + std::max(v0, v1);
+}
+
+// Sort and remove duplicated keys.
+void SortUnique(std::vector<size_t> &keys) {
+    tbb::parallel_sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+}
+
+// Minimum spanning forest (Boruvka's algorithm). In each round, every vertex
+// finds its lightest edge leaving its component in parallel, components then
+// pick the lightest of their vertices' edges and are merged along them.
+std::vector<WeightedEdge> Boruvka(const std::vector<WeightedEdge> &edges,
                                   size_t n_vertices) {
-    std::sort(edges.begin(), edges.end(),
-              [](WeightedEdge &e0, WeightedEdge &e1) {
-                  return e0.weight_ < e1.weight_;
-              });
+    // Adjacency in compressed sparse row format, storing edge indices.
+    std::vector<size_t> adjacency_offsets(n_vertices + 1, 0);
+    for (const WeightedEdge &edge : edges) {
+        adjacency_offsets[edge.v0_ + 1]++;
+        adjacency_offsets[edge.v1_ + 1]++;
+    }
+    std::partial_sum(adjacency_offsets.begin(), adjacency_offsets.end(),
+                     adjacency_offsets.begin());
+    std::vector<size_t> adjacency(adjacency_offsets.back());
+    std::vector<size_t> cursors(adjacency_offsets.begin(),
+                                adjacency_offsets.end() - 1);
+    for (size_t eidx = 0; eidx < edges.size(); ++eidx) {
+        adjacency[cursors[edges[eidx].v0_]++] = eidx;
+        adjacency[cursors[edges[eidx].v1_]++] = eidx;
+    }
+
+    const int64_t kNoEdge = -1;
+    auto IsLighter = [&](int64_t eidx, int64_t best) {
+        return best == kNoEdge || EdgeLess(edges[eidx], edges[best]);
+    };
+
     DisjointSet disjoint_set(n_vertices);
+    std::vector<size_t> component(n_vertices);
+    std::iota(component.begin(), component.end(), 0);
+    std::vector<int64_t> vertex_best(n_vertices);
+    std::vector<int64_t> component_best(n_vertices, kNoEdge);
     std::vector<WeightedEdge> mst;
-    for (size_t eidx = 0; eidx < edges.size(); ++eidx) {
-        size_t set0 = disjoint_set.Find(edges[eidx].v0_);
-        size_t set1 = disjoint_set.Find(edges[eidx].v1_);
-        if (set0 != set1) {
-            mst.push_back(edges[eidx]);
-            disjoint_set.Union(set0, set1);
+    bool merged = true;
+    while (merged) {
+#pragma omp parallel for schedule(static)
+        for (int64_t v = 0; v < int64_t(n_vertices); ++v) {
+            int64_t best = kNoEdge;
+            for (size_t i = adjacency_offsets[v]; i < adjacency_offsets[v + 1];
+                 ++i) {
+                const WeightedEdge &edge = edges[adjacency[i]];
+                if (component[edge.v0_] != component[edge.v1_] &&
+                    IsLighter(adjacency[i], best)) {
+                    best = adjacency[i];
+                }
+            }
+            vertex_best[v] = best;
+        }
+
+        for (size_t v = 0; v < n_vertices; ++v) {
+            int64_t &best = component_best[component[v]];
+            if (vertex_best[v] != kNoEdge && IsLighter(vertex_best[v], best)) {
+                best = vertex_best[v];
+            }
+        }
+
+        // An edge may be selected by both of its components.
+        merged = false;
+        for (size_t c = 0; c < n_vertices; ++c) {
+            if (component_best[c] == kNoEdge) {
+                continue;
+            }
+            const WeightedEdge &edge = edges[component_best[c]];
+            component_best[c] = kNoEdge;
+            if (disjoint_set.Find(edge.v0_) != disjoint_set.Find(edge.v1_)) {
+                mst.push_back(edge);
+                disjoint_set.Union(edge.v0_, edge.v1_);
+                merged = true;
+            }
+        }
+        for (size_t v = 0; v < n_vertices; ++v) {
+            component[v] = disjoint_set.Find(v);
         }
     }
     return mst;
@@ -392,82 +469,115 @@ void PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
                 "[OrientNormalsConsistentTangentPlane] No normals in the "
                 "PointCloud. Call EstimateNormals() first.");
     }
+    size_t n_points = points_.size();
+    if (n_points == 0) {
+        return;
+    }
 
     // Create Riemannian graph (Euclidian MST + kNN)
     // Euclidian MST is subgraph of Delaunay triangulation
     std::shared_ptr<TetraMesh> delaunay_mesh;
     std::vector<size_t> pt_map;
     std::tie(delaunay_mesh, pt_map) = TetraMesh::CreateFromPointCloud(*this);
-    std::vector<WeightedEdge> delaunay_graph;
-    std::unordered_set<size_t> graph_edges;
-    auto EdgeIndex = [&](size_t v0, size_t v1) -> size_t {
-        return std::min(v0, v1) * points_.size() + std::max(v0, v1);
-    };
-    auto AddEdgeToDelaunayGraph = [&](size_t v0, size_t v1) {
-        v0 = pt_map[v0];
-        v1 = pt_map[v1];
-        size_t edge = EdgeIndex(v0, v1);
-        if (graph_edges.count(edge) == 0) {
-            double dist = (points_[v0] - points_[v1]).squaredNorm();
-            delaunay_graph.push_back(WeightedEdge(v0, v1, dist));
-            graph_edges.insert(edge);
+    std::vector<size_t> delaunay_keys(delaunay_mesh->tetras_.size() * 6);
+#pragma omp parallel for schedule(static)
+    for (int64_t tidx = 0; tidx < int64_t(delaunay_mesh->tetras_.size());
+         ++tidx) {
+        const Eigen::Vector4i &tetra = delaunay_mesh->tetras_[tidx];
+        size_t *keys = &delaunay_keys[tidx * 6];
+        int edge = 0;
+        for (int i = 0; i < 4; ++i) {
+            for (int j = i + 1; j < 4; ++j) {
+                keys[edge++] = EdgeKey(pt_map[tetra[i]], pt_map[tetra[j]],
+                                       n_points);
+            }
         }
-    };
-    for (const Eigen::Vector4i &tetra : delaunay_mesh->tetras_) {
-        AddEdgeToDelaunayGraph(tetra[0], tetra[1]);
-        AddEdgeToDelaunayGraph(tetra[0], tetra[2]);
-        AddEdgeToDelaunayGraph(tetra[0], tetra[3]);
-        AddEdgeToDelaunayGraph(tetra[1], tetra[2]);
-        AddEdgeToDelaunayGraph(tetra[1], tetra[3]);
-        AddEdgeToDelaunayGraph(tetra[2], tetra[3]);
     }
+    SortUnique(delaunay_keys);
 
-    std::vector<WeightedEdge> mst = Kruskal(delaunay_graph, points_.size());
-
-    auto NormalWeight = [&](size_t v0, size_t v1) -> double {
-        return 1.0 - std::abs(normals_[v0].dot(normals_[v1]));
-    };
-    for (auto &edge : mst) {
-        edge.weight_ = NormalWeight(edge.v0_, edge.v1_);
+    std::vector<WeightedEdge> delaunay_graph(delaunay_keys.size(),
+                                             WeightedEdge(0, 0, 0));
+#pragma omp parallel for schedule(static)
+    for (int64_t eidx = 0; eidx < int64_t(delaunay_keys.size()); ++eidx) {
+        size_t v0 = delaunay_keys[eidx] / n_points;
+        size_t v1 = delaunay_keys[eidx] % n_points;
+        delaunay_graph[eidx] =
+                WeightedEdge(v0, v1, (points_[v0] - points_[v1]).squaredNorm());
     }
+    std::vector<WeightedEdge> mst = Boruvka(delaunay_graph, n_points);
+    delaunay_graph.clear();
 
-    // Add k nearest neighbors to Riemannian graph
+    // Add k nearest neighbors to Riemannian graph. Neighbors that are
+    // Delaunay edges but not part of the Euclidian MST are left out.
     KDTreeFlann kdtree(*this);
-    for (size_t v0 = 0; v0 < points_.size(); ++v0) {
+    std::vector<size_t> knn_keys(n_points * k, 0);
+    std::vector<char> knn_valid(n_points * k, 0);
+#pragma omp parallel for schedule(static)
+    for (int64_t v0 = 0; v0 < int64_t(n_points); ++v0) {
         std::vector<int> neighbors;
         std::vector<double> dists2;
         kdtree.SearchKNN(points_[v0], int(k), neighbors, dists2);
         for (size_t vidx1 = 0; vidx1 < neighbors.size(); ++vidx1) {
             size_t v1 = size_t(neighbors[vidx1]);
-            if (v0 == v1) {
+            if (size_t(v0) == v1) {
                 continue;
             }
-            size_t edge = EdgeIndex(v0, v1);
-            if (graph_edges.count(edge) == 0) {
-                double weight = NormalWeight(v0, v1);
-                mst.push_back(WeightedEdge(v0, v1, weight));
-                graph_edges.insert(edge);
+            size_t key = EdgeKey(v0, v1, n_points);
+            if (!std::binary_search(delaunay_keys.begin(),
+                                    delaunay_keys.end(), key)) {
+                knn_keys[v0 * k + vidx1] = key;
+                knn_valid[v0 * k + vidx1] = 1;
             }
         }
     }
+    std::vector<size_t> graph_keys;
+    graph_keys.reserve(mst.size() + knn_keys.size());
+    for (const auto &edge : mst) {
+        graph_keys.push_back(EdgeKey(edge.v0_, edge.v1_, n_points));
+    }
+    for (size_t i = 0; i < knn_keys.size(); ++i) {
+        if (knn_valid[i]) {
+            graph_keys.push_back(knn_keys[i]);
+        }
+    }
+    knn_keys.clear();
+    knn_valid.clear();
+    SortUnique(graph_keys);
+
+    std::vector<WeightedEdge> riemannian_graph(graph_keys.size(),
+                                               WeightedEdge(0, 0, 0));
+#pragma omp parallel for schedule(static)
+    for (int64_t eidx = 0; eidx < int64_t(graph_keys.size()); ++eidx) {
+        size_t v0 = graph_keys[eidx] / n_points;
+        size_t v1 = graph_keys[eidx] % n_points;
+        riemannian_graph[eidx] = WeightedEdge(
+                v0, v1, 1.0 - std::abs(normals_[v0].dot(normals_[v1])));
+    }
 
     // extract MST from Riemannian graph
-    mst = Kruskal(mst, points_.size());
+    mst = Boruvka(riemannian_graph, n_points);
+    riemannian_graph.clear();
 
-    // convert list of edges to graph
-    std::vector<std::unordered_set<size_t>> mst_graph(points_.size());
+    // convert list of edges to graph in compressed sparse row format
+    std::vector<size_t> mst_offsets(n_points + 1, 0);
     for (const auto &edge : mst) {
-        size_t v0 = edge.v0_;
-        size_t v1 = edge.v1_;
-        mst_graph[v0].insert(v1);
-        mst_graph[v1].insert(v0);
+        mst_offsets[edge.v0_ + 1]++;
+        mst_offsets[edge.v1_ + 1]++;
+    }
+    std::partial_sum(mst_offsets.begin(), mst_offsets.end(),
+                     mst_offsets.begin());
+    std::vector<size_t> mst_graph(mst_offsets.back());
+    std::vector<size_t> cursors(mst_offsets.begin(), mst_offsets.end() - 1);
+    for (const auto &edge : mst) {
+        mst_graph[cursors[edge.v0_]++] = edge.v1_;
+        mst_graph[cursors[edge.v1_]++] = edge.v0_;
     }
 
     // find start node for tree traversal
     // init with node that maximizes z
     double max_z = std::numeric_limits<double>::lowest();
-    size_t v0;
-    for (size_t vidx = 0; vidx < points_.size(); ++vidx) {
+    size_t v0 = 0;
+    for (size_t vidx = 0; vidx < n_points; ++vidx) {
         const Eigen::Vector3d &v = points_[vidx];
         if (v(2) > max_z) {
             max_z = v(2);
@@ -475,10 +585,9 @@ void PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
         }
     }
 
-    // traverse MST and orient normals consistently
-    std::queue<size_t> traversal_queue;
-    std::vector<bool> visited(points_.size(), false);
-    traversal_queue.push(v0);
+    // traverse MST level by level and orient normals consistently. Each
+    // normal only depends on the path from the start node, so the nodes of a
+    // level are processed in parallel.
     auto TestAndOrientNormal = [&](const Eigen::Vector3d &n0,
                                    Eigen::Vector3d &n1) {
         if (n0.dot(n1) < 0) {
@@ -486,16 +595,32 @@ void PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
         }
     };
     TestAndOrientNormal(Eigen::Vector3d(0, 0, 1), normals_[v0]);
-    while (!traversal_queue.empty()) {
-        v0 = traversal_queue.front();
-        traversal_queue.pop();
-        visited[v0] = true;
-        for (size_t v1 : mst_graph[v0]) {
-            if (!visited[v1]) {
-                traversal_queue.push(v1);
-                TestAndOrientNormal(normals_[v0], normals_[v1]);
+    std::vector<size_t> parents(n_points, n_points);
+    parents[v0] = v0;
+    std::vector<size_t> frontier = {v0};
+    while (!frontier.empty()) {
+        std::vector<size_t> next_frontier;
+#pragma omp parallel
+        {
+            std::vector<size_t> next_frontier_local;
+#pragma omp for schedule(static) nowait
+            for (int64_t fidx = 0; fidx < int64_t(frontier.size()); ++fidx) {
+                size_t v = frontier[fidx];
+                for (size_t i = mst_offsets[v]; i < mst_offsets[v + 1]; ++i) {
+                    size_t v1 = mst_graph[i];
+                    if (v1 != parents[v]) {
+                        parents[v1] = v;
+                        TestAndOrientNormal(normals_[v], normals_[v1]);
+                        next_frontier_local.push_back(v1);
+                    }
+                }
             }
+#pragma omp critical
+            next_frontier.insert(next_frontier.end(),
+                                 next_frontier_local.begin(),
+                                 next_frontier_local.end());
         }
+        frontier = std::move(next_frontier);
     }
 }
 
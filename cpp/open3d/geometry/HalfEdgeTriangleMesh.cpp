@@ -26,6 +26,10 @@
 
 #include "open3d/geometry/HalfEdgeTriangleMesh.h"
 
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <atomic>
 #include <numeric>
 
 #include "open3d/geometry/TriangleMesh.h"
@@ -47,13 +51,14 @@ HalfEdgeTriangleMesh::HalfEdge::HalfEdge(const Eigen::Vector2i &vertex_indices,
 HalfEdgeTriangleMesh &HalfEdgeTriangleMesh::Clear() {
     MeshBase::Clear();
     half_edges_.clear();
-    ordered_half_edge_from_vertex_.clear();
+    ordered_half_edge_offsets_.clear();
+    ordered_half_edge_indices_.clear();
     return *this;
 }
 
 bool HalfEdgeTriangleMesh::HasHalfEdges() const {
     return half_edges_.size() > 0 &&
-           vertices_.size() == ordered_half_edge_from_vertex_.size();
+           vertices_.size() + 1 == ordered_half_edge_offsets_.size();
 }
 
 int HalfEdgeTriangleMesh::NextHalfEdgeFromVertex(int half_edge_index) const {
@@ -68,7 +73,11 @@ int HalfEdgeTriangleMesh::NextHalfEdgeFromVertex(int half_edge_index) const {
 
 std::vector<int> HalfEdgeTriangleMesh::BoundaryHalfEdgesFromVertex(
         int vertex_index) const {
-    int init_he_index = ordered_half_edge_from_vertex_[vertex_index][0];
+    if (!HasHalfEdges()) {
+        utility::LogError("Half-edges not available.");
+    }
+    int init_he_index = ordered_half_edge_indices_
+            [ordered_half_edge_offsets_[vertex_index]];
     const HalfEdge &init_he = half_edges_[init_he_index];
 
     if (!init_he.IsBoundary()) {
@@ -99,29 +108,99 @@ std::vector<int> HalfEdgeTriangleMesh::BoundaryVerticesFromVertex(
 }
 
 std::vector<std::vector<int>> HalfEdgeTriangleMesh::GetBoundaries() const {
+    if (!HasHalfEdges()) {
+        utility::LogError("Half-edges not available.");
+    }
     std::vector<std::vector<int>> boundaries;
-    std::unordered_set<int> visited;
+    std::vector<bool> visited(vertices_.size(), false);
 
     for (int vertex_ind = 0; vertex_ind < int(vertices_.size()); ++vertex_ind) {
-        if (visited.find(vertex_ind) != visited.end()) {
+        if (visited[vertex_ind] ||
+            ordered_half_edge_offsets_[vertex_ind] ==
+                    ordered_half_edge_offsets_[vertex_ind + 1]) {
             continue;
         }
         // It is guaranteed that if a vertex in on boundary, the starting
         // edge must be on boundary. After purging, it's also guaranteed that
         // a vertex always have out-going half-edges after purging.
-        int first_half_edge_ind = ordered_half_edge_from_vertex_[vertex_ind][0];
+        int first_half_edge_ind = ordered_half_edge_indices_
+                [ordered_half_edge_offsets_[vertex_ind]];
         if (half_edges_[first_half_edge_ind].IsBoundary()) {
             std::vector<int> boundary = BoundaryVerticesFromVertex(vertex_ind);
-            boundaries.push_back(boundary);
             for (int boundary_vertex : boundary) {
-                visited.insert(boundary_vertex);
+                visited[boundary_vertex] = true;
             }
+            boundaries.push_back(std::move(boundary));
         }
-        visited.insert(vertex_ind);
+        visited[vertex_ind] = true;
     }
     return boundaries;
 }
 
+std::vector<int> HalfEdgeTriangleMesh::OrderedHalfEdgesFromVertex(
+        int vertex_index) const {
+    if (!HasHalfEdges() || vertex_index < 0 ||
+        vertex_index >= int(vertices_.size())) {
+        utility::LogError(
+                "vertex index {:d} out of range or half-edges not available.",
+                vertex_index);
+    }
+    return std::vector<int>(
+            ordered_half_edge_indices_.begin() +
+                    ordered_half_edge_offsets_[vertex_index],
+            ordered_half_edge_indices_.begin() +
+                    ordered_half_edge_offsets_[vertex_index + 1]);
+}
+
+std::vector<std::vector<int>>
+HalfEdgeTriangleMesh::GetOrderedHalfEdgesFromVertices() const {
+    std::vector<std::vector<int>> ordered_half_edges;
+    if (!HasHalfEdges()) {
+        return ordered_half_edges;
+    }
+    ordered_half_edges.resize(vertices_.size());
+    for (size_t vertex_index = 0; vertex_index < vertices_.size();
+         ++vertex_index) {
+        ordered_half_edges[vertex_index].assign(
+                ordered_half_edge_indices_.begin() +
+                        ordered_half_edge_offsets_[vertex_index],
+                ordered_half_edge_indices_.begin() +
+                        ordered_half_edge_offsets_[vertex_index + 1]);
+    }
+    return ordered_half_edges;
+}
+
+std::vector<int> HalfEdgeTriangleMesh::OneRingVerticesFromVertex(
+        int vertex_index) const {
+    if (!HasHalfEdges() || vertex_index < 0 ||
+        vertex_index >= int(vertices_.size())) {
+        utility::LogError(
+                "vertex index {:d} out of range or half-edges not available.",
+                vertex_index);
+    }
+    const int begin = ordered_half_edge_offsets_[vertex_index];
+    const int end = ordered_half_edge_offsets_[vertex_index + 1];
+    std::vector<int> one_ring;
+    if (begin == end) {
+        return one_ring;
+    }
+    one_ring.reserve(end - begin + 1);
+    for (int idx = begin; idx < end; ++idx) {
+        const HalfEdge &he = half_edges_[ordered_half_edge_indices_[idx]];
+        one_ring.push_back(he.vertex_indices_(1));
+    }
+    // On boundary, the ring is closed by the start of the in-coming boundary
+    // half-edge, which precedes the last out-going half-edge.
+    const HalfEdge &first_he = half_edges_[ordered_half_edge_indices_[begin]];
+    if (first_he.IsBoundary()) {
+        const HalfEdge &last_he =
+                half_edges_[ordered_half_edge_indices_[end - 1]];
+        const HalfEdge &prev_he = half_edges_[half_edges_[last_he.next_].next_];
+        one_ring.push_back(prev_he.vertex_indices_(0));
+    }
+    return one_ring;
+}
+
 int HalfEdgeTriangleMesh::NextHalfEdgeOnBoundary(
         int curr_half_edge_index) const {
     if (!HasHalfEdges() || curr_half_edge_index >= int(half_edges_.size()) ||
@@ -140,9 +219,10 @@ int HalfEdgeTriangleMesh::NextHalfEdgeOnBoundary(
 
     // curr_half_edge's end point and next_half_edge's start point is the same
     // vertex. It is guaranteed that next_half_edge is the first edge
-    // in ordered_half_edge_from_vertex_ and next_half_edge is a boundary edge.
+    // ordered from the vertex and next_half_edge is a boundary edge.
     int vertex_index = half_edges_[curr_half_edge_index].vertex_indices_(1);
-    int next_half_edge_index = ordered_half_edge_from_vertex_[vertex_index][0];
+    int next_half_edge_index = ordered_half_edge_indices_
+            [ordered_half_edge_offsets_[vertex_index]];
     if (!half_edges_[next_half_edge_index].IsBoundary()) {
         utility::LogWarning(
                 "[NextHalfEdgeOnBoundary] The next half-edge along the "
@@ -171,112 +251,153 @@ HalfEdgeTriangleMesh::CreateFromTriangleMesh(const TriangleMesh &mesh) {
     mesh_cpy->RemoveUnreferencedVertices();
     mesh_cpy->RemoveDegenerateTriangles();
 
-    // Collect half edges
-    // Check: for valid manifolds, there mustn't be duplicated half-edges
-    std::unordered_map<Eigen::Vector2i, size_t,
-                       utility::hash_eigen<Eigen::Vector2i>>
-            vertex_indices_to_half_edge_index;
-
-    for (size_t triangle_index = 0;
-         triangle_index < mesh_cpy->triangles_.size(); triangle_index++) {
+    // Collect half edges. Half edges 3 * i, 3 * i + 1 and 3 * i + 2 belong to
+    // triangle i.
+    const int64_t num_triangles = int64_t(mesh_cpy->triangles_.size());
+    const int64_t num_vertices = int64_t(mesh_cpy->vertices_.size());
+    het_mesh->half_edges_.resize(3 * num_triangles);
+#pragma omp parallel for schedule(static)
+    for (int64_t triangle_index = 0; triangle_index < num_triangles;
+         triangle_index++) {
         const Eigen::Vector3i &triangle = mesh_cpy->triangles_[triangle_index];
-        size_t num_half_edges = het_mesh->half_edges_.size();
-
-        size_t he_0_index = num_half_edges;
-        size_t he_1_index = num_half_edges + 1;
-        size_t he_2_index = num_half_edges + 2;
-        HalfEdge he_0(Eigen::Vector2i(triangle(0), triangle(1)),
-                      int(triangle_index), int(he_1_index), -1);
-        HalfEdge he_1(Eigen::Vector2i(triangle(1), triangle(2)),
-                      int(triangle_index), int(he_2_index), -1);
-        HalfEdge he_2(Eigen::Vector2i(triangle(2), triangle(0)),
-                      int(triangle_index), int(he_0_index), -1);
-
-        if (vertex_indices_to_half_edge_index.find(he_0.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end() ||
-            vertex_indices_to_half_edge_index.find(he_1.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end() ||
-            vertex_indices_to_half_edge_index.find(he_2.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end()) {
-            utility::LogError(
-                    "ComputeHalfEdges failed. Duplicated half-edges.");
+        for (int k = 0; k < 3; ++k) {
+            het_mesh->half_edges_[3 * triangle_index + k] = HalfEdge(
+                    Eigen::Vector2i(triangle(k), triangle((k + 1) % 3)),
+                    int(triangle_index), int(3 * triangle_index + (k + 1) % 3),
+                    -1);
         }
-
-        het_mesh->half_edges_.push_back(he_0);
-        het_mesh->half_edges_.push_back(he_1);
-        het_mesh->half_edges_.push_back(he_2);
-        vertex_indices_to_half_edge_index[he_0.vertex_indices_] = he_0_index;
-        vertex_indices_to_half_edge_index[he_1.vertex_indices_] = he_1_index;
-        vertex_indices_to_half_edge_index[he_2.vertex_indices_] = he_2_index;
     }
 
-    // Fill twin half-edge. In the previous step, it is already guaranteed that
-    // each half-edge can have at most one twin half-edge.
-    for (size_t this_he_index = 0; this_he_index < het_mesh->half_edges_.size();
-         this_he_index++) {
-        HalfEdge &this_he = het_mesh->half_edges_[this_he_index];
-        Eigen::Vector2i twin_end_points(this_he.vertex_indices_(1),
-                                        this_he.vertex_indices_(0));
-        if (this_he.twin_ == -1 &&
-            vertex_indices_to_half_edge_index.find(twin_end_points) !=
-                    vertex_indices_to_half_edge_index.end()) {
-            size_t twin_he_index =
-                    vertex_indices_to_half_edge_index[twin_end_points];
-            HalfEdge &twin_he = het_mesh->half_edges_[twin_he_index];
-            this_he.twin_ = int(twin_he_index);
-            twin_he.twin_ = int(this_he_index);
+    // Pair twin half-edges by sorting the half-edges by their undirected
+    // edge. For valid manifolds, each edge has at most two half-edges, with
+    // opposite directions.
+    const int64_t num_half_edges = int64_t(het_mesh->half_edges_.size());
+    std::vector<std::pair<int64_t, int>> edge_keys(num_half_edges);
+#pragma omp parallel for schedule(static)
+    for (int64_t he_index = 0; he_index < num_half_edges; he_index++) {
+        const Eigen::Vector2i &vertex_indices =
+                het_mesh->half_edges_[he_index].vertex_indices_;
+        int64_t v0 = std::min(vertex_indices(0), vertex_indices(1));
+        int64_t v1 = std::max(vertex_indices(0), vertex_indices(1));
+        edge_keys[he_index] = std::make_pair(v0 * num_vertices + v1,
+                                             int(he_index));
+    }
+    tbb::parallel_sort(edge_keys.begin(), edge_keys.end());
+
+    std::atomic<bool> duplicated{false};
+#pragma omp parallel for schedule(static)
+    for (int64_t key_index = 0; key_index < num_half_edges; key_index++) {
+        // Only the first half-edge of an edge pairs up its twin.
+        if (key_index > 0 &&
+            edge_keys[key_index - 1].first == edge_keys[key_index].first) {
+            continue;
         }
+        int64_t next_index = key_index + 1;
+        if (next_index == num_half_edges ||
+            edge_keys[next_index].first != edge_keys[key_index].first) {
+            continue;
+        }
+        HalfEdge &this_he = het_mesh->half_edges_[edge_keys[key_index].second];
+        HalfEdge &twin_he = het_mesh->half_edges_[edge_keys[next_index].second];
+        if (this_he.vertex_indices_(0) == twin_he.vertex_indices_(0) ||
+            (next_index + 1 < num_half_edges &&
+             edge_keys[next_index + 1].first == edge_keys[key_index].first)) {
+            duplicated = true;
+            continue;
+        }
+        this_he.twin_ = edge_keys[next_index].second;
+        twin_he.twin_ = edge_keys[key_index].second;
+    }
+    if (duplicated) {
+        utility::LogError("ComputeHalfEdges failed. Duplicated half-edges.");
     }
 
-    // Get out-going half-edges from each vertex. This can be done during
-    // half-edge construction. Done here for readability.
-    std::vector<std::vector<int>> half_edges_from_vertex(
-            mesh_cpy->vertices_.size());
-    for (size_t half_edge_index = 0;
-         half_edge_index < het_mesh->half_edges_.size(); half_edge_index++) {
-        int src_vertex_index =
-                het_mesh->half_edges_[half_edge_index].vertex_indices_(0);
-        half_edges_from_vertex[src_vertex_index].push_back(
-                int(half_edge_index));
+    // Get out-going half-edges from each vertex, in increasing order of their
+    // indices.
+    std::vector<int> half_edge_from_vertex_offsets(num_vertices + 1, 0);
+    for (const HalfEdge &he : het_mesh->half_edges_) {
+        half_edge_from_vertex_offsets[he.vertex_indices_(0) + 1]++;
+    }
+    std::partial_sum(half_edge_from_vertex_offsets.begin(),
+                     half_edge_from_vertex_offsets.end(),
+                     half_edge_from_vertex_offsets.begin());
+    std::vector<int> half_edges_from_vertex(num_half_edges);
+    {
+        std::vector<int> cursors(half_edge_from_vertex_offsets.begin(),
+                                 half_edge_from_vertex_offsets.end() - 1);
+        for (int64_t he_index = 0; he_index < num_half_edges; he_index++) {
+            int src_vertex_index =
+                    het_mesh->half_edges_[he_index].vertex_indices_(0);
+            half_edges_from_vertex[cursors[src_vertex_index]++] = int(he_index);
+        }
     }
 
     // Find ordered half-edges from each vertex by traversal. To be a valid
     // manifold, there can be at most 1 boundary half-edge from each vertex.
-    het_mesh->ordered_half_edge_from_vertex_.resize(mesh_cpy->vertices_.size());
-    for (size_t vertex_index = 0; vertex_index < mesh_cpy->vertices_.size();
+    // The traversal visits at most all the out-going half-edges of a vertex,
+    // so each vertex writes to its own range of ordered_half_edges.
+    std::vector<int> ordered_half_edges(num_half_edges);
+    std::vector<int> num_ordered_half_edges(num_vertices, 0);
+    std::atomic<bool> invalid_vertex{false};
+#pragma omp parallel for schedule(static)
+    for (int64_t vertex_index = 0; vertex_index < num_vertices;
          vertex_index++) {
+        const int begin = half_edge_from_vertex_offsets[vertex_index];
+        const int end = half_edge_from_vertex_offsets[vertex_index + 1];
+        if (begin == end) {
+            continue;
+        }
         size_t num_boundaries = 0;
         int init_half_edge_index = 0;
-        for (const int &half_edge_index :
-             half_edges_from_vertex[vertex_index]) {
+        for (int idx = begin; idx < end; ++idx) {
+            int half_edge_index = half_edges_from_vertex[idx];
             if (het_mesh->half_edges_[half_edge_index].IsBoundary()) {
                 num_boundaries++;
                 init_half_edge_index = half_edge_index;
             }
         }
         if (num_boundaries > 1) {
-            utility::LogError("ComputeHalfEdges failed. Invalid vertex.");
+            invalid_vertex = true;
+            continue;
         }
         // If there is a boundary edge, start from that; otherwise start
         // with any half-edge (default 0) started from this vertex.
         if (num_boundaries == 0) {
-            init_half_edge_index = half_edges_from_vertex[vertex_index][0];
+            init_half_edge_index = half_edges_from_vertex[begin];
         }
 
-        // Push edges to ordered_half_edge_from_vertex_.
+        int count = 0;
         int curr_he_index = init_half_edge_index;
-        het_mesh->ordered_half_edge_from_vertex_[vertex_index].push_back(
-                curr_he_index);
-        int next_next_twin_he_index =
-                het_mesh->NextHalfEdgeFromVertex(curr_he_index);
-        curr_he_index = next_next_twin_he_index;
-        while (curr_he_index != -1 && curr_he_index != init_half_edge_index) {
-            het_mesh->ordered_half_edge_from_vertex_[vertex_index].push_back(
-                    curr_he_index);
-            next_next_twin_he_index =
-                    het_mesh->NextHalfEdgeFromVertex(curr_he_index);
-            curr_he_index = next_next_twin_he_index;
+        ordered_half_edges[begin + count++] = curr_he_index;
+        curr_he_index = het_mesh->NextHalfEdgeFromVertex(curr_he_index);
+        while (curr_he_index != -1 && curr_he_index != init_half_edge_index &&
+               begin + count < end) {
+            ordered_half_edges[begin + count++] = curr_he_index;
+            curr_he_index = het_mesh->NextHalfEdgeFromVertex(curr_he_index);
         }
+        num_ordered_half_edges[vertex_index] = count;
+    }
+    if (invalid_vertex) {
+        utility::LogError("ComputeHalfEdges failed. Invalid vertex.");
+    }
+
+    // Compact the ordered half-edges, which are fewer than the out-going
+    // half-edges for vertices joining several fans.
+    het_mesh->ordered_half_edge_offsets_.resize(num_vertices + 1);
+    het_mesh->ordered_half_edge_offsets_[0] = 0;
+    std::partial_sum(num_ordered_half_edges.begin(),
+                     num_ordered_half_edges.end(),
+                     het_mesh->ordered_half_edge_offsets_.begin() + 1);
+    het_mesh->ordered_half_edge_indices_.resize(
+            het_mesh->ordered_half_edge_offsets_.back());
+#pragma omp parallel for schedule(static)
+    for (int64_t vertex_index = 0; vertex_index < num_vertices;
+         vertex_index++) {
+        auto src = ordered_half_edges.begin() +
+                   half_edge_from_vertex_offsets[vertex_index];
+        auto dst = het_mesh->ordered_half_edge_indices_.begin() +
+                   het_mesh->ordered_half_edge_offsets_[vertex_index];
+        std::copy(src, src + num_ordered_half_edges[vertex_index], dst);
     }
 
     mesh_cpy->ComputeVertexNormals();
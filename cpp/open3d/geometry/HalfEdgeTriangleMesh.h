@@ -98,12 +98,27 @@ public:
     /// Returns a vector of boundaries. A boundary is a vector of vertices.
     std::vector<std::vector<int>> GetBoundaries() const;
 
+    /// Counter-clockwise ordered half-edges started from a vertex. If the
+    /// vertex is on boundary, the starting edge is on boundary too.
+    std::vector<int> OrderedHalfEdgesFromVertex(int vertex_index) const;
+
+    /// Counter-clockwise ordered half-edges started from each vertex, copied
+    /// from the flat ordered_half_edge_offsets_ and
+    /// ordered_half_edge_indices_.
+    std::vector<std::vector<int>> GetOrderedHalfEdgesFromVertices() const;
+
+    /// Counter-clockwise ordered one-ring neighbor vertices of a vertex. For a
+    /// vertex on boundary, the ring starts at the end of its out-going
+    /// boundary half edge and ends at the start of its in-coming one.
+    std::vector<int> OneRingVerticesFromVertex(int vertex_index) const;
+
     HalfEdgeTriangleMesh &operator+=(const HalfEdgeTriangleMesh &mesh);
 
     HalfEdgeTriangleMesh operator+(const HalfEdgeTriangleMesh &mesh) const;
 
     /// Convert HalfEdgeTriangleMesh from TriangleMesh. Throws exception if the
-    /// input mesh is not manifold.
+    /// input mesh is not manifold. Twin half edges are paired by sorting the
+    /// edges, and the half edges from each vertex are ordered in parallel.
     static std::shared_ptr<HalfEdgeTriangleMesh> CreateFromTriangleMesh(
             const TriangleMesh &mesh);
 
@@ -129,9 +144,14 @@ public:
     /// List of HalfEdge in the mesh.
     std::vector<HalfEdge> half_edges_;
 
-    /// Counter-clockwise ordered half-edges started from each vertex.
+    /// Offsets of the ordered half-edges started from each vertex. The
+    /// counter-clockwise ordered half-edges started from vertex i are
+    /// ordered_half_edge_indices_[ordered_half_edge_offsets_[i]] to
+    /// ordered_half_edge_indices_[ordered_half_edge_offsets_[i + 1] - 1].
     /// If the vertex is on boundary, the starting edge must be on boundary too.
-    std::vector<std::vector<int>> ordered_half_edge_from_vertex_;
+    std::vector<int> ordered_half_edge_offsets_;
+    /// Concatenated ordered half-edges started from each vertex.
+    std::vector<int> ordered_half_edge_indices_;
 };
 
 }  // namespace geometry
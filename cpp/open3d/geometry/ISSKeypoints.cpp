@@ -30,6 +30,7 @@
 
 #include <Eigen/Core>
 #include <Eigen/Eigenvalues>
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include <tuple>
@@ -45,6 +46,149 @@ namespace open3d {
 
 namespace {
 
+/// Points are processed in chunks, so that the radius search results of a
+/// chunk are gathered once and then cached or released.
+constexpr int kChunkSize = 1 << 16;
+
+/// Radius neighborhoods of the points [begin, end) in compressed sparse row
+/// layout. Squared distances are kept to filter the neighborhoods of smaller
+/// radii.
+struct Neighborhoods {
+    int begin = 0;
+    int end = 0;
+    std::vector<int64_t> offsets;
+    std::vector<int> indices;
+    std::vector<double> distances2;
+
+    size_t NumBytes() const {
+        return offsets.size() * sizeof(int64_t) +
+               indices.size() * (sizeof(int) + sizeof(double));
+    }
+};
+
+Neighborhoods SearchNeighborhoods(const std::vector<Eigen::Vector3d>& points,
+                                  const geometry::KDTreeFlann& kdtree,
+                                  int begin,
+                                  int end,
+                                  double radius) {
+    const int n = end - begin;
+    std::vector<std::vector<int>> indices(n);
+    std::vector<std::vector<double>> distances2(n);
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < n; i++) {
+        kdtree.SearchRadius(points[begin + i], radius, indices[i],
+                            distances2[i]);
+    }
+
+    Neighborhoods nb;
+    nb.begin = begin;
+    nb.end = end;
+    nb.offsets.resize(n + 1);
+    nb.offsets[0] = 0;
+    for (int i = 0; i < n; i++) {
+        nb.offsets[i + 1] = nb.offsets[i] + indices[i].size();
+    }
+    nb.indices.resize(nb.offsets[n]);
+    nb.distances2.resize(nb.offsets[n]);
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < n; i++) {
+        std::copy(indices[i].begin(), indices[i].end(),
+                  nb.indices.begin() + nb.offsets[i]);
+        std::copy(distances2[i].begin(), distances2[i].end(),
+                  nb.distances2.begin() + nb.offsets[i]);
+    }
+    return nb;
+}
+
+/// Squared radius as KDTreeFlann::SearchRadius compares it, which only keeps
+/// the neighbors at a squared distance below float(radius^2).
+double SearchRadius2(double radius) { return float(radius * radius); }
+
+/// Same as utility::ComputeCovariance, restricted to the neighbors strictly
+/// within squared distance \p radius2. Returns the number of neighbors.
+int ComputeCovariance(const std::vector<Eigen::Vector3d>& points,
+                      const int* indices,
+                      const double* distances2,
+                      int64_t count,
+                      double radius2,
+                      Eigen::Matrix3d& covariance) {
+    Eigen::Matrix<double, 9, 1> cumulants;
+    cumulants.setZero();
+    int num_neighbors = 0;
+    for (int64_t k = 0; k < count; k++) {
+        if (distances2[k] >= radius2) {
+            continue;
+        }
+        const Eigen::Vector3d& point = points[indices[k]];
+        cumulants(0) += point(0);
+        cumulants(1) += point(1);
+        cumulants(2) += point(2);
+        cumulants(3) += point(0) * point(0);
+        cumulants(4) += point(0) * point(1);
+        cumulants(5) += point(0) * point(2);
+        cumulants(6) += point(1) * point(1);
+        cumulants(7) += point(1) * point(2);
+        cumulants(8) += point(2) * point(2);
+        num_neighbors++;
+    }
+    if (num_neighbors == 0) {
+        return 0;
+    }
+    cumulants /= (double)num_neighbors;
+    covariance(0, 0) = cumulants(3) - cumulants(0) * cumulants(0);
+    covariance(1, 1) = cumulants(6) - cumulants(1) * cumulants(1);
+    covariance(2, 2) = cumulants(8) - cumulants(2) * cumulants(2);
+    covariance(0, 1) = cumulants(4) - cumulants(0) * cumulants(1);
+    covariance(1, 0) = covariance(0, 1);
+    covariance(0, 2) = cumulants(5) - cumulants(0) * cumulants(2);
+    covariance(2, 0) = covariance(0, 2);
+    covariance(1, 2) = cumulants(7) - cumulants(1) * cumulants(2);
+    covariance(2, 1) = covariance(1, 2);
+    return num_neighbors;
+}
+
+/// Computes the third eigenvalues of the salient points in \p nb. Scatter
+/// matrices of the chunk are gathered first, and their eigenvalues are then
+/// computed in a separate batched pass without eigenvectors.
+void ComputeThirdEigenValues(const std::vector<Eigen::Vector3d>& points,
+                             const Neighborhoods& nb,
+                             double salient_radius,
+                             double gamma_21,
+                             double gamma_32,
+                             int min_neighbors,
+                             std::vector<double>& third_eigen_values) {
+    const int n = nb.end - nb.begin;
+    const double radius2 = SearchRadius2(salient_radius);
+    std::vector<Eigen::Matrix3d> covariances(n);
+    std::vector<char> valid(n, 0);
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < n; i++) {
+        const int64_t offset = nb.offsets[i];
+        const int num_neighbors = ComputeCovariance(
+                points, nb.indices.data() + offset,
+                nb.distances2.data() + offset, nb.offsets[i + 1] - offset,
+                radius2, covariances[i]);
+        valid[i] = num_neighbors >= min_neighbors &&
+                   num_neighbors > 0 && !covariances[i].isZero();
+    }
+
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < n; i++) {
+        if (!valid[i]) {
+            continue;
+        }
+        Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(
+                covariances[i], Eigen::EigenvaluesOnly);
+        const double& e1c = solver.eigenvalues()[2];
+        const double& e2c = solver.eigenvalues()[1];
+        const double& e3c = solver.eigenvalues()[0];
+
+        if ((e2c / e1c) < gamma_21 && e3c / e2c < gamma_32) {
+            third_eigen_values[nb.begin + i] = e3c;
+        }
+    }
+}
+
 bool IsLocalMaxima(int query_idx,
                    const std::vector<int>& indices,
                    const std::vector<double>& third_eigen_values) {
@@ -56,14 +200,36 @@ bool IsLocalMaxima(int query_idx,
     return true;
 }
 
+/// Non maxima suppression over the cached neighborhoods strictly within
+/// squared distance \p radius2.
+bool IsLocalMaxima(int query_idx,
+                   const Neighborhoods& nb,
+                   double radius2,
+                   int min_neighbors,
+                   const std::vector<double>& third_eigen_values) {
+    const int i = query_idx - nb.begin;
+    int num_neighbors = 0;
+    for (int64_t k = nb.offsets[i]; k < nb.offsets[i + 1]; k++) {
+        if (nb.distances2[k] >= radius2) {
+            continue;
+        }
+        if (third_eigen_values[query_idx] <
+            third_eigen_values[nb.indices[k]]) {
+            return false;
+        }
+        num_neighbors++;
+    }
+    return num_neighbors >= min_neighbors;
+}
+
 double ComputeModelResolution(const std::vector<Eigen::Vector3d>& points,
                               const geometry::KDTreeFlann& kdtree) {
-    std::vector<int> indices(2);
-    std::vector<double> distances(2);
     double resolution = 0.0;
-
-    for (const auto& point : points) {
-        if (kdtree.SearchKNN(point, 2, indices, distances) != 0) {
+#pragma omp parallel for schedule(static) reduction(+ : resolution)
+    for (int i = 0; i < (int)points.size(); i++) {
+        std::vector<int> indices(2);
+        std::vector<double> distances(2);
+        if (kdtree.SearchKNN(points[i], 2, indices, distances) != 0) {
             resolution += std::sqrt(distances[1]);
         }
     }
@@ -75,18 +241,19 @@ double ComputeModelResolution(const std::vector<Eigen::Vector3d>& points,
 
 namespace geometry {
 namespace keypoint {
-std::shared_ptr<PointCloud> ComputeISSKeypoints(
+std::vector<size_t> ComputeISSKeypointIndices(
         const PointCloud& input,
         double salient_radius /* = 0.0 */,
         double non_max_radius /* = 0.0 */,
         double gamma_21 /* = 0.975 */,
         double gamma_32 /* = 0.975 */,
-        int min_neighbors /*= 5 */) {
+        int min_neighbors /*= 5 */,
+        size_t max_cache_bytes /* = 1 << 30 */) {
     if (input.points_.empty()) {
-        utility::LogWarning("[ComputeISSKeypoints] Input PointCloud is empty!");
-        return std::make_shared<PointCloud>();
+        return {};
     }
     const auto& points = input.points_;
+    const int num_points = (int)points.size();
     KDTreeFlann kdtree(input);
 
     if (salient_radius == 0.0 || non_max_radius == 0.0) {
@@ -99,52 +266,84 @@ std::shared_ptr<PointCloud> ComputeISSKeypoints(
                 salient_radius, non_max_radius);
     }
 
-    std::vector<double> third_eigen_values(points.size());
-#pragma omp parallel for schedule(static) shared(third_eigen_values)
-    for (int i = 0; i < (int)points.size(); i++) {
-        std::vector<int> indices;
-        std::vector<double> dist;
-        int nb_neighbors =
-                kdtree.SearchRadius(points[i], salient_radius, indices, dist);
-        if (nb_neighbors < min_neighbors) {
-            continue;
+    // Neighborhoods are searched once with the larger radius and shared by
+    // both passes. Leading chunks are cached up to max_cache_bytes, the
+    // remaining ones are searched again for non maxima suppression.
+    const double search_radius = std::max(salient_radius, non_max_radius);
+    std::vector<double> third_eigen_values(num_points, 0.0);
+    std::vector<Neighborhoods> cache;
+    size_t cached_bytes = 0;
+    int cached_end = 0;
+    for (int begin = 0; begin < num_points; begin += kChunkSize) {
+        const int end = std::min(begin + kChunkSize, num_points);
+        Neighborhoods nb = SearchNeighborhoods(points, kdtree, begin, end,
+                                               search_radius);
+        ComputeThirdEigenValues(points, nb, salient_radius, gamma_21,
+                                gamma_32, min_neighbors, third_eigen_values);
+        if (cached_end == begin &&
+            cached_bytes + nb.NumBytes() <= max_cache_bytes) {
+            cached_bytes += nb.NumBytes();
+            cached_end = end;
+            cache.push_back(std::move(nb));
         }
+    }
+    utility::LogDebug(
+            "[ComputeISSKeypoints] Cached neighborhoods of {}/{} points "
+            "({} bytes)",
+            cached_end, num_points, cached_bytes);
 
-        Eigen::Matrix3d cov = utility::ComputeCovariance(points, indices);
-        if (cov.isZero()) {
-            continue;
-        }
-
-        Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(cov);
-        const double& e1c = solver.eigenvalues()[2];
-        const double& e2c = solver.eigenvalues()[1];
-        const double& e3c = solver.eigenvalues()[0];
-
-        if ((e2c / e1c) < gamma_21 && e3c / e2c < gamma_32) {
-            third_eigen_values[i] = e3c;
+    const double non_max_radius2 = SearchRadius2(non_max_radius);
+    std::vector<char> is_keypoint(num_points, 0);
+    for (const auto& nb : cache) {
+#pragma omp parallel for schedule(static)
+        for (int i = nb.begin; i < nb.end; i++) {
+            if (third_eigen_values[i] > 0.0) {
+                is_keypoint[i] = IsLocalMaxima(i, nb, non_max_radius2,
+                                               min_neighbors,
+                                               third_eigen_values);
+            }
         }
     }
-
-    std::vector<size_t> kp_indices;
-    kp_indices.reserve(points.size());
-#pragma omp parallel for schedule(static) shared(kp_indices)
-    for (int i = 0; i < (int)points.size(); i++) {
+#pragma omp parallel for schedule(static)
+    for (int i = cached_end; i < num_points; i++) {
         if (third_eigen_values[i] > 0.0) {
             std::vector<int> nn_indices;
             std::vector<double> dist;
             int nb_neighbors = kdtree.SearchRadius(points[i], non_max_radius,
                                                    nn_indices, dist);
 
-            if (nb_neighbors >= min_neighbors &&
-                IsLocalMaxima(i, nn_indices, third_eigen_values)) {
-                kp_indices.emplace_back(i);
-            }
+            is_keypoint[i] =
+                    nb_neighbors >= min_neighbors &&
+                    IsLocalMaxima(i, nn_indices, third_eigen_values);
         }
     }
 
+    std::vector<size_t> kp_indices;
+    for (int i = 0; i < num_points; i++) {
+        if (is_keypoint[i]) {
+            kp_indices.push_back(i);
+        }
+    }
     utility::LogDebug("[ComputeISSKeypoints] Extracted {} keypoints",
                       kp_indices.size());
-    return input.SelectByIndex(kp_indices);
+    return kp_indices;
+}
+
+std::shared_ptr<PointCloud> ComputeISSKeypoints(
+        const PointCloud& input,
+        double salient_radius /* = 0.0 */,
+        double non_max_radius /* = 0.0 */,
+        double gamma_21 /* = 0.975 */,
+        double gamma_32 /* = 0.975 */,
+        int min_neighbors /*= 5 */,
+        size_t max_cache_bytes /* = 1 << 30 */) {
+    if (input.points_.empty()) {
+        utility::LogWarning("[ComputeISSKeypoints] Input PointCloud is empty!");
+        return std::make_shared<PointCloud>();
+    }
+    return input.SelectByIndex(ComputeISSKeypointIndices(
+            input, salient_radius, non_max_radius, gamma_21, gamma_32,
+            min_neighbors, max_cache_bytes));
 }
 
 }  // namespace keypoint
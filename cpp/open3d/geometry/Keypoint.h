@@ -30,7 +30,9 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <vector>
 
 namespace open3d {
 namespace geometry {
@@ -56,13 +58,29 @@ namespace keypoint {
 /// eigenvalue
 /// \param min_neighbors Minimum number of neighbors that has to be found to
 /// consider a keypoint.
+/// \param max_cache_bytes Memory budget for the radius neighborhoods that are
+/// shared between the saliency and the non maxima suppression passes.
+/// Neighborhoods beyond the budget are searched again.
 /// \authors Ignacio Vizzo and Cyrill Stachniss, University of Bonn.
-std::shared_ptr<PointCloud> ComputeISSKeypoints(const PointCloud &input,
-                                                double salient_radius = 0.0,
-                                                double non_max_radius = 0.0,
-                                                double gamma_21 = 0.975,
-                                                double gamma_32 = 0.975,
-                                                int min_neighbors = 5);
+std::shared_ptr<PointCloud> ComputeISSKeypoints(
+        const PointCloud &input,
+        double salient_radius = 0.0,
+        double non_max_radius = 0.0,
+        double gamma_21 = 0.975,
+        double gamma_32 = 0.975,
+        int min_neighbors = 5,
+        size_t max_cache_bytes = size_t(1) << 30);
+
+/// \brief Function that computes the indices of the ISS Keypoints of an input
+/// point cloud in ascending order. See ComputeISSKeypoints for the parameters.
+std::vector<size_t> ComputeISSKeypointIndices(
+        const PointCloud &input,
+        double salient_radius = 0.0,
+        double non_max_radius = 0.0,
+        double gamma_21 = 0.975,
+        double gamma_32 = 0.975,
+        int min_neighbors = 5,
+        size_t max_cache_bytes = size_t(1) << 30);
 
 }  // namespace keypoint
 }  // namespace geometry
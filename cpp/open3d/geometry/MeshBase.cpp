@@ -124,8 +124,8 @@ MeshBase MeshBase::operator+(const MeshBase &mesh) const {
 }
 
 std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
-MeshBase::ComputeConvexHull() const {
-    return Qhull::ComputeConvexHull(vertices_);
+MeshBase::ComputeConvexHull(bool parallel) const {
+    return Qhull::ComputeConvexHull(vertices_, parallel);
 }
 
 }  // namespace geometry
@@ -133,8 +133,11 @@ public:
     }
 
     /// Function that computes the convex hull of the triangle mesh using qhull
+    ///
+    /// \param parallel Cull interior points and reduce partitions of the
+    /// points to their hull vertices in parallel, see Qhull::ComputeConvexHull.
     std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
-    ComputeConvexHull() const;
+    ComputeConvexHull(bool parallel = false) const;
 
 protected:
     // Forward child class type to avoid indirect nonvirtual base
@@ -27,6 +27,9 @@
 #include "open3d/geometry/PointCloud.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <numeric>
 
 #include "open3d/geometry/BoundingVolume.h"
@@ -123,21 +126,26 @@ PointCloud PointCloud::operator+(const PointCloud &cloud) const {
 }
 
 std::vector<double> PointCloud::ComputePointCloudDistance(
-        const PointCloud &target) {
+        const PointCloud &target, double max_distance /* = 0.0 */) const {
     std::vector<double> distances(points_.size());
     KDTreeFlann kdtree;
     kdtree.SetGeometry(target);
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)points_.size(); i++) {
+#pragma omp parallel
+    {
         std::vector<int> indices(1);
         std::vector<double> dists(1);
-        if (kdtree.SearchKNN(points_[i], 1, indices, dists) == 0) {
-            utility::LogDebug(
-                    "[ComputePointCloudToPointCloudDistance] Found a point "
-                    "without neighbors.");
-            distances[i] = 0.0;
-        } else {
-            distances[i] = std::sqrt(dists[0]);
+#pragma omp for schedule(static)
+        for (int i = 0; i < (int)points_.size(); i++) {
+            int num_neighbors =
+                    max_distance > 0.0
+                            ? kdtree.SearchHybrid(points_[i], max_distance, 1,
+                                                  indices, dists)
+                            : kdtree.SearchKNN(points_[i], 1, indices, dists);
+            if (num_neighbors == 0) {
+                distances[i] = max_distance > 0.0 ? max_distance : 0.0;
+            } else {
+                distances[i] = std::sqrt(dists[0]);
+            }
         }
     }
     return distances;
@@ -580,10 +588,30 @@ std::vector<double> PointCloud::ComputeNearestNeighborDistance() const {
 }
 
 std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
-PointCloud::ComputeConvexHull() const {
-    return Qhull::ComputeConvexHull(points_);
+PointCloud::ComputeConvexHull(bool parallel) const {
+    return Qhull::ComputeConvexHull(points_, parallel);
+}
+
+namespace {
+
+/// Spherical flipping of \p points around \p camera_location into
+/// \p spherical_projection, followed by the origin.
+void SphericalFlip(const std::vector<Eigen::Vector3d> &points,
+                   const Eigen::Vector3d &camera_location,
+                   double radius,
+                   std::vector<Eigen::Vector3d> &spherical_projection) {
+    spherical_projection.resize(points.size() + 1);
+    for (size_t pidx = 0; pidx < points.size(); ++pidx) {
+        Eigen::Vector3d projected_point = points[pidx] - camera_location;
+        double norm = projected_point.norm();
+        spherical_projection[pidx] =
+                projected_point + 2 * (radius - norm) * projected_point / norm;
+    }
+    spherical_projection.back() = Eigen::Vector3d(0, 0, 0);
 }
 
+}  // unnamed namespace
+
 std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
 PointCloud::HiddenPointRemoval(const Eigen::Vector3d &camera_location,
                                const double radius) const {
@@ -592,18 +620,10 @@ PointCloud::HiddenPointRemoval(const Eigen::Vector3d &camera_location,
                 "[HiddenPointRemoval] radius must be larger than zero.");
     }
 
-    // perform spherical projection
+    // perform spherical projection, with the origin last
     std::vector<Eigen::Vector3d> spherical_projection;
-    for (size_t pidx = 0; pidx < points_.size(); ++pidx) {
-        Eigen::Vector3d projected_point = points_[pidx] - camera_location;
-        double norm = projected_point.norm();
-        spherical_projection.push_back(
-                projected_point + 2 * (radius - norm) * projected_point / norm);
-    }
-
-    // add origin
-    size_t origin_pidx = spherical_projection.size();
-    spherical_projection.push_back(Eigen::Vector3d(0, 0, 0));
+    SphericalFlip(points_, camera_location, radius, spherical_projection);
+    size_t origin_pidx = points_.size();
 
     // calculate convex hull of spherical projection
     std::shared_ptr<TriangleMesh> visible_mesh;
@@ -646,5 +666,109 @@ PointCloud::HiddenPointRemoval(const Eigen::Vector3d &camera_location,
     return std::make_tuple(visible_mesh, pt_map);
 }
 
+std::vector<std::vector<size_t>> PointCloud::HiddenPointRemoval(
+        const std::vector<Eigen::Vector3d> &camera_locations,
+        const double radius) const {
+    if (radius <= 0) {
+        utility::LogError(
+                "[HiddenPointRemoval] radius must be larger than zero.");
+    }
+
+    std::vector<std::vector<size_t>> visible_indices(camera_locations.size());
+    // Qhull errors must not escape the parallel region.
+    std::string error_message;
+#pragma omp parallel
+    {
+        std::vector<Eigen::Vector3d> spherical_projection;
+#pragma omp for schedule(dynamic)
+        for (int vidx = 0; vidx < int(camera_locations.size()); ++vidx) {
+            SphericalFlip(points_, camera_locations[vidx], radius,
+                          spherical_projection);
+            std::vector<size_t> pt_map;
+            try {
+                std::tie(std::ignore, pt_map) =
+                        Qhull::ComputeConvexHull(spherical_projection);
+            } catch (const std::exception &e) {
+#pragma omp critical
+                { error_message = e.what(); }
+                continue;
+            }
+            std::vector<size_t> &visible = visible_indices[vidx];
+            visible.reserve(pt_map.size());
+            for (size_t pidx : pt_map) {
+                if (pidx != points_.size()) visible.push_back(pidx);
+            }
+            std::sort(visible.begin(), visible.end());
+        }
+    }
+    if (!error_message.empty()) {
+        utility::LogError("[HiddenPointRemoval] {}", error_message);
+    }
+    return visible_indices;
+}
+
+std::vector<std::vector<size_t>> PointCloud::HiddenPointRemovalZBuffer(
+        const std::vector<Eigen::Vector3d> &camera_locations,
+        int resolution,
+        double depth_tolerance) const {
+    if (resolution <= 0) {
+        utility::LogError(
+                "[HiddenPointRemovalZBuffer] resolution must be larger than "
+                "zero.");
+    }
+    if (depth_tolerance < 0) {
+        utility::LogError(
+                "[HiddenPointRemovalZBuffer] depth_tolerance must not be "
+                "negative.");
+    }
+
+    const int num_rows = resolution;
+    const int num_cols = 2 * resolution;
+    const double inf = std::numeric_limits<double>::infinity();
+    // Scratch buffers shared by all the viewpoints.
+    std::vector<double> zbuffer(size_t(num_rows) * num_cols);
+    std::vector<int64_t> cells(points_.size());
+    std::vector<double> depths(points_.size());
+
+    std::vector<std::vector<size_t>> visible_indices(camera_locations.size());
+    for (size_t vidx = 0; vidx < camera_locations.size(); ++vidx) {
+        const Eigen::Vector3d &camera_location = camera_locations[vidx];
+#pragma omp parallel for schedule(static)
+        for (int64_t pidx = 0; pidx < int64_t(points_.size()); ++pidx) {
+            Eigen::Vector3d d = points_[pidx] - camera_location;
+            double depth = d.norm();
+            depths[pidx] = depth;
+            if (depth == 0) {
+                cells[pidx] = -1;
+                continue;
+            }
+            double cos_elevation = std::min(1.0, std::max(-1.0, d(2) / depth));
+            double elevation = std::acos(cos_elevation);
+            double azimuth = std::atan2(d(1), d(0)) + M_PI;
+            int row = std::min(num_rows - 1, int(elevation / M_PI * num_rows));
+            int col = std::min(num_cols - 1,
+                               int(azimuth / (2 * M_PI) * num_cols));
+            cells[pidx] = int64_t(row) * num_cols + col;
+        }
+
+        std::fill(zbuffer.begin(), zbuffer.end(), inf);
+        for (size_t pidx = 0; pidx < points_.size(); ++pidx) {
+            if (cells[pidx] >= 0) {
+                zbuffer[cells[pidx]] =
+                        std::min(zbuffer[cells[pidx]], depths[pidx]);
+            }
+        }
+
+        std::vector<size_t> &visible = visible_indices[vidx];
+        for (size_t pidx = 0; pidx < points_.size(); ++pidx) {
+            if (cells[pidx] < 0 ||
+                depths[pidx] <= zbuffer[cells[pidx]] * (1 + depth_tolerance)) {
+                visible.push_back(pidx);
+            }
+        }
+    }
+    return visible_indices;
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -31,6 +31,7 @@
 #include <tuple>
 #include <vector>
 
+#include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/Geometry3D.h"
 #include "open3d/geometry/KDTreeSearchParam.h"
 
@@ -47,6 +48,25 @@ class RGBDImage;
 class TriangleMesh;
 class VoxelGrid;
 
+/// \class ClusterStatistics
+///
+/// \brief Per label statistics of a labeled point cloud, indexed by label.
+/// Labels without points have a zero count and empty bounding boxes.
+class ClusterStatistics {
+public:
+    /// Number of points with each label.
+    std::vector<size_t> counts_;
+    /// Mean of the points with each label.
+    std::vector<Eigen::Vector3d> centroids_;
+    /// Covariance of the points with each label.
+    std::vector<Eigen::Matrix3d> covariances_;
+    /// Axis aligned bounding box of the points with each label.
+    std::vector<AxisAlignedBoundingBox> axis_aligned_bounding_boxes_;
+    /// Oriented bounding box of the points with each label, along their
+    /// principal axes (OrientedBoundingBox::CreationMethod::PCA).
+    std::vector<OrientedBoundingBox> oriented_bounding_boxes_;
+};
+
 /// \class PointCloud
 ///
 /// \brief A point cloud consists of point coordinates, and optionally point
@@ -240,7 +260,23 @@ public:
     /// \p target point cloud.
     ///
     /// \param target The target point cloud.
-    std::vector<double> ComputePointCloudDistance(const PointCloud &target);
+    /// \param max_distance If positive, the nearest neighbor search is bounded
+    /// by this distance, and larger distances are reported as max_distance.
+    std::vector<double> ComputePointCloudDistance(
+            const PointCloud &target, double max_distance = 0.0) const;
+
+    /// \brief Function to compute the point to mesh distances.
+    ///
+    /// For each point, compute the distance to the closest point on the
+    /// triangles of \p mesh. Triangles are organized in a bounding volume
+    /// hierarchy, and subtrees farther than the closest triangle found so far
+    /// are pruned.
+    ///
+    /// \param mesh The target triangle mesh.
+    /// \param max_distance If positive, the search is bounded by this
+    /// distance, and larger distances are reported as max_distance.
+    std::vector<double> ComputeTriangleMeshDistance(
+            const TriangleMesh &mesh, double max_distance = 0.0) const;
 
     /// Function to compute the mean and covariance matrix
     /// of a point cloud.
@@ -258,8 +294,11 @@ public:
     std::vector<double> ComputeNearestNeighborDistance() const;
 
     /// Function that computes the convex hull of the point cloud using qhull
+    ///
+    /// \param parallel Cull interior points and reduce partitions of the
+    /// points to their hull vertices in parallel, see Qhull::ComputeConvexHull.
     std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
-    ComputeConvexHull() const;
+    ComputeConvexHull(bool parallel = false) const;
 
     /// \brief This is an implementation of the Hidden Point Removal operator
     /// described in Katz et. al. 'Direct Visibility of Point Sets', 2007.
@@ -274,6 +313,36 @@ public:
     HiddenPointRemoval(const Eigen::Vector3d &camera_location,
                        const double radius) const;
 
+    /// \brief Hidden Point Removal from several viewpoints, which are
+    /// processed concurrently with one spherical projection buffer per
+    /// thread.
+    ///
+    /// \param camera_locations The viewpoints.
+    /// \param radius The radius of the spherical projection.
+    /// \return For each viewpoint, the sorted indices of the visible points.
+    std::vector<std::vector<size_t>> HiddenPointRemoval(
+            const std::vector<Eigen::Vector3d> &camera_locations,
+            const double radius) const;
+
+    /// \brief Approximate Hidden Point Removal with a z-buffer over a
+    /// spherical grid around each viewpoint, in linear time.
+    ///
+    /// A point is visible if its distance to the viewpoint is within
+    /// \p depth_tolerance (relative) of the closest point in its grid cell.
+    /// Cells should be large enough for the foreground surfaces to cover
+    /// them with points, otherwise points behind the gaps are visible. The
+    /// grid is reused across viewpoints.
+    ///
+    /// \param camera_locations The viewpoints.
+    /// \param resolution Number of elevation cells of the grid, which has
+    /// twice as many azimuth cells.
+    /// \param depth_tolerance Relative depth tolerance.
+    /// \return For each viewpoint, the sorted indices of the visible points.
+    std::vector<std::vector<size_t>> HiddenPointRemovalZBuffer(
+            const std::vector<Eigen::Vector3d> &camera_locations,
+            int resolution = 512,
+            double depth_tolerance = 0.05) const;
+
     /// \brief Cluster PointCloud using the DBSCAN algorithm
     /// Ester et al., "A Density-Based Algorithm for Discovering Clusters
     /// in Large Spatial Databases with Noise", 1996
@@ -289,6 +358,16 @@ public:
                                    size_t min_points,
                                    bool print_progress = false) const;
 
+    /// \brief Computes the count, centroid, covariance, axis aligned and
+    /// oriented bounding box of the points of each label in parallel,
+    /// without extracting the clusters.
+    ///
+    /// \param labels One label per point, e.g. from ClusterDBSCAN. Negative
+    /// labels (noise) are ignored.
+    /// \return Statistics for the labels from 0 to the largest label.
+    ClusterStatistics ComputeClusterStatistics(
+            const std::vector<int> &labels) const;
+
     /// \brief Segment PointCloud plane using the RANSAC algorithm.
     ///
     /// \param distance_threshold Max distance a point can be from the plane
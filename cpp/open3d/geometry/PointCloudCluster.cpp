@@ -25,11 +25,14 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <limits>
 #include <unordered_set>
 
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Eigen.h"
 
 namespace open3d {
 namespace geometry {
@@ -107,5 +110,157 @@ std::vector<int> PointCloud::ClusterDBSCAN(double eps,
     return labels;
 }
 
+namespace {
+
+/// Partial reduction over a range of points sharing a label.
+struct ClusterAccumulator {
+    ClusterAccumulator() {
+        min_bound_.setConstant(std::numeric_limits<double>::infinity());
+        max_bound_.setConstant(-std::numeric_limits<double>::infinity());
+    }
+
+    void Add(const Eigen::Vector3d &point) {
+        moments_.Add(point);
+        AddBound(point);
+    }
+
+    void AddBound(const Eigen::Vector3d &point) {
+        min_bound_ = min_bound_.cwiseMin(point);
+        max_bound_ = max_bound_.cwiseMax(point);
+    }
+
+    void Merge(const ClusterAccumulator &other) {
+        moments_.Merge(other.moments_);
+        min_bound_ = min_bound_.cwiseMin(other.min_bound_);
+        max_bound_ = max_bound_.cwiseMax(other.max_bound_);
+    }
+
+    utility::MeanAndCovarianceAccumulator moments_;
+    Eigen::Vector3d min_bound_;
+    Eigen::Vector3d max_bound_;
+};
+
+/// A range of the label sorted point order, belonging to a single label.
+struct ClusterRange {
+    size_t begin_;
+    size_t end_;
+};
+
+/// Reduces each range in parallel with \p add(accumulator, point_index), and
+/// merges the ranges of each label.
+template <typename Add>
+std::vector<ClusterAccumulator> ReduceClusterRanges(
+        const std::vector<size_t> &order,
+        const std::vector<ClusterRange> &ranges,
+        const std::vector<size_t> &label_ranges,
+        const Add &add) {
+    std::vector<ClusterAccumulator> partials(ranges.size());
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t r = 0; r < int64_t(ranges.size()); r++) {
+        for (size_t i = ranges[r].begin_; i < ranges[r].end_; i++) {
+            add(partials[r], order[i]);
+        }
+    }
+    const size_t num_labels = label_ranges.size() - 1;
+    std::vector<ClusterAccumulator> accumulators(num_labels);
+#pragma omp parallel for schedule(static)
+    for (int64_t l = 0; l < int64_t(num_labels); l++) {
+        for (size_t r = label_ranges[l]; r < label_ranges[l + 1]; r++) {
+            accumulators[l].Merge(partials[r]);
+        }
+    }
+    return accumulators;
+}
+
+}  // unnamed namespace
+
+ClusterStatistics PointCloud::ComputeClusterStatistics(
+        const std::vector<int> &labels) const {
+    if (labels.size() != points_.size()) {
+        utility::LogError(
+                "[ComputeClusterStatistics] Expected {} labels, but got {}.",
+                points_.size(), labels.size());
+    }
+    int max_label = -1;
+    for (int label : labels) {
+        max_label = std::max(max_label, label);
+    }
+    const size_t num_labels = size_t(max_label + 1);
+
+    // Counting sort of the labeled points, so that each label is a
+    // contiguous range of the order.
+    ClusterStatistics stats;
+    stats.counts_.resize(num_labels, 0);
+    for (int label : labels) {
+        if (label >= 0) stats.counts_[label]++;
+    }
+    std::vector<size_t> offsets(num_labels + 1, 0);
+    for (size_t l = 0; l < num_labels; l++) {
+        offsets[l + 1] = offsets[l] + stats.counts_[l];
+    }
+    std::vector<size_t> order(offsets.back());
+    {
+        std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+        for (size_t idx = 0; idx < labels.size(); idx++) {
+            if (labels[idx] >= 0) order[next[labels[idx]]++] = idx;
+        }
+    }
+
+    // Large clusters are split into several ranges to balance the threads.
+    const size_t kRangeSize = 4096;
+    std::vector<ClusterRange> ranges;
+    std::vector<size_t> label_ranges(num_labels + 1, 0);
+    for (size_t l = 0; l < num_labels; l++) {
+        for (size_t begin = offsets[l]; begin < offsets[l + 1];
+             begin += kRangeSize) {
+            ranges.push_back(
+                    {begin, std::min(begin + kRangeSize, offsets[l + 1])});
+        }
+        label_ranges[l + 1] = ranges.size();
+    }
+
+    std::vector<ClusterAccumulator> accumulators = ReduceClusterRanges(
+            order, ranges, label_ranges,
+            [&](ClusterAccumulator &acc, size_t idx) {
+                acc.Add(points_[idx]);
+            });
+
+    stats.centroids_.resize(num_labels, Eigen::Vector3d::Zero());
+    stats.covariances_.resize(num_labels, Eigen::Matrix3d::Zero());
+    stats.axis_aligned_bounding_boxes_.resize(num_labels);
+    stats.oriented_bounding_boxes_.resize(num_labels);
+#pragma omp parallel for schedule(static)
+    for (int64_t l = 0; l < int64_t(num_labels); l++) {
+        if (stats.counts_[l] == 0) continue;
+        std::tie(stats.centroids_[l], stats.covariances_[l]) =
+                accumulators[l].moments_.GetMeanAndCovariance();
+        stats.axis_aligned_bounding_boxes_[l] = AxisAlignedBoundingBox(
+                accumulators[l].min_bound_, accumulators[l].max_bound_);
+
+        stats.oriented_bounding_boxes_[l].R_ =
+                utility::ComputePrincipalAxes(stats.covariances_[l]);
+    }
+
+    // The oriented bounding box extents need the principal axes, so they
+    // are reduced in a second pass over the points.
+    accumulators = ReduceClusterRanges(
+            order, ranges, label_ranges,
+            [&](ClusterAccumulator &acc, size_t idx) {
+                const int l = labels[idx];
+                acc.AddBound(stats.oriented_bounding_boxes_[l].R_.transpose() *
+                             (points_[idx] - stats.centroids_[l]));
+            });
+#pragma omp parallel for schedule(static)
+    for (int64_t l = 0; l < int64_t(num_labels); l++) {
+        if (stats.counts_[l] == 0) continue;
+        OrientedBoundingBox &obox = stats.oriented_bounding_boxes_[l];
+        const ClusterAccumulator &acc = accumulators[l];
+        obox.center_ = obox.R_ * ((acc.min_bound_ + acc.max_bound_) * 0.5) +
+                       stats.centroids_[l];
+        obox.extent_ = acc.max_bound_ - acc.min_bound_;
+    }
+    return stats;
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -26,6 +26,10 @@
 
 #include "open3d/geometry/Qhull.h"
 
+#include <algorithm>
+#include <array>
+#include <numeric>
+
 #include "libqhullcpp/PointCoordinates.h"
 #include "libqhullcpp/Qhull.h"
 #include "libqhullcpp/QhullFacet.h"
@@ -38,30 +42,32 @@
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+// Eigen::Vector3d arrays are passed to Qhull as coordinate arrays without a
+// copy.
+static_assert(sizeof(Eigen::Vector3d) == 3 * sizeof(double),
+              "Eigen::Vector3d must be tightly packed.");
+
+/// Number of points per partition of the parallel convex hull. The
+/// partitioning does not depend on the number of threads, so that the
+/// result is deterministic.
+constexpr size_t kHullPartitionSize = 1 << 15;
+
+/// Runs Qhull ("Qt") on \p points and returns the hull with the indices into
+/// \p points of its vertices.
 std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
-Qhull::ComputeConvexHull(const std::vector<Eigen::Vector3d>& points) {
+RunConvexHull(const std::vector<Eigen::Vector3d>& points) {
     auto convex_hull = std::make_shared<TriangleMesh>();
     std::vector<size_t> pt_map;
 
-    std::vector<double> qhull_points_data(points.size() * 3);
-    for (size_t pidx = 0; pidx < points.size(); ++pidx) {
-        const auto& pt = points[pidx];
-        qhull_points_data[pidx * 3 + 0] = pt(0);
-        qhull_points_data[pidx * 3 + 1] = pt(1);
-        qhull_points_data[pidx * 3 + 2] = pt(2);
-    }
-
-    orgQhull::PointCoordinates qhull_points(3, "");
-    qhull_points.append(qhull_points_data);
-
     orgQhull::Qhull qhull;
-    qhull.runQhull(qhull_points.comment().c_str(), qhull_points.dimension(),
-                   qhull_points.count(), qhull_points.coordinates(), "Qt");
+    qhull.runQhull("", 3, int(points.size()),
+                   points.empty() ? nullptr : points[0].data(), "Qt");
 
     orgQhull::QhullFacetList facets = qhull.facetList();
     convex_hull->triangles_.resize(facets.count());
-    std::unordered_map<int, int> vert_map;
-    std::unordered_set<int> inserted_vertices;
+    std::vector<int> vert_map(points.size(), -1);
     int tidx = 0;
     for (orgQhull::QhullFacetList::iterator it = facets.begin();
          it != facets.end(); ++it) {
@@ -76,28 +82,189 @@ Qhull::ComputeConvexHull(const std::vector<Eigen::Vector3d>& points) {
             orgQhull::QhullPoint p = v.point();
 
             int vidx = p.id();
-            convex_hull->triangles_[tidx](triangle_subscript) = vidx;
-            triangle_subscript++;
-
-            if (inserted_vertices.count(vidx) == 0) {
-                inserted_vertices.insert(vidx);
+            if (vert_map[vidx] < 0) {
                 vert_map[vidx] = int(convex_hull->vertices_.size());
                 double* coords = p.coordinates();
                 convex_hull->vertices_.push_back(
                         Eigen::Vector3d(coords[0], coords[1], coords[2]));
                 pt_map.push_back(vidx);
             }
+            convex_hull->triangles_[tidx](triangle_subscript) = vert_map[vidx];
+            triangle_subscript++;
         }
 
         tidx++;
     }
+    convex_hull->triangles_.resize(tidx);
+
+    return std::make_tuple(convex_hull, pt_map);
+}
 
-    for (Eigen::Vector3i& triangle : convex_hull->triangles_) {
-        triangle(0) = vert_map[triangle(0)];
-        triangle(1) = vert_map[triangle(1)];
-        triangle(2) = vert_map[triangle(2)];
+/// Returns the indices of the points that are not strictly inside the
+/// polytope spanned by the extreme points along 13 directions (Akl-Toussaint
+/// heuristic), or all the indices if that polytope is degenerate.
+std::vector<size_t> CullInteriorPoints(
+        const std::vector<Eigen::Vector3d>& points) {
+    const std::array<Eigen::Vector3d, 13> directions = {
+            {{1, 0, 0},
+             {0, 1, 0},
+             {0, 0, 1},
+             {1, 1, 0},
+             {1, -1, 0},
+             {1, 0, 1},
+             {1, 0, -1},
+             {0, 1, 1},
+             {0, 1, -1},
+             {1, 1, 1},
+             {1, 1, -1},
+             {1, -1, 1},
+             {-1, 1, 1}}};
+    std::array<size_t, 26> extremes;
+    extremes.fill(0);
+#pragma omp parallel
+    {
+        std::array<size_t, 26> local;
+        local.fill(0);
+#pragma omp for schedule(static) nowait
+        for (int64_t pidx = 0; pidx < int64_t(points.size()); ++pidx) {
+            for (size_t d = 0; d < directions.size(); ++d) {
+                double proj = points[pidx].dot(directions[d]);
+                if (proj < points[local[2 * d]].dot(directions[d])) {
+                    local[2 * d] = pidx;
+                }
+                if (proj > points[local[2 * d + 1]].dot(directions[d])) {
+                    local[2 * d + 1] = pidx;
+                }
+            }
+        }
+#pragma omp critical
+        {
+            for (size_t d = 0; d < directions.size(); ++d) {
+                if (points[local[2 * d]].dot(directions[d]) <
+                    points[extremes[2 * d]].dot(directions[d])) {
+                    extremes[2 * d] = local[2 * d];
+                }
+                if (points[local[2 * d + 1]].dot(directions[d]) >
+                    points[extremes[2 * d + 1]].dot(directions[d])) {
+                    extremes[2 * d + 1] = local[2 * d + 1];
+                }
+            }
+        }
+    }
+
+    std::vector<size_t> all_indices(points.size());
+    std::iota(all_indices.begin(), all_indices.end(), 0);
+    std::sort(extremes.begin(), extremes.end());
+    std::vector<Eigen::Vector3d> extreme_points;
+    for (size_t i = 0; i < extremes.size(); ++i) {
+        if (i == 0 || extremes[i] != extremes[i - 1]) {
+            extreme_points.push_back(points[extremes[i]]);
+        }
+    }
+    std::shared_ptr<TriangleMesh> polytope;
+    try {
+        std::tie(polytope, std::ignore) = RunConvexHull(extreme_points);
+    } catch (...) {
+        return all_indices;
     }
 
+    // Outward facet planes, oriented with the centroid of the polytope.
+    Eigen::Vector3d centroid = Eigen::Vector3d::Zero();
+    for (const auto& vertex : polytope->vertices_) {
+        centroid += vertex;
+    }
+    centroid /= double(polytope->vertices_.size());
+    double radius = 0;
+    for (const auto& vertex : polytope->vertices_) {
+        radius = std::max(radius, (vertex - centroid).norm());
+    }
+    const double eps = 1e-12 * radius;
+    std::vector<Eigen::Vector4d> planes;
+    for (const auto& triangle : polytope->triangles_) {
+        const Eigen::Vector3d& v0 = polytope->vertices_[triangle(0)];
+        const Eigen::Vector3d& v1 = polytope->vertices_[triangle(1)];
+        const Eigen::Vector3d& v2 = polytope->vertices_[triangle(2)];
+        Eigen::Vector3d normal = (v1 - v0).cross(v2 - v0);
+        if (normal.norm() == 0) continue;
+        normal.normalize();
+        if (normal.dot(centroid - v0) > 0) normal = -normal;
+        planes.push_back(Eigen::Vector4d(normal(0), normal(1), normal(2),
+                                         -normal.dot(v0) + eps));
+    }
+
+    std::vector<uint8_t> keep(points.size());
+#pragma omp parallel for schedule(static)
+    for (int64_t pidx = 0; pidx < int64_t(points.size()); ++pidx) {
+        keep[pidx] = 0;
+        for (const auto& plane : planes) {
+            if (plane.head<3>().dot(points[pidx]) + plane(3) >= 0) {
+                keep[pidx] = 1;
+                break;
+            }
+        }
+    }
+    std::vector<size_t> indices;
+    for (size_t pidx = 0; pidx < points.size(); ++pidx) {
+        if (keep[pidx]) indices.push_back(pidx);
+    }
+    return indices;
+}
+
+}  // unnamed namespace
+
+std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
+Qhull::ComputeConvexHull(const std::vector<Eigen::Vector3d>& points,
+                         bool parallel) {
+    if (!parallel || points.size() <= kHullPartitionSize) {
+        return RunConvexHull(points);
+    }
+
+    // Only the points outside of a polytope inscribed in the hull are
+    // candidates, whose partitions are reduced to their hull vertices in
+    // parallel before the final hull.
+    std::vector<size_t> candidates = CullInteriorPoints(points);
+    const size_t num_partitions =
+            (candidates.size() + kHullPartitionSize - 1) / kHullPartitionSize;
+    std::vector<std::vector<size_t>> partition_vertices(num_partitions);
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t part = 0; part < int64_t(num_partitions); ++part) {
+        const size_t begin = part * kHullPartitionSize;
+        const size_t end =
+                std::min(begin + kHullPartitionSize, candidates.size());
+        std::vector<Eigen::Vector3d> part_points(end - begin);
+        for (size_t i = begin; i < end; ++i) {
+            part_points[i - begin] = points[candidates[i]];
+        }
+        std::vector<size_t> part_map;
+        try {
+            std::tie(std::ignore, part_map) = RunConvexHull(part_points);
+        } catch (...) {
+            // Degenerate partitions keep all their points.
+            part_map.resize(part_points.size());
+            std::iota(part_map.begin(), part_map.end(), 0);
+        }
+        for (size_t& idx : part_map) {
+            idx = candidates[begin + idx];
+        }
+        partition_vertices[part] = std::move(part_map);
+    }
+
+    std::vector<size_t> merged;
+    for (const auto& part_map : partition_vertices) {
+        merged.insert(merged.end(), part_map.begin(), part_map.end());
+    }
+    std::sort(merged.begin(), merged.end());
+    std::vector<Eigen::Vector3d> merged_points(merged.size());
+    for (size_t i = 0; i < merged.size(); ++i) {
+        merged_points[i] = points[merged[i]];
+    }
+
+    std::shared_ptr<TriangleMesh> convex_hull;
+    std::vector<size_t> pt_map;
+    std::tie(convex_hull, pt_map) = RunConvexHull(merged_points);
+    for (size_t& idx : pt_map) {
+        idx = merged[idx];
+    }
     return std::make_tuple(convex_hull, pt_map);
 }
 
@@ -139,8 +306,7 @@ Qhull::ComputeDelaunayTetrahedralization(
 
     orgQhull::QhullFacetList facets = qhull.facetList();
     delaunay_triangulation->tetras_.resize(facets.count());
-    std::unordered_map<int, int> vert_map;
-    std::unordered_set<int> inserted_vertices;
+    std::vector<int> vert_map(points.size(), -1);
     int tidx = 0;
     for (orgQhull::QhullFacetList::iterator it = facets.begin();
          it != facets.end(); ++it) {
@@ -155,28 +321,21 @@ Qhull::ComputeDelaunayTetrahedralization(
             orgQhull::QhullPoint p = v.point();
 
             int vidx = p.id();
-            delaunay_triangulation->tetras_[tidx](tetra_subscript) = vidx;
-            tetra_subscript++;
-
-            if (inserted_vertices.count(vidx) == 0) {
-                inserted_vertices.insert(vidx);
+            if (vert_map[vidx] < 0) {
                 vert_map[vidx] = int(delaunay_triangulation->vertices_.size());
                 double* coords = p.coordinates();
                 delaunay_triangulation->vertices_.push_back(
                         Eigen::Vector3d(coords[0], coords[1], coords[2]));
                 pt_map.push_back(vidx);
             }
+            delaunay_triangulation->tetras_[tidx](tetra_subscript) =
+                    vert_map[vidx];
+            tetra_subscript++;
         }
 
         tidx++;
     }
-
-    for (auto& tetra : delaunay_triangulation->tetras_) {
-        tetra(0) = vert_map[tetra(0)];
-        tetra(1) = vert_map[tetra(1)];
-        tetra(2) = vert_map[tetra(2)];
-        tetra(3) = vert_map[tetra(3)];
-    }
+    delaunay_triangulation->tetras_.resize(tidx);
 
     return std::make_tuple(delaunay_triangulation, pt_map);
 }
@@ -38,8 +38,14 @@ class TetraMesh;
 
 class Qhull {
 public:
+    /// Computes the convex hull of \p points and returns it with the indices
+    /// of its vertices in \p points. If \p parallel is true, points inside
+    /// the polytope of the extreme points along 13 directions are culled, and
+    /// fixed size partitions of the remaining points are reduced to their
+    /// hull vertices in parallel before computing the final hull.
     static std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
-    ComputeConvexHull(const std::vector<Eigen::Vector3d>& points);
+    ComputeConvexHull(const std::vector<Eigen::Vector3d>& points,
+                      bool parallel = false);
 
     static std::tuple<std::shared_ptr<TetraMesh>, std::vector<size_t>>
     ComputeDelaunayTetrahedralization(
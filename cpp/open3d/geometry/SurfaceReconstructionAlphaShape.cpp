@@ -24,9 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <limits>
 #include <list>
+#include <numeric>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/Qhull.h"
@@ -37,53 +43,25 @@
 namespace open3d {
 namespace geometry {
 
-std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
-        const PointCloud& pcd,
-        double alpha,
-        std::shared_ptr<TetraMesh> tetra_mesh,
-        std::vector<size_t>* pt_map) {
-    std::vector<size_t> pt_map_computed;
-    if (tetra_mesh == nullptr) {
-        utility::LogDebug(
-                "[CreateFromPointCloudAlphaShape] "
-                "ComputeDelaunayTetrahedralization");
-        std::tie(tetra_mesh, pt_map_computed) =
-                Qhull::ComputeDelaunayTetrahedralization(pcd.points_);
-        pt_map = &pt_map_computed;
-        utility::LogDebug(
-                "[CreateFromPointCloudAlphaShape] done "
-                "ComputeDelaunayTetrahedralization");
-    }
+namespace {
 
-    utility::LogDebug("[CreateFromPointCloudAlphaShape] init triangle mesh");
-    auto mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_ = tetra_mesh->vertices_;
-    if (pcd.HasNormals()) {
-        mesh->vertex_normals_.resize(mesh->vertices_.size());
-        for (size_t idx = 0; idx < (*pt_map).size(); ++idx) {
-            mesh->vertex_normals_[idx] = pcd.normals_[(*pt_map)[idx]];
-        }
-    }
-    if (pcd.HasColors()) {
-        mesh->vertex_colors_.resize(mesh->vertices_.size());
-        for (size_t idx = 0; idx < (*pt_map).size(); ++idx) {
-            mesh->vertex_colors_[idx] = pcd.colors_[(*pt_map)[idx]];
-        }
-    }
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done init triangle mesh");
+// Number of faces per chunk in the parallel boundary face extraction.
+constexpr int64_t kFaceChunkSize = 1 << 14;
 
-    std::vector<double> vsqn(tetra_mesh->vertices_.size());
-    for (size_t vidx = 0; vidx < vsqn.size(); ++vidx) {
-        vsqn[vidx] = tetra_mesh->vertices_[vidx].squaredNorm();
+// Computes the circumradius of each tetra in parallel.
+std::vector<double> ComputeTetraCircumradii(const TetraMesh& tetra_mesh) {
+    const auto& verts = tetra_mesh.vertices_;
+    std::vector<double> vsqn(verts.size());
+#pragma omp parallel for schedule(static)
+    for (int64_t vidx = 0; vidx < int64_t(vsqn.size()); ++vidx) {
+        vsqn[vidx] = verts[vidx].squaredNorm();
     }
 
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] add triangles from tetras that "
-            "satisfy constraint");
-    const auto& verts = tetra_mesh->vertices_;
-    for (size_t tidx = 0; tidx < tetra_mesh->tetras_.size(); ++tidx) {
-        const auto& tetra = tetra_mesh->tetras_[tidx];
+    std::vector<double> radii(tetra_mesh.tetras_.size());
+    std::atomic<bool> invalid_tetra{false};
+#pragma omp parallel for schedule(static)
+    for (int64_t tidx = 0; tidx < int64_t(radii.size()); ++tidx) {
+        const auto& tetra = tetra_mesh.tetras_[tidx];
         // clang-format off
         Eigen::Matrix4d tmp;
         tmp << verts[tetra(0)](0), verts[tetra(0)](1), verts[tetra(0)](2), 1,
@@ -113,13 +91,200 @@ std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
         double dz = tmp.determinant();
         // clang-format on
         if (a == 0) {
-            utility::LogError(
-                    "[CreateFromPointCloudAlphaShape] invalid tetra in "
-                    "TetraMesh");
+            invalid_tetra = true;
+            continue;
         }
-        double r = std::sqrt(dx * dx + dy * dy + dz * dz - 4 * a * c) /
-                   (2 * std::abs(a));
+        radii[tidx] = std::sqrt(dx * dx + dy * dy + dz * dz - 4 * a * c) /
+                      (2 * std::abs(a));
+    }
+    if (invalid_tetra) {
+        utility::LogError(
+                "[CreateFromPointCloudAlphaShape] invalid tetra in TetraMesh");
+    }
+    return radii;
+}
 
+// Initializes the alpha shape mesh with the vertices of the tetra mesh and
+// the normals and colors of the corresponding points.
+std::shared_ptr<TriangleMesh> InitAlphaShapeMesh(
+        const PointCloud& pcd,
+        const TetraMesh& tetra_mesh,
+        const std::vector<size_t>& pt_map) {
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = tetra_mesh.vertices_;
+    if (pcd.HasNormals()) {
+        mesh->vertex_normals_.resize(mesh->vertices_.size());
+        for (size_t idx = 0; idx < pt_map.size(); ++idx) {
+            mesh->vertex_normals_[idx] = pcd.normals_[pt_map[idx]];
+        }
+    }
+    if (pcd.HasColors()) {
+        mesh->vertex_colors_.resize(mesh->vertices_.size());
+        for (size_t idx = 0; idx < pt_map.size(); ++idx) {
+            mesh->vertex_colors_[idx] = pcd.colors_[pt_map[idx]];
+        }
+    }
+    return mesh;
+}
+
+bool TriangleLess(const Eigen::Vector3i& t0, const Eigen::Vector3i& t1) {
+    return std::tie(t0(0), t0(1), t0(2)) < std::tie(t1(0), t1(1), t1(2));
+}
+
+// A triangle of the tetrahedralization with the circumradius of one of its
+// incident tetras.
+struct TetraFace {
+    Eigen::Vector3i triangle_;
+    double radius_;
+};
+
+// A triangle of the tetrahedralization that is on the boundary of the alpha
+// shape for lower_ <= alpha < upper_, i.e., exactly one of its incident
+// tetras has a circumradius within alpha. upper_ is infinity for faces on the
+// convex hull, which stay on the boundary up to and including alpha = +inf.
+struct AlphaFace {
+    Eigen::Vector3i triangle_;
+    double lower_;
+    double upper_;
+
+    bool IsBoundary(double alpha) const {
+        return lower_ <= alpha &&
+               (alpha < upper_ ||
+                upper_ == std::numeric_limits<double>::infinity());
+    }
+};
+
+// Computes the alpha interval of all triangles that can be on the boundary of
+// an alpha shape, sorted by the lower end of the interval.
+std::vector<AlphaFace> ComputeAlphaFaces(const TetraMesh& tetra_mesh,
+                                         const std::vector<double>& radii) {
+    const int64_t n_tetras = int64_t(tetra_mesh.tetras_.size());
+    std::vector<TetraFace> tetra_faces(4 * n_tetras);
+#pragma omp parallel for schedule(static)
+    for (int64_t tidx = 0; tidx < n_tetras; ++tidx) {
+        const auto& tetra = tetra_mesh.tetras_[tidx];
+        TetraFace* faces = &tetra_faces[4 * tidx];
+        faces[0] = {TriangleMesh::GetOrderedTriangle(tetra(0), tetra(1),
+                                                     tetra(2)),
+                    radii[tidx]};
+        faces[1] = {TriangleMesh::GetOrderedTriangle(tetra(0), tetra(1),
+                                                     tetra(3)),
+                    radii[tidx]};
+        faces[2] = {TriangleMesh::GetOrderedTriangle(tetra(0), tetra(2),
+                                                     tetra(3)),
+                    radii[tidx]};
+        faces[3] = {TriangleMesh::GetOrderedTriangle(tetra(1), tetra(2),
+                                                     tetra(3)),
+                    radii[tidx]};
+    }
+    tbb::parallel_sort(tetra_faces.begin(), tetra_faces.end(),
+                       [](const TetraFace& f0, const TetraFace& f1) {
+                           if (f0.triangle_ != f1.triangle_) {
+                               return TriangleLess(f0.triangle_, f1.triangle_);
+                           }
+                           return f0.radius_ < f1.radius_;
+                       });
+
+    // Faces shared by two tetras are on the boundary between the two radii,
+    // faces on the convex hull from the radius of their tetra on.
+    std::vector<AlphaFace> alpha_faces;
+    for (size_t begin = 0; begin < tetra_faces.size();) {
+        size_t end = begin + 1;
+        while (end < tetra_faces.size() &&
+               tetra_faces[end].triangle_ == tetra_faces[begin].triangle_) {
+            end++;
+        }
+        double lower = tetra_faces[begin].radius_;
+        double upper = end - begin > 1
+                               ? tetra_faces[begin + 1].radius_
+                               : std::numeric_limits<double>::infinity();
+        if (lower < upper) {
+            alpha_faces.push_back({tetra_faces[begin].triangle_, lower, upper});
+        }
+        begin = end;
+    }
+    tbb::parallel_sort(alpha_faces.begin(), alpha_faces.end(),
+                       [](const AlphaFace& f0, const AlphaFace& f1) {
+                           if (f0.lower_ != f1.lower_) {
+                               return f0.lower_ < f1.lower_;
+                           }
+                           return TriangleLess(f0.triangle_, f1.triangle_);
+                       });
+    return alpha_faces;
+}
+
+// Extracts the boundary triangles for alpha in parallel chunks of the faces
+// whose alpha interval starts within alpha.
+std::vector<Eigen::Vector3i> ExtractAlphaFaces(
+        const std::vector<AlphaFace>& alpha_faces,
+        const std::vector<double>& lowers,
+        double alpha) {
+    const int64_t n_candidates = int64_t(
+            std::upper_bound(lowers.begin(), lowers.end(), alpha) -
+            lowers.begin());
+    const int64_t n_chunks =
+            (n_candidates + kFaceChunkSize - 1) / kFaceChunkSize;
+    std::vector<size_t> offsets(n_chunks + 1, 0);
+#pragma omp parallel for schedule(static)
+    for (int64_t chunk = 0; chunk < n_chunks; ++chunk) {
+        const int64_t end =
+                std::min(n_candidates, (chunk + 1) * kFaceChunkSize);
+        size_t count = 0;
+        for (int64_t fidx = chunk * kFaceChunkSize; fidx < end; ++fidx) {
+            count += alpha_faces[fidx].IsBoundary(alpha);
+        }
+        offsets[chunk + 1] = count;
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<Eigen::Vector3i> triangles(offsets.back());
+#pragma omp parallel for schedule(static)
+    for (int64_t chunk = 0; chunk < n_chunks; ++chunk) {
+        const int64_t end =
+                std::min(n_candidates, (chunk + 1) * kFaceChunkSize);
+        size_t out = offsets[chunk];
+        for (int64_t fidx = chunk * kFaceChunkSize; fidx < end; ++fidx) {
+            if (alpha_faces[fidx].IsBoundary(alpha)) {
+                triangles[out++] = alpha_faces[fidx].triangle_;
+            }
+        }
+    }
+    return triangles;
+}
+
+}  // unnamed namespace
+
+std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
+        const PointCloud& pcd,
+        double alpha,
+        std::shared_ptr<TetraMesh> tetra_mesh,
+        std::vector<size_t>* pt_map) {
+    std::vector<size_t> pt_map_computed;
+    if (tetra_mesh == nullptr) {
+        utility::LogDebug(
+                "[CreateFromPointCloudAlphaShape] "
+                "ComputeDelaunayTetrahedralization");
+        std::tie(tetra_mesh, pt_map_computed) =
+                Qhull::ComputeDelaunayTetrahedralization(pcd.points_);
+        pt_map = &pt_map_computed;
+        utility::LogDebug(
+                "[CreateFromPointCloudAlphaShape] done "
+                "ComputeDelaunayTetrahedralization");
+    }
+
+    utility::LogDebug("[CreateFromPointCloudAlphaShape] init triangle mesh");
+    auto mesh = InitAlphaShapeMesh(pcd, *tetra_mesh, *pt_map);
+    utility::LogDebug(
+            "[CreateFromPointCloudAlphaShape] done init triangle mesh");
+
+    std::vector<double> radii = ComputeTetraCircumradii(*tetra_mesh);
+
+    utility::LogDebug(
+            "[CreateFromPointCloudAlphaShape] add triangles from tetras that "
+            "satisfy constraint");
+    for (size_t tidx = 0; tidx < tetra_mesh->tetras_.size(); ++tidx) {
+        const auto& tetra = tetra_mesh->tetras_[tidx];
+        double r = radii[tidx];
         if (r <= alpha) {
             mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
                     tetra(0), tetra(1), tetra(2)));
@@ -175,5 +340,52 @@ std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
     return mesh;
 }
 
+std::vector<std::shared_ptr<TriangleMesh>>
+TriangleMesh::CreateFromPointCloudAlphaShape(
+        const PointCloud& pcd,
+        const std::vector<double>& alphas,
+        std::shared_ptr<TetraMesh> tetra_mesh,
+        std::vector<size_t>* pt_map) {
+    std::vector<size_t> pt_map_computed;
+    if (tetra_mesh == nullptr) {
+        utility::LogDebug(
+                "[CreateFromPointCloudAlphaShape] "
+                "ComputeDelaunayTetrahedralization");
+        std::tie(tetra_mesh, pt_map_computed) =
+                Qhull::ComputeDelaunayTetrahedralization(pcd.points_);
+        pt_map = &pt_map_computed;
+        utility::LogDebug(
+                "[CreateFromPointCloudAlphaShape] done "
+                "ComputeDelaunayTetrahedralization");
+    }
+
+    utility::LogDebug(
+            "[CreateFromPointCloudAlphaShape] compute alpha intervals of "
+            "faces");
+    std::vector<AlphaFace> alpha_faces = ComputeAlphaFaces(
+            *tetra_mesh, ComputeTetraCircumradii(*tetra_mesh));
+    std::vector<double> lowers(alpha_faces.size());
+    for (size_t fidx = 0; fidx < alpha_faces.size(); ++fidx) {
+        lowers[fidx] = alpha_faces[fidx].lower_;
+    }
+    utility::LogDebug(
+            "[CreateFromPointCloudAlphaShape] done compute alpha intervals of "
+            "faces");
+
+    auto base_mesh = InitAlphaShapeMesh(pcd, *tetra_mesh, *pt_map);
+    std::vector<std::shared_ptr<TriangleMesh>> meshes;
+    meshes.reserve(alphas.size());
+    for (double alpha : alphas) {
+        auto mesh = std::make_shared<TriangleMesh>();
+        mesh->vertices_ = base_mesh->vertices_;
+        mesh->vertex_normals_ = base_mesh->vertex_normals_;
+        mesh->vertex_colors_ = base_mesh->vertex_colors_;
+        mesh->triangles_ = ExtractAlphaFaces(alpha_faces, lowers, alpha);
+        mesh->RemoveUnreferencedVertices();
+        meshes.push_back(mesh);
+    }
+    return meshes;
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -534,6 +534,28 @@ public:
             std::shared_ptr<TetraMesh> tetra_mesh = nullptr,
             std::vector<size_t> *pt_map = nullptr);
 
+    /// \brief Alpha shapes for several alpha values from a single Delaunay
+    /// tetrahedralization. The circumradii of the tetras are computed once,
+    /// and every triangle gets the interval of alpha values for which exactly
+    /// one of its incident tetras is in the alpha complex. The triangles of
+    /// each alpha shape are then extracted in parallel from the triangles
+    /// sorted by the lower end of their interval. Each mesh equals the one of
+    /// CreateFromPointCloudAlphaShape for the same alpha, up to the order of
+    /// the triangles.
+    /// \param pcd PointCloud for what the alpha shapes should be computed.
+    /// \param alphas The alpha values, in any order.
+    /// \param tetra_mesh If not a nullptr, then uses this to construct the
+    /// alpha shapes. Otherwise, ComputeDelaunayTetrahedralization is called.
+    /// \param pt_map Optional map from tetra_mesh vertex indices to pcd
+    /// points.
+    /// \return A TriangleMesh per alpha value.
+    static std::vector<std::shared_ptr<TriangleMesh>>
+    CreateFromPointCloudAlphaShape(
+            const PointCloud &pcd,
+            const std::vector<double> &alphas,
+            std::shared_ptr<TetraMesh> tetra_mesh = nullptr,
+            std::vector<size_t> *pt_map = nullptr);
+
     /// Function that computes a triangle mesh from an oriented PointCloud \p
     /// pcd. This implements the Ball Pivoting algorithm proposed in F.
     /// Bernardini et al., "The ball-pivoting algorithm for surface
@@ -30,6 +30,7 @@
 
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 
@@ -66,6 +67,7 @@ std::shared_ptr<geometry::Image> CreateImageFromFile(
 }
 
 bool ReadImage(const std::string &filename, geometry::Image &image) {
+    OPEN3D_PROFILE_SCOPE("io::ReadImage");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -86,6 +88,7 @@ bool ReadImage(const std::string &filename, geometry::Image &image) {
 bool WriteImage(const std::string &filename,
                 const geometry::Image &image,
                 int quality /* = kOpen3DImageIODefaultQuality*/) {
+    OPEN3D_PROFILE_SCOPE("io::WriteImage");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -68,5 +68,22 @@ bool WritePinholeCameraTrajectoryToTUM(
         const std::string &filename,
         const camera::PinholeCameraTrajectory &trajectory);
 
+bool ReadPinholeCameraTrajectoryFromBIN(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory);
+
+/// Writes \p trajectory to the compact binary format, with a fixed size
+/// record of intrinsic and extrinsic parameters per camera.
+bool WritePinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory);
+
+/// Appends the cameras from \p begin of \p trajectory to a binary trajectory
+/// file, which is created if it does not exist.
+bool AppendPinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory,
+        size_t begin);
+
 }  // namespace io
 }  // namespace open3d
@@ -32,6 +32,7 @@
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Profiler.h"
 #include "open3d/utility/ProgressReporters.h"
 
 namespace open3d {
@@ -77,6 +78,7 @@ std::shared_ptr<geometry::PointCloud> CreatePointCloudFromFile(
 bool ReadPointCloud(const std::string &filename,
                     geometry::PointCloud &pointcloud,
                     const ReadPointCloudOption &params) {
+    OPEN3D_PROFILE_SCOPE("io::ReadPointCloud");
     std::string format = params.format;
     if (format == "auto") {
         format = utility::filesystem::GetFileExtensionInLowerCase(filename);
@@ -127,6 +129,7 @@ bool ReadPointCloud(const std::string &filename,
 bool WritePointCloud(const std::string &filename,
                      const geometry::PointCloud &pointcloud,
                      const WritePointCloudOption &params) {
+    OPEN3D_PROFILE_SCOPE("io::WritePointCloud");
     std::string format =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     auto map_itr = file_extension_to_pointcloud_write_function.find(format);
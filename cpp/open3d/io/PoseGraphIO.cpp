@@ -54,6 +54,7 @@ static const std::unordered_map<
                            pipelines::registration::PoseGraph &)>>
         file_extension_to_pose_graph_read_function{
                 {"json", ReadPoseGraphFromJSON},
+                {"bin", ReadPoseGraphFromBIN},
         };
 
 static const std::unordered_map<
@@ -62,6 +63,11 @@ static const std::unordered_map<
                            const pipelines::registration::PoseGraph &)>>
         file_extension_to_pose_graph_write_function{
                 {"json", WritePoseGraphToJSON},
+                {"bin",
+                 [](const std::string &filename,
+                    const pipelines::registration::PoseGraph &pose_graph) {
+                     return WritePoseGraphToBIN(filename, pose_graph);
+                 }},
         };
 
 }  // unnamed namespace
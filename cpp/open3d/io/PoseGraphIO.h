@@ -51,5 +51,24 @@ bool ReadPoseGraph(const std::string &filename,
 bool WritePoseGraph(const std::string &filename,
                     const pipelines::registration::PoseGraph &pose_graph);
 
+bool ReadPoseGraphFromBIN(const std::string &filename,
+                          pipelines::registration::PoseGraph &pose_graph);
+
+/// Writes \p pose_graph to the compact binary format, with fixed size
+/// records for nodes and edges. Information matrices are stored as their
+/// upper triangle, in float32 if \p float32_information is true.
+bool WritePoseGraphToBIN(const std::string &filename,
+                         const pipelines::registration::PoseGraph &pose_graph,
+                         bool float32_information = false);
+
+/// Appends nodes from \p node_begin and edges from \p edge_begin of
+/// \p pose_graph to a binary pose graph file, which is created if it does not
+/// exist. Used to checkpoint a growing pose graph without rewriting it.
+bool AppendPoseGraphToBIN(const std::string &filename,
+                          const pipelines::registration::PoseGraph &pose_graph,
+                          size_t node_begin,
+                          size_t edge_begin,
+                          bool float32_information = false);
+
 }  // namespace io
 }  // namespace open3d
@@ -30,6 +30,7 @@
 
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 
@@ -42,7 +43,7 @@ static const std::unordered_map<
                 const std::string &, geometry::TriangleMesh &, bool, bool)>>
         file_extension_to_trianglemesh_read_function{
                 {"ply", ReadTriangleMeshFromPLY},
-                {"stl", ReadTriangleMeshUsingASSIMP},
+                {"stl", ReadTriangleMeshFromSTL},
                 {"obj", ReadTriangleMeshUsingASSIMP},
                 {"off", ReadTriangleMeshFromOFF},
                 {"gltf", ReadTriangleMeshUsingASSIMP},
@@ -84,6 +85,7 @@ bool ReadTriangleMesh(const std::string &filename,
                       geometry::TriangleMesh &mesh,
                       bool enable_post_processing /* = false */,
                       bool print_progress /* = false */) {
+    OPEN3D_PROFILE_SCOPE("io::ReadTriangleMesh");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -121,6 +123,7 @@ bool WriteTriangleMesh(const std::string &filename,
                        bool write_vertex_colors /* = true*/,
                        bool write_triangle_uvs /* = true*/,
                        bool print_progress /* = false*/) {
+    OPEN3D_PROFILE_SCOPE("io::WriteTriangleMesh");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -77,6 +77,16 @@ bool WriteTriangleMeshToPLY(const std::string &filename,
                             bool write_triangle_uvs,
                             bool print_progress);
 
+/// Reads binary or ASCII STL files. Each facet has its own three vertices
+/// with the facet normal, unless \p enable_post_processing is true, in which
+/// case vertices with identical coordinates are welded and only triangle
+/// normals are kept. Welding compares the float32 coordinates exactly, without
+/// any tolerance, so nearly coincident vertices are kept apart.
+bool ReadTriangleMeshFromSTL(const std::string &filename,
+                             geometry::TriangleMesh &mesh,
+                             bool enable_post_processing,
+                             bool print_progress);
+
 bool WriteTriangleMeshToSTL(const std::string &filename,
                             const geometry::TriangleMesh &mesh,
                             bool write_ascii,
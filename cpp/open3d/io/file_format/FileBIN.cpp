@@ -24,10 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <memory>
+#include <vector>
 
 #include "open3d/io/FeatureIO.h"
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/io/PoseGraphIO.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 
@@ -72,6 +77,290 @@ bool WriteMatrixXdToBINFile(FILE *file, const Eigen::MatrixXd &mat) {
     return true;
 }
 
+// Binary pose graph and trajectory files start with an 8 byte magic and a
+// uint32 version, followed by any number of blocks. A block is a uint32
+// record type, a uint32 record count and the fixed size records. Files are
+// streamed in blocks of bounded size, and appending to a file only adds
+// blocks at its end.
+constexpr char kPoseGraphMagic[8] = {'O', '3', 'D', 'P', 'G', 'R', 'P', 'H'};
+constexpr char kTrajectoryMagic[8] = {'O', '3', 'D', 'T', 'R', 'A', 'J', 'T'};
+constexpr uint32_t kBINVersion = 1;
+constexpr size_t kBINBlockRecords = 4096;
+
+enum BINRecordType : uint32_t {
+    kPoseGraphNode = 1,
+    kPoseGraphEdge = 2,
+    kPoseGraphEdgeFloat32 = 3,
+    kPinholeCameraParameters = 4,
+};
+
+// Node: pose (16 doubles, column major).
+constexpr size_t kNodeRecordSize = 16 * sizeof(double);
+// Edge: source and target ids (int32), confidence (double), uncertain
+// (uint32), reserved (uint32), transformation (16 doubles, column major) and
+// the upper triangle of the symmetric information matrix (21 scalars).
+template <typename scalar_t>
+constexpr size_t EdgeRecordSize() {
+    return 2 * sizeof(int32_t) + sizeof(double) + 2 * sizeof(uint32_t) +
+           16 * sizeof(double) + 21 * sizeof(scalar_t);
+}
+// Camera parameters: width and height (int32), intrinsic matrix (9 doubles)
+// and extrinsic matrix (16 doubles), both column major.
+constexpr size_t kCameraRecordSize =
+        2 * sizeof(int32_t) + 9 * sizeof(double) + 16 * sizeof(double);
+
+template <typename T>
+void Put(uint8_t *&ptr, const T &value) {
+    std::memcpy(ptr, &value, sizeof(T));
+    ptr += sizeof(T);
+}
+
+template <typename T>
+T Get(const uint8_t *&ptr) {
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    ptr += sizeof(T);
+    return value;
+}
+
+void EncodeNode(const pipelines::registration::PoseGraphNode &node,
+                uint8_t *ptr) {
+    std::memcpy(ptr, node.pose_.data(), kNodeRecordSize);
+}
+
+void DecodeNode(const uint8_t *ptr,
+                pipelines::registration::PoseGraphNode &node) {
+    std::memcpy(node.pose_.data(), ptr, kNodeRecordSize);
+}
+
+template <typename scalar_t>
+void EncodeEdge(const pipelines::registration::PoseGraphEdge &edge,
+                uint8_t *ptr) {
+    Put<int32_t>(ptr, edge.source_node_id_);
+    Put<int32_t>(ptr, edge.target_node_id_);
+    Put<double>(ptr, edge.confidence_);
+    Put<uint32_t>(ptr, edge.uncertain_ ? 1 : 0);
+    Put<uint32_t>(ptr, 0);
+    std::memcpy(ptr, edge.transformation_.data(), 16 * sizeof(double));
+    ptr += 16 * sizeof(double);
+    for (int i = 0; i < 6; i++) {
+        for (int j = i; j < 6; j++) {
+            Put<scalar_t>(ptr, scalar_t(edge.information_(i, j)));
+        }
+    }
+}
+
+template <typename scalar_t>
+void DecodeEdge(const uint8_t *ptr,
+                pipelines::registration::PoseGraphEdge &edge) {
+    edge.source_node_id_ = Get<int32_t>(ptr);
+    edge.target_node_id_ = Get<int32_t>(ptr);
+    edge.confidence_ = Get<double>(ptr);
+    edge.uncertain_ = Get<uint32_t>(ptr) != 0;
+    Get<uint32_t>(ptr);
+    std::memcpy(edge.transformation_.data(), ptr, 16 * sizeof(double));
+    ptr += 16 * sizeof(double);
+    for (int i = 0; i < 6; i++) {
+        for (int j = i; j < 6; j++) {
+            edge.information_(i, j) = edge.information_(j, i) =
+                    double(Get<scalar_t>(ptr));
+        }
+    }
+}
+
+void EncodeCameraParameters(const camera::PinholeCameraParameters &parameters,
+                            uint8_t *ptr) {
+    Put<int32_t>(ptr, parameters.intrinsic_.width_);
+    Put<int32_t>(ptr, parameters.intrinsic_.height_);
+    std::memcpy(ptr, parameters.intrinsic_.intrinsic_matrix_.data(),
+                9 * sizeof(double));
+    ptr += 9 * sizeof(double);
+    std::memcpy(ptr, parameters.extrinsic_.data(), 16 * sizeof(double));
+}
+
+void DecodeCameraParameters(const uint8_t *ptr,
+                            camera::PinholeCameraParameters &parameters) {
+    parameters.intrinsic_.width_ = Get<int32_t>(ptr);
+    parameters.intrinsic_.height_ = Get<int32_t>(ptr);
+    std::memcpy(parameters.intrinsic_.intrinsic_matrix_.data(), ptr,
+                9 * sizeof(double));
+    ptr += 9 * sizeof(double);
+    std::memcpy(parameters.extrinsic_.data(), ptr, 16 * sizeof(double));
+}
+
+/// Writes records [begin, end) in blocks of kBINBlockRecords. encode(i, ptr)
+/// writes record i to ptr.
+template <typename Encode>
+bool WriteBINBlocks(FILE *file,
+                    uint32_t type,
+                    size_t record_size,
+                    size_t begin,
+                    size_t end,
+                    Encode encode) {
+    std::vector<uint8_t> buffer;
+    for (size_t block_begin = begin; block_begin < end;
+         block_begin += kBINBlockRecords) {
+        const uint32_t count =
+                (uint32_t)std::min(kBINBlockRecords, end - block_begin);
+        buffer.resize(count * record_size);
+        for (uint32_t k = 0; k < count; k++) {
+            encode(block_begin + k, buffer.data() + k * record_size);
+        }
+        if (fwrite(&type, sizeof(uint32_t), 1, file) < 1 ||
+            fwrite(&count, sizeof(uint32_t), 1, file) < 1 ||
+            fwrite(buffer.data(), record_size, count, file) < count) {
+            utility::LogWarning("Write BIN failed: unexpected error.");
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Reads blocks until the end of the file. decode(type, count, ptr) decodes
+/// count records of the given type from ptr, and returns false for unknown
+/// record types. record_size(type) returns 0 for unknown record types.
+/// A truncated trailing block, e.g. left by an interrupted append, is skipped
+/// with a warning and the complete blocks before it are kept. A count that no
+/// writer produces fails the read instead of dropping the rest of the file.
+template <typename RecordSize, typename Decode>
+bool ReadBINBlocks(FILE *file, RecordSize record_size, Decode decode) {
+    const long position = ftell(file);
+    fseek(file, 0, SEEK_END);
+    size_t remaining = size_t(ftell(file) - position);
+    fseek(file, position, SEEK_SET);
+
+    std::vector<uint8_t> buffer;
+    uint32_t type, count;
+    while (fread(&type, sizeof(uint32_t), 1, file) == 1) {
+        remaining -= sizeof(uint32_t);
+        if (fread(&count, sizeof(uint32_t), 1, file) < 1) {
+            utility::LogWarning(
+                    "Read BIN: ignoring truncated block at end of file.");
+            return true;
+        }
+        remaining -= sizeof(uint32_t);
+        const size_t size = record_size(type);
+        if (size == 0) {
+            utility::LogWarning("Read BIN failed: unknown record type {}.",
+                                type);
+            return false;
+        }
+        // Check the count before allocating, so that a partially written or
+        // corrupted count cannot trigger a huge buffer. Blocks hold at most
+        // kBINBlockRecords records, so only a block within the last
+        // kBINBlockRecords records of the file can be a truncated append.
+        if (count > kBINBlockRecords) {
+            utility::LogWarning("Read BIN failed: invalid block of {} records.",
+                                count);
+            return false;
+        }
+        if (size_t(count) > remaining / size) {
+            utility::LogWarning(
+                    "Read BIN: ignoring truncated block of {} records at end "
+                    "of file.",
+                    count);
+            return true;
+        }
+        buffer.resize(count * size);
+        if (fread(buffer.data(), size, count, file) < count) {
+            utility::LogWarning("Read BIN failed: unexpected EOF.");
+            return false;
+        }
+        remaining -= count * size;
+        decode(type, count, buffer.data());
+    }
+    return true;
+}
+
+bool WriteBINHeader(FILE *file, const char *magic) {
+    if (fwrite(magic, 1, 8, file) < 8 ||
+        fwrite(&kBINVersion, sizeof(uint32_t), 1, file) < 1) {
+        utility::LogWarning("Write BIN failed: unexpected error.");
+        return false;
+    }
+    return true;
+}
+
+bool ReadBINHeader(FILE *file, const char *magic) {
+    char file_magic[8];
+    uint32_t version;
+    if (fread(file_magic, 1, 8, file) < 8 ||
+        fread(&version, sizeof(uint32_t), 1, file) < 1) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+        return false;
+    }
+    if (std::memcmp(file_magic, magic, 8) != 0) {
+        utility::LogWarning("Read BIN failed: unexpected file type.");
+        return false;
+    }
+    if (version != kBINVersion) {
+        utility::LogWarning("Read BIN failed: unsupported version {}.",
+                            version);
+        return false;
+    }
+    return true;
+}
+
+/// Opens \p filename to append blocks. A header is written to new or empty
+/// files, and the header of existing files is validated.
+FILE *OpenBINForAppend(const std::string &filename, const char *magic) {
+    bool has_header = false;
+    if (utility::filesystem::FileExists(filename)) {
+        FILE *fid = utility::filesystem::FOpen(filename, "rb");
+        if (fid == NULL) {
+            utility::LogWarning("Write BIN failed: unable to open file: {}",
+                                filename);
+            return NULL;
+        }
+        fseek(fid, 0, SEEK_END);
+        has_header = ftell(fid) > 0;
+        fseek(fid, 0, SEEK_SET);
+        bool valid = !has_header || ReadBINHeader(fid, magic);
+        fclose(fid);
+        if (!valid) {
+            return NULL;
+        }
+    }
+    FILE *fid = utility::filesystem::FOpen(filename, "ab");
+    if (fid == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
+                            filename);
+        return NULL;
+    }
+    if (!has_header && !WriteBINHeader(fid, magic)) {
+        fclose(fid);
+        return NULL;
+    }
+    return fid;
+}
+
+bool WritePoseGraphBlocks(FILE *fid,
+                          const pipelines::registration::PoseGraph &pose_graph,
+                          size_t node_begin,
+                          size_t edge_begin,
+                          bool float32_information) {
+    const auto &nodes = pose_graph.nodes_;
+    const auto &edges = pose_graph.edges_;
+    if (!WriteBINBlocks(fid, kPoseGraphNode, kNodeRecordSize, node_begin,
+                        nodes.size(), [&](size_t i, uint8_t *ptr) {
+                            EncodeNode(nodes[i], ptr);
+                        })) {
+        return false;
+    }
+    if (float32_information) {
+        return WriteBINBlocks(fid, kPoseGraphEdgeFloat32,
+                              EdgeRecordSize<float>(), edge_begin,
+                              edges.size(), [&](size_t i, uint8_t *ptr) {
+                                  EncodeEdge<float>(edges[i], ptr);
+                              });
+    }
+    return WriteBINBlocks(fid, kPoseGraphEdge, EdgeRecordSize<double>(),
+                          edge_begin, edges.size(),
+                          [&](size_t i, uint8_t *ptr) {
+                              EncodeEdge<double>(edges[i], ptr);
+                          });
+}
+
 }  // unnamed namespace
 
 namespace io {
@@ -102,5 +391,151 @@ bool WriteFeatureToBIN(const std::string &filename,
     return success;
 }
 
+bool ReadPoseGraphFromBIN(const std::string &filename,
+                          pipelines::registration::PoseGraph &pose_graph) {
+    FILE *fid = utility::filesystem::FOpen(filename, "rb");
+    if (fid == NULL) {
+        utility::LogWarning("Read BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    pose_graph.nodes_.clear();
+    pose_graph.edges_.clear();
+    auto record_size = [](uint32_t type) -> size_t {
+        switch (type) {
+            case kPoseGraphNode:
+                return kNodeRecordSize;
+            case kPoseGraphEdge:
+                return EdgeRecordSize<double>();
+            case kPoseGraphEdgeFloat32:
+                return EdgeRecordSize<float>();
+            default:
+                return 0;
+        }
+    };
+    auto decode = [&](uint32_t type, uint32_t count, const uint8_t *ptr) {
+        const size_t size = record_size(type);
+        if (type == kPoseGraphNode) {
+            size_t offset = pose_graph.nodes_.size();
+            pose_graph.nodes_.resize(offset + count);
+            for (uint32_t k = 0; k < count; k++) {
+                DecodeNode(ptr + k * size, pose_graph.nodes_[offset + k]);
+            }
+        } else {
+            size_t offset = pose_graph.edges_.size();
+            pose_graph.edges_.resize(offset + count);
+            for (uint32_t k = 0; k < count; k++) {
+                if (type == kPoseGraphEdge) {
+                    DecodeEdge<double>(ptr + k * size,
+                                       pose_graph.edges_[offset + k]);
+                } else {
+                    DecodeEdge<float>(ptr + k * size,
+                                      pose_graph.edges_[offset + k]);
+                }
+            }
+        }
+    };
+    bool success = ReadBINHeader(fid, kPoseGraphMagic) &&
+                   ReadBINBlocks(fid, record_size, decode);
+    fclose(fid);
+    return success;
+}
+
+bool WritePoseGraphToBIN(const std::string &filename,
+                         const pipelines::registration::PoseGraph &pose_graph,
+                         bool float32_information /* = false*/) {
+    FILE *fid = utility::filesystem::FOpen(filename, "wb");
+    if (fid == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success = WriteBINHeader(fid, kPoseGraphMagic) &&
+                   WritePoseGraphBlocks(fid, pose_graph, 0, 0,
+                                        float32_information);
+    fclose(fid);
+    return success;
+}
+
+bool AppendPoseGraphToBIN(const std::string &filename,
+                          const pipelines::registration::PoseGraph &pose_graph,
+                          size_t node_begin,
+                          size_t edge_begin,
+                          bool float32_information /* = false*/) {
+    FILE *fid = OpenBINForAppend(filename, kPoseGraphMagic);
+    if (fid == NULL) {
+        return false;
+    }
+    bool success = WritePoseGraphBlocks(fid, pose_graph, node_begin,
+                                        edge_begin, float32_information);
+    fclose(fid);
+    return success;
+}
+
+bool ReadPinholeCameraTrajectoryFromBIN(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory) {
+    FILE *fid = utility::filesystem::FOpen(filename, "rb");
+    if (fid == NULL) {
+        utility::LogWarning("Read BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    trajectory.parameters_.clear();
+    auto record_size = [](uint32_t type) -> size_t {
+        return type == kPinholeCameraParameters ? kCameraRecordSize : 0;
+    };
+    auto decode = [&](uint32_t type, uint32_t count, const uint8_t *ptr) {
+        size_t offset = trajectory.parameters_.size();
+        trajectory.parameters_.resize(offset + count);
+        for (uint32_t k = 0; k < count; k++) {
+            DecodeCameraParameters(ptr + k * kCameraRecordSize,
+                                   trajectory.parameters_[offset + k]);
+        }
+    };
+    bool success = ReadBINHeader(fid, kTrajectoryMagic) &&
+                   ReadBINBlocks(fid, record_size, decode);
+    fclose(fid);
+    return success;
+}
+
+bool WritePinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory) {
+    FILE *fid = utility::filesystem::FOpen(filename, "wb");
+    if (fid == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    const auto &parameters = trajectory.parameters_;
+    bool success =
+            WriteBINHeader(fid, kTrajectoryMagic) &&
+            WriteBINBlocks(fid, kPinholeCameraParameters, kCameraRecordSize, 0,
+                           parameters.size(), [&](size_t i, uint8_t *ptr) {
+                               EncodeCameraParameters(parameters[i], ptr);
+                           });
+    fclose(fid);
+    return success;
+}
+
+bool AppendPinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory,
+        size_t begin) {
+    FILE *fid = OpenBINForAppend(filename, kTrajectoryMagic);
+    if (fid == NULL) {
+        return false;
+    }
+    const auto &parameters = trajectory.parameters_;
+    bool success = WriteBINBlocks(
+            fid, kPinholeCameraParameters, kCameraRecordSize, begin,
+            parameters.size(), [&](size_t i, uint8_t *ptr) {
+                EncodeCameraParameters(parameters[i], ptr);
+            });
+    fclose(fid);
+    return success;
+}
+
 }  // namespace io
 }  // namespace open3d
@@ -24,7 +24,14 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
-#include <fstream>
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <tuple>
 #include <vector>
 
 #include "open3d/io/FileFormatIO.h"
@@ -33,12 +40,243 @@
 #include "open3d/utility/FileSystem.h"
 
 namespace open3d {
+
+namespace {
+
+// Binary STL: 80 byte header, uint32 triangle count, then for each triangle
+// the normal and the three vertices as float32 and a uint16 attribute.
+constexpr size_t kSTLHeaderSize = 84;
+constexpr size_t kSTLRecordSize = 50;
+// Triangles are formatted and written in blocks of this size.
+constexpr int64_t kSTLBlockSize = 16384;
+
+/// Facets read from an STL file, with 3 unwelded vertices per triangle.
+struct STLData {
+    std::vector<Eigen::Vector3f> normals;
+    std::vector<Eigen::Vector3f> vertices;
+};
+
+uint32_t BinarySTLTriangleCount(const std::vector<char> &buffer) {
+    uint32_t num_triangles;
+    std::memcpy(&num_triangles, buffer.data() + 80, sizeof(uint32_t));
+    return num_triangles;
+}
+
+/// Some exporters pad binary files after the last record, so the file only
+/// has to be large enough for the triangle count of its header.
+bool IsBinarySTL(const std::vector<char> &buffer) {
+    if (buffer.size() < kSTLHeaderSize) return false;
+    const uint64_t num_triangles = BinarySTLTriangleCount(buffer);
+    return buffer.size() >= kSTLHeaderSize + kSTLRecordSize * num_triangles;
+}
+
+void ParseBinarySTL(const std::vector<char> &buffer, STLData &data) {
+    const int64_t num_triangles = int64_t(BinarySTLTriangleCount(buffer));
+    data.normals.resize(num_triangles);
+    data.vertices.resize(3 * num_triangles);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_triangles; i++) {
+        const char *record =
+                buffer.data() + kSTLHeaderSize + kSTLRecordSize * i;
+        std::memcpy(data.normals[i].data(), record, 12);
+        for (int j = 0; j < 3; j++) {
+            std::memcpy(data.vertices[3 * i + j].data(), record + 12 * (j + 1),
+                        12);
+        }
+    }
+}
+
+/// Parses the facets of all solids of an ASCII STL file.
+bool ParseASCIISTL(std::vector<char> &buffer, STLData &data) {
+    buffer.push_back('\0');
+    size_t facet_begin = 0;
+    Eigen::Vector3f normal = Eigen::Vector3f::Zero();
+    const char *p = buffer.data();
+    const char *delimiters = " \t\r\n";
+    while (true) {
+        p += std::strspn(p, delimiters);
+        if (*p == '\0') break;
+        const size_t length = std::strcspn(p, delimiters);
+        const char *token = p;
+        p += length;
+        auto is_token = [&](const char *keyword) {
+            return length == std::strlen(keyword) &&
+                   std::strncmp(token, keyword, length) == 0;
+        };
+        if (is_token("normal") || is_token("vertex")) {
+            Eigen::Vector3f values;
+            for (int k = 0; k < 3; k++) {
+                char *next;
+                values(k) = std::strtof(p, &next);
+                if (next == p) {
+                    utility::LogWarning(
+                            "Read STL failed: expected 3 coordinates.");
+                    return false;
+                }
+                p = next;
+            }
+            if (token[0] == 'n') {
+                normal = values;
+            } else {
+                data.vertices.push_back(values);
+            }
+        } else if (is_token("facet")) {
+            facet_begin = data.vertices.size();
+            normal.setZero();
+        } else if (is_token("endfacet")) {
+            if (data.vertices.size() != facet_begin + 3) {
+                utility::LogWarning(
+                        "Read STL failed: facet with number of vertices not "
+                        "equal to 3.");
+                return false;
+            }
+            data.normals.push_back(normal);
+        }
+    }
+    if (data.vertices.size() != 3 * data.normals.size()) {
+        utility::LogWarning("Read STL failed: unexpected end of file.");
+        return false;
+    }
+    return true;
+}
+
+/// Key of a vertex for welding. Positions are compared by their float32 bit
+/// patterns, so that only vertices stored with identical coordinates are
+/// welded.
+struct STLWeldKey {
+    uint32_t x;
+    uint32_t y;
+    uint32_t z;
+    int64_t index;
+
+    bool operator<(const STLWeldKey &other) const {
+        return std::tie(x, y, z, index) <
+               std::tie(other.x, other.y, other.z, other.index);
+    }
+    bool SamePosition(const STLWeldKey &other) const {
+        return x == other.x && y == other.y && z == other.z;
+    }
+};
+
+inline uint32_t FloatKey(float value) {
+    // +0 and -0 have the same position.
+    if (value == 0.0f) value = 0.0f;
+    uint32_t key;
+    std::memcpy(&key, &value, sizeof(uint32_t));
+    return key;
+}
+
+/// Welds identical vertices. Keys are sorted in parallel, and vertices keep
+/// the order of their first occurrence in the file.
+void WeldSTLVertices(const STLData &data, geometry::TriangleMesh &mesh) {
+    const int64_t num_corners = int64_t(data.vertices.size());
+    std::vector<STLWeldKey> keys(num_corners);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_corners; i++) {
+        const Eigen::Vector3f &v = data.vertices[i];
+        keys[i] = {FloatKey(v(0)), FloatKey(v(1)), FloatKey(v(2)), i};
+    }
+    tbb::parallel_sort(keys.begin(), keys.end());
+
+    // The first corner of each group of identical keys is its
+    // representative.
+    std::vector<int64_t> representatives(num_corners);
+    int64_t representative = 0;
+    for (int64_t i = 0; i < num_corners; i++) {
+        if (i == 0 || !keys[i].SamePosition(keys[i - 1])) {
+            representative = keys[i].index;
+        }
+        representatives[keys[i].index] = representative;
+    }
+    std::vector<int> corner_vertices(num_corners);
+    int num_vertices = 0;
+    for (int64_t i = 0; i < num_corners; i++) {
+        corner_vertices[i] = representatives[i] == i
+                                     ? num_vertices++
+                                     : corner_vertices[representatives[i]];
+    }
+
+    mesh.vertices_.resize(num_vertices);
+    mesh.triangles_.resize(num_corners / 3);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_corners; i++) {
+        if (representatives[i] == i) {
+            mesh.vertices_[corner_vertices[i]] =
+                    data.vertices[i].cast<double>();
+        }
+        mesh.triangles_[i / 3](i % 3) = corner_vertices[i];
+    }
+}
+
+}  // unnamed namespace
+
 namespace io {
 
 FileGeometry ReadFileGeometryTypeSTL(const std::string &path) {
     return FileGeometry(CONTAINS_TRIANGLES | CONTAINS_POINTS);
 }
 
+bool ReadTriangleMeshFromSTL(const std::string &filename,
+                             geometry::TriangleMesh &mesh,
+                             bool enable_post_processing,
+                             bool print_progress) {
+    std::vector<char> buffer;
+    {
+        utility::filesystem::CFile file;
+        if (!file.Open(filename, "rb")) {
+            utility::LogWarning("Read STL failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        buffer.resize(size_t(file.GetFileSize()));
+        if (file.ReadData(buffer.data(), buffer.size()) != buffer.size()) {
+            utility::LogWarning("Read STL failed: unable to read file: {}",
+                                filename);
+            return false;
+        }
+    }
+
+    STLData data;
+    if (IsBinarySTL(buffer)) {
+        ParseBinarySTL(buffer, data);
+    } else if (buffer.size() >= 5 &&
+               std::strncmp(buffer.data(), "solid", 5) == 0) {
+        if (!ParseASCIISTL(buffer, data)) {
+            return false;
+        }
+    } else {
+        utility::LogWarning("Read STL failed: unknown file format.");
+        return false;
+    }
+
+    mesh.Clear();
+    const int64_t num_triangles = int64_t(data.normals.size());
+    mesh.triangle_normals_.resize(num_triangles);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_triangles; i++) {
+        mesh.triangle_normals_[i] = data.normals[i].cast<double>();
+    }
+    if (enable_post_processing) {
+        WeldSTLVertices(data, mesh);
+    } else {
+        // Vertices take the normals of their facets.
+        mesh.vertices_.resize(3 * num_triangles);
+        mesh.vertex_normals_.resize(3 * num_triangles);
+        mesh.triangles_.resize(num_triangles);
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < num_triangles; i++) {
+            for (int j = 0; j < 3; j++) {
+                mesh.vertices_[3 * i + j] =
+                        data.vertices[3 * i + j].cast<double>();
+                mesh.vertex_normals_[3 * i + j] = mesh.triangle_normals_[i];
+            }
+            mesh.triangles_[i] = Eigen::Vector3i(int(3 * i), int(3 * i + 1),
+                                                 int(3 * i + 2));
+        }
+    }
+    return true;
+}
+
 bool WriteTriangleMeshToSTL(const std::string &filename,
                             const geometry::TriangleMesh &mesh,
                             bool write_ascii /* = false*/,
@@ -52,48 +290,100 @@ bool WriteTriangleMeshToSTL(const std::string &filename,
                 "This file format does not support writing textures and uv "
                 "coordinates. Consider using .obj");
     }
-    if (write_ascii) {
-        utility::LogError("Writing ascii STL file is not supported yet.");
-    }
-
-    std::ofstream myFile(filename.c_str(), std::ios::out | std::ios::binary);
-
-    if (!myFile) {
-        utility::LogWarning("Write STL failed: unable to open file.");
-        return false;
-    }
 
     if (!mesh.HasTriangleNormals()) {
         utility::LogWarning("Write STL failed: compute normals first.");
         return false;
     }
 
-    size_t num_of_triangles = mesh.triangles_.size();
+    const int64_t num_of_triangles = int64_t(mesh.triangles_.size());
     if (num_of_triangles == 0) {
         utility::LogWarning("Write STL failed: empty file.");
         return false;
     }
-    char header[80] = "Created by Open3D";
-    myFile.write(header, 80);
-    myFile.write((char *)(&num_of_triangles), 4);
 
-    utility::ConsoleProgressBar progress_bar(num_of_triangles,
-                                             "Writing STL: ", print_progress);
-    for (size_t i = 0; i < num_of_triangles; i++) {
-        Eigen::Vector3f float_vector3f =
-                mesh.triangle_normals_[i].cast<float>();
-        myFile.write(reinterpret_cast<const char *>(float_vector3f.data()), 12);
-        for (int j = 0; j < 3; j++) {
-            Eigen::Vector3f float_vector3f =
-                    mesh.vertices_[mesh.triangles_[i][j]].cast<float>();
-            myFile.write(reinterpret_cast<const char *>(float_vector3f.data()),
-                         12);
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write STL failed: unable to open file.");
+        return false;
+    }
+
+    // Blocks of triangles are formatted in parallel and written in order.
+    auto format_block = [&](int64_t begin, int64_t end, std::string &block) {
+        block.clear();
+        if (write_ascii) {
+            char line[256];
+            for (int64_t i = begin; i < end; i++) {
+                const Eigen::Vector3f n =
+                        mesh.triangle_normals_[i].cast<float>();
+                snprintf(line, sizeof(line),
+                         "facet normal %.9g %.9g %.9g\nouter loop\n", n(0),
+                         n(1), n(2));
+                block += line;
+                for (int j = 0; j < 3; j++) {
+                    const Eigen::Vector3f v =
+                            mesh.vertices_[mesh.triangles_[i](j)].cast<float>();
+                    snprintf(line, sizeof(line), "vertex %.9g %.9g %.9g\n",
+                             v(0), v(1), v(2));
+                    block += line;
+                }
+                block += "endloop\nendfacet\n";
+            }
+        } else {
+            block.resize((end - begin) * kSTLRecordSize, 0);
+            for (int64_t i = begin; i < end; i++) {
+                char *record = &block[(i - begin) * kSTLRecordSize];
+                Eigen::Vector3f values =
+                        mesh.triangle_normals_[i].cast<float>();
+                std::memcpy(record, values.data(), 12);
+                for (int j = 0; j < 3; j++) {
+                    values = mesh.vertices_[mesh.triangles_[i](j)]
+                                     .cast<float>();
+                    std::memcpy(record + 12 * (j + 1), values.data(), 12);
+                }
+            }
         }
-        char blank[2] = {0, 0};
-        myFile.write(blank, 2);
-        ++progress_bar;
+    };
+
+    bool success;
+    if (write_ascii) {
+        success = fprintf(file, "solid Open3D\n") > 0;
+    } else {
+        char header[kSTLHeaderSize] = "Created by Open3D";
+        const uint32_t count = uint32_t(num_of_triangles);
+        std::memcpy(header + 80, &count, sizeof(uint32_t));
+        success = fwrite(header, 1, kSTLHeaderSize, file) == kSTLHeaderSize;
     }
-    return true;
+    const int64_t num_blocks =
+            (num_of_triangles + kSTLBlockSize - 1) / kSTLBlockSize;
+    utility::ConsoleProgressBar progress_bar(num_blocks, "Writing STL: ",
+                                             print_progress);
+#pragma omp parallel
+    {
+        std::string block;
+#pragma omp for ordered schedule(static, 1)
+        for (int64_t b = 0; b < num_blocks; b++) {
+            format_block(b * kSTLBlockSize,
+                         std::min((b + 1) * kSTLBlockSize, num_of_triangles),
+                         block);
+#pragma omp ordered
+            {
+                success = success && fwrite(block.data(), 1, block.size(),
+                                            file) == block.size();
+                ++progress_bar;
+            }
+        }
+    }
+    if (write_ascii) {
+        success = success && fprintf(file, "endsolid Open3D\n") > 0;
+    }
+    if (fclose(file) != 0) {
+        success = false;
+    }
+    if (!success) {
+        utility::LogWarning("Write STL failed: unable to write file.");
+    }
+    return success;
 }
 
 }  // namespace io
@@ -255,11 +255,31 @@ std::shared_ptr<geometry::RGBDImage> AzureKinectSensor::DecompressCapture(
         rgbd_buffer = std::make_shared<geometry::RGBDImage>();
     }
 
+    if (!DecompressCapture(capture, transformation, *rgbd_buffer,
+                           *color_buffer)) {
+        return nullptr;
+    }
+    return rgbd_buffer;
+}
+
+bool AzureKinectSensor::DecompressCapture(k4a_capture_t capture,
+                                          k4a_transformation_t transformation,
+                                          geometry::RGBDImage &rgbd,
+                                          geometry::Image &bgra_buffer) {
     k4a_image_t k4a_color = k4a_plugin::k4a_capture_get_color_image(capture);
     k4a_image_t k4a_depth = k4a_plugin::k4a_capture_get_depth_image(capture);
+    auto release_images = [&]() {
+        if (k4a_color != nullptr) {
+            k4a_plugin::k4a_image_release(k4a_color);
+        }
+        if (k4a_depth != nullptr) {
+            k4a_plugin::k4a_image_release(k4a_depth);
+        }
+    };
     if (k4a_color == nullptr || k4a_depth == nullptr) {
         utility::LogDebug("Skipping empty captures.");
-        return nullptr;
+        release_images();
+        return false;
     }
 
     /* Process color */
@@ -267,15 +287,16 @@ std::shared_ptr<geometry::RGBDImage> AzureKinectSensor::DecompressCapture(
         k4a_plugin::k4a_image_get_format(k4a_color)) {
         utility::LogWarning(
                 "Unexpected image format. The stream may have been corrupted.");
-        return nullptr;
+        release_images();
+        return false;
     }
 
     int width = k4a_plugin::k4a_image_get_width_pixels(k4a_color);
     int height = k4a_plugin::k4a_image_get_height_pixels(k4a_color);
 
     /* resize */
-    rgbd_buffer->color_.Prepare(width, height, 3, sizeof(uint8_t));
-    color_buffer->Prepare(width, height, 4, sizeof(uint8_t));
+    rgbd.color_.Prepare(width, height, 3, sizeof(uint8_t));
+    bgra_buffer.Prepare(width, height, 4, sizeof(uint8_t));
 
     tjhandle tjHandle;
     tjHandle = tjInitDecompress();
@@ -283,48 +304,46 @@ std::shared_ptr<geometry::RGBDImage> AzureKinectSensor::DecompressCapture(
         tjDecompress2(tjHandle, k4a_plugin::k4a_image_get_buffer(k4a_color),
                       static_cast<unsigned long>(
                               k4a_plugin::k4a_image_get_size(k4a_color)),
-                      color_buffer->data_.data(), width, 0 /* pitch */, height,
+                      bgra_buffer.data_.data(), width, 0 /* pitch */, height,
                       TJPF_BGRA, TJFLAG_FASTDCT | TJFLAG_FASTUPSAMPLE)) {
         utility::LogWarning("Failed to decompress color image.");
-        return nullptr;
+        tjDestroy(tjHandle);
+        release_images();
+        return false;
     }
     tjDestroy(tjHandle);
-    ConvertBGRAToRGB(*color_buffer, rgbd_buffer->color_);
+    ConvertBGRAToRGB(bgra_buffer, rgbd.color_);
 
     /* transform depth to color plane */
-    k4a_image_t k4a_transformed_depth = nullptr;
     if (transformation) {
-        rgbd_buffer->depth_.Prepare(width, height, 1, sizeof(uint16_t));
+        k4a_image_t k4a_transformed_depth = nullptr;
+        rgbd.depth_.Prepare(width, height, 1, sizeof(uint16_t));
         k4a_plugin::k4a_image_create_from_buffer(
                 K4A_IMAGE_FORMAT_DEPTH16, width, height,
-                width * sizeof(uint16_t), rgbd_buffer->depth_.data_.data(),
+                width * sizeof(uint16_t), rgbd.depth_.data_.data(),
                 width * height * sizeof(uint16_t), NULL, NULL,
                 &k4a_transformed_depth);
-        if (K4A_RESULT_SUCCEEDED !=
-            k4a_plugin::k4a_transformation_depth_image_to_color_camera(
-                    transformation, k4a_depth, k4a_transformed_depth)) {
+        k4a_result_t result =
+                k4a_plugin::k4a_transformation_depth_image_to_color_camera(
+                        transformation, k4a_depth, k4a_transformed_depth);
+        k4a_plugin::k4a_image_release(k4a_transformed_depth);
+        if (K4A_RESULT_SUCCEEDED != result) {
             utility::LogWarning(
                     "Failed to transform depth frame to color frame.");
-            return nullptr;
+            release_images();
+            return false;
         }
     } else {
-        rgbd_buffer->depth_.Prepare(
-                k4a_plugin::k4a_image_get_width_pixels(k4a_depth),
-                k4a_plugin::k4a_image_get_height_pixels(k4a_depth), 1,
-                sizeof(uint16_t));
-        memcpy(rgbd_buffer->depth_.data_.data(),
+        rgbd.depth_.Prepare(k4a_plugin::k4a_image_get_width_pixels(k4a_depth),
+                            k4a_plugin::k4a_image_get_height_pixels(k4a_depth),
+                            1, sizeof(uint16_t));
+        memcpy(rgbd.depth_.data_.data(),
                k4a_plugin::k4a_image_get_buffer(k4a_depth),
                k4a_plugin::k4a_image_get_size(k4a_depth));
     }
 
-    /* process depth */
-    k4a_plugin::k4a_image_release(k4a_color);
-    k4a_plugin::k4a_image_release(k4a_depth);
-    if (transformation) {
-        k4a_plugin::k4a_image_release(k4a_transformed_depth);
-    }
-
-    return rgbd_buffer;
+    release_images();
+    return true;
 }
 
 }  // namespace io
@@ -63,8 +63,23 @@ public:
     static bool PrintFirmware(_k4a_device_t* device);
     /// List available Azure Kinect devices.
     static bool ListDevices();
+    /// Decompress a capture. The returned image is a shared buffer that is
+    /// overwritten by the next call.
     static std::shared_ptr<geometry::RGBDImage> DecompressCapture(
             _k4a_capture_t* capture, _k4a_transformation_t* transformation);
+    /// Decompress a capture into caller-owned buffers. This overload keeps no
+    /// internal state and may be called concurrently, as long as every
+    /// thread uses its own \p transformation handle.
+    ///
+    /// \param capture The capture to decompress.
+    /// \param transformation Transformation used to align depth to color, or
+    /// nullptr to keep depth in its own camera frame.
+    /// \param rgbd Output RGBD image.
+    /// \param bgra_buffer Scratch buffer for the decoded BGRA color image.
+    static bool DecompressCapture(_k4a_capture_t* capture,
+                                  _k4a_transformation_t* transformation,
+                                  geometry::RGBDImage& rgbd,
+                                  geometry::Image& bgra_buffer);
 
 protected:
     _k4a_capture_t* CaptureRawFrame() const;
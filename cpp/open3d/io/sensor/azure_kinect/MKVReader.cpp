@@ -32,7 +32,12 @@
 #include <k4arecord/record.h>
 #include <turbojpeg.h>
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <iostream>
+#include <mutex>
+#include <thread>
 
 #include "open3d/io/sensor/azure_kinect/AzureKinectSensor.h"
 #include "open3d/io/sensor/azure_kinect/K4aPlugin.h"
@@ -40,8 +45,228 @@
 namespace open3d {
 namespace io {
 
+namespace {
+
+/// Timestamp of the latest image in the capture, in device time (us). Seeking
+/// to this timestamp lands on the capture itself, since every image of the
+/// preceding captures is older.
+uint64_t GetCaptureTimestamp(k4a_capture_t capture) {
+    uint64_t timestamp = 0;
+    for (k4a_image_t image : {k4a_plugin::k4a_capture_get_color_image(capture),
+                              k4a_plugin::k4a_capture_get_depth_image(capture),
+                              k4a_plugin::k4a_capture_get_ir_image(capture)}) {
+        if (image != nullptr) {
+            timestamp = std::max(
+                    timestamp, k4a_plugin::k4a_image_get_timestamp_usec(image));
+            k4a_plugin::k4a_image_release(image);
+        }
+    }
+    return timestamp;
+}
+
+/// Get the timestamp of \p capture relative to the start of the recording.
+/// Returns false for captures without images or with a timestamp before the
+/// start.
+bool GetRelativeCaptureTimestamp(k4a_capture_t capture,
+                                 uint64_t start_timestamp_offset_usec,
+                                 uint64_t &timestamp) {
+    uint64_t capture_timestamp = GetCaptureTimestamp(capture);
+    if (capture_timestamp == 0 ||
+        capture_timestamp < start_timestamp_offset_usec) {
+        timestamp = 0;
+        return false;
+    }
+    timestamp = capture_timestamp - start_timestamp_offset_usec;
+    return true;
+}
+
+/// Decode the captures whose timestamps (relative to the start of the
+/// recording) are given in \p timestamps from a fresh playback of
+/// \p filename.
+void DecodeRange(const std::string &filename,
+                 const uint64_t *timestamps,
+                 size_t count,
+                 std::shared_ptr<geometry::RGBDImage> *frames) {
+    k4a_playback_t handle = nullptr;
+    if (K4A_RESULT_SUCCEEDED !=
+        k4a_plugin::k4a_playback_open(filename.c_str(), &handle)) {
+        utility::LogWarning("Unable to open file {}", filename);
+        return;
+    }
+    k4a_calibration_t calibration;
+    k4a_record_configuration_t config;
+    if (K4A_RESULT_SUCCEEDED !=
+                k4a_plugin::k4a_playback_get_calibration(handle,
+                                                         &calibration) ||
+        K4A_RESULT_SUCCEEDED !=
+                k4a_plugin::k4a_playback_get_record_configuration(handle,
+                                                                  &config) ||
+        K4A_RESULT_SUCCEEDED != k4a_plugin::k4a_playback_seek_timestamp(
+                                        handle, timestamps[0],
+                                        K4A_PLAYBACK_SEEK_BEGIN)) {
+        utility::LogWarning("Unable to go to timestamp {}", timestamps[0]);
+        k4a_plugin::k4a_playback_close(handle);
+        return;
+    }
+    k4a_transformation_t transformation =
+            k4a_plugin::k4a_transformation_create(&calibration);
+    geometry::Image bgra_buffer;
+
+    size_t i = 0;
+    while (i < count) {
+        k4a_capture_t capture;
+        if (K4A_STREAM_RESULT_SUCCEEDED !=
+            k4a_plugin::k4a_playback_get_next_capture(handle, &capture)) {
+            break;
+        }
+        uint64_t timestamp;
+        // Skip captures without a valid timestamp, and captures before the
+        // range in case the seek landed early. Frames that are missing from
+        // the playback are left empty, so that later frames keep their index.
+        if (GetRelativeCaptureTimestamp(
+                    capture, config.start_timestamp_offset_usec, timestamp)) {
+            while (i < count && timestamps[i] < timestamp) {
+                ++i;
+            }
+            if (i < count && timestamps[i] == timestamp) {
+                auto rgbd = std::make_shared<geometry::RGBDImage>();
+                if (AzureKinectSensor::DecompressCapture(
+                            capture, transformation, *rgbd, bgra_buffer)) {
+                    frames[i] = rgbd;
+                }
+                ++i;
+            }
+        }
+        k4a_plugin::k4a_capture_release(capture);
+    }
+
+    k4a_plugin::k4a_transformation_destroy(transformation);
+    k4a_plugin::k4a_playback_close(handle);
+}
+
+}  // namespace
+
+/// Decodes captures of a playback ahead of NextFrame(). An idle worker reads
+/// the next capture under the lock, which keeps reads sequential and ordered,
+/// and decodes it outside the lock with its own transformation handle.
+class MKVReader::DecodeQueue {
+public:
+    DecodeQueue(k4a_playback_t handle,
+                const k4a_calibration_t &calibration,
+                int num_threads,
+                size_t capacity)
+        : handle_(handle),
+          calibration_(calibration),
+          capacity_(std::max<size_t>(capacity, 1)) {
+        for (int i = 0; i < num_threads; ++i) {
+            workers_.emplace_back(&DecodeQueue::Work, this);
+        }
+    }
+
+    ~DecodeQueue() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto &worker : workers_) {
+            worker.join();
+        }
+    }
+
+    /// Pop the next frame in file order. Returns false at the end of the
+    /// stream.
+    bool Pop(std::shared_ptr<geometry::RGBDImage> &frame) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() {
+            return (!slots_.empty() && slots_.front()->ready_) ||
+                   (slots_.empty() && eof_);
+        });
+        if (slots_.empty()) {
+            return false;
+        }
+        frame = slots_.front()->frame_;
+        slots_.pop_front();
+        cv_.notify_all();
+        return true;
+    }
+
+private:
+    struct Slot {
+        std::shared_ptr<geometry::RGBDImage> frame_;
+        bool ready_ = false;
+    };
+
+    void Work() {
+        k4a_transformation_t transformation =
+                k4a_plugin::k4a_transformation_create(&calibration_);
+        geometry::Image bgra_buffer;
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            cv_.wait(lock, [this]() {
+                return stop_ || eof_ || slots_.size() < capacity_;
+            });
+            if (stop_ || eof_) {
+                break;
+            }
+
+            k4a_capture_t capture;
+            k4a_stream_result_t res =
+                    k4a_plugin::k4a_playback_get_next_capture(handle_,
+                                                              &capture);
+            if (K4A_STREAM_RESULT_EOF == res) {
+                eof_ = true;
+                cv_.notify_all();
+                break;
+            }
+            auto slot = std::make_shared<Slot>();
+            slots_.push_back(slot);
+            if (K4A_STREAM_RESULT_FAILED == res) {
+                utility::LogInfo("Empty frame encountered, skip");
+                slot->ready_ = true;
+                cv_.notify_all();
+                continue;
+            }
+
+            lock.unlock();
+            auto rgbd = std::make_shared<geometry::RGBDImage>();
+            if (!AzureKinectSensor::DecompressCapture(capture, transformation,
+                                                      *rgbd, bgra_buffer)) {
+                rgbd = nullptr;
+            }
+            k4a_plugin::k4a_capture_release(capture);
+            lock.lock();
+
+            slot->frame_ = rgbd;
+            slot->ready_ = true;
+            cv_.notify_all();
+        }
+        lock.unlock();
+
+        k4a_plugin::k4a_transformation_destroy(transformation);
+    }
+
+    k4a_playback_t handle_;
+    k4a_calibration_t calibration_;
+    size_t capacity_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::shared_ptr<Slot>> slots_;
+    bool eof_ = false;
+    bool stop_ = false;
+    std::vector<std::thread> workers_;
+};
+
 MKVReader::MKVReader() : handle_(nullptr), transformation_(nullptr) {}
 
+MKVReader::~MKVReader() {
+    if (IsOpened()) {
+        Close();
+    }
+}
+
 bool MKVReader::IsOpened() { return handle_ != nullptr; }
 
 std::string MKVReader::GetTagInMetadata(const std::string &tag_name) {
@@ -59,7 +284,7 @@ std::string MKVReader::GetTagInMetadata(const std::string &tag_name) {
     }
 }
 
-bool MKVReader::Open(const std::string &filename) {
+bool MKVReader::Open(const std::string &filename, bool build_index) {
     if (IsOpened()) {
         Close();
     }
@@ -72,11 +297,76 @@ bool MKVReader::Open(const std::string &filename) {
 
     metadata_.ConvertFromJsonValue(GetMetadataJson());
     is_eof_ = false;
+    filename_ = filename;
+    has_frame_index_ = false;
+    frame_timestamps_.clear();
+
+    if (build_index && !BuildFrameIndex()) {
+        Close();
+        return false;
+    }
 
     return true;
 }
 
-void MKVReader::Close() { k4a_plugin::k4a_playback_close(handle_); }
+void MKVReader::Close() {
+    StopDecodeAhead();
+    if (transformation_ != nullptr) {
+        k4a_plugin::k4a_transformation_destroy(transformation_);
+        transformation_ = nullptr;
+    }
+    k4a_plugin::k4a_playback_close(handle_);
+    handle_ = nullptr;
+}
+
+bool MKVReader::BuildFrameIndex() {
+    k4a_record_configuration_t config;
+    if (K4A_RESULT_SUCCEEDED !=
+        k4a_plugin::k4a_playback_get_record_configuration(handle_, &config)) {
+        utility::LogWarning("Failed to get record configuration");
+        return false;
+    }
+    start_timestamp_offset_usec_ = config.start_timestamp_offset_usec;
+
+    size_t num_skipped = 0;
+    while (true) {
+        k4a_capture_t capture;
+        k4a_stream_result_t res =
+                k4a_plugin::k4a_playback_get_next_capture(handle_, &capture);
+        if (K4A_STREAM_RESULT_EOF == res) {
+            break;
+        } else if (K4A_STREAM_RESULT_FAILED == res) {
+            utility::LogWarning(
+                    "Failed to read capture {}, the frame index is truncated.",
+                    frame_timestamps_.size());
+            break;
+        }
+        // Captures without a valid timestamp cannot be seeked to, so they
+        // are left out of the index.
+        uint64_t timestamp;
+        if (GetRelativeCaptureTimestamp(capture, start_timestamp_offset_usec_,
+                                        timestamp)) {
+            frame_timestamps_.push_back(timestamp);
+        } else {
+            ++num_skipped;
+        }
+        k4a_plugin::k4a_capture_release(capture);
+    }
+    if (num_skipped > 0) {
+        utility::LogWarning(
+                "{} captures without a valid timestamp are not indexed.",
+                num_skipped);
+    }
+
+    if (K4A_RESULT_SUCCEEDED !=
+        k4a_plugin::k4a_playback_seek_timestamp(handle_, 0,
+                                                K4A_PLAYBACK_SEEK_BEGIN)) {
+        utility::LogWarning("Unable to rewind after building frame index");
+        return false;
+    }
+    has_frame_index_ = true;
+    return true;
+}
 
 Json::Value MKVReader::GetMetadataJson() {
     static const std::unordered_map<std::string, std::pair<int, int>>
@@ -146,20 +436,94 @@ bool MKVReader::SeekTimestamp(size_t timestamp) {
         return false;
     }
 
+    StopDecodeAhead();
     if (K4A_RESULT_SUCCEEDED !=
         k4a_plugin::k4a_playback_seek_timestamp(handle_, timestamp,
                                                 K4A_PLAYBACK_SEEK_BEGIN)) {
         utility::LogWarning("Unable to go to timestamp {}", timestamp);
         return false;
     }
+    is_eof_ = false;
     return true;
 }
 
+size_t MKVReader::GetNumFrames() const {
+    if (!has_frame_index_) {
+        utility::LogError(
+                "Frame index is not built. Please call Open() with "
+                "build_index = true.");
+    }
+    return frame_timestamps_.size();
+}
+
+bool MKVReader::SeekFrame(size_t frame_index) {
+    if (frame_index >= GetNumFrames()) {
+        utility::LogWarning("Frame index {} exceeds maximum {}.", frame_index,
+                            GetNumFrames());
+        return false;
+    }
+    return SeekTimestamp(frame_timestamps_[frame_index]);
+}
+
+void MKVReader::SetDecodeAhead(int num_threads, size_t queue_size) {
+    // Frames already decoded ahead are dropped; the playback position has
+    // moved past them, so the caller should seek to resume at a known frame.
+    StopDecodeAhead();
+    decode_ahead_threads_ = std::max(num_threads, 0);
+    decode_ahead_queue_size_ = queue_size;
+}
+
+void MKVReader::StopDecodeAhead() { decode_queue_.reset(); }
+
+std::vector<std::shared_ptr<geometry::RGBDImage>> MKVReader::ReadFrames(
+        size_t start, size_t end, int num_threads) {
+    end = std::min(end, GetNumFrames());
+    if (start >= end) {
+        return {};
+    }
+    size_t num_frames = end - start;
+    if (num_threads <= 0) {
+        num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    num_threads = static_cast<int>(
+            std::min(static_cast<size_t>(num_threads), num_frames));
+
+    std::vector<std::shared_ptr<geometry::RGBDImage>> frames(num_frames);
+#pragma omp parallel for num_threads(num_threads) schedule(static, 1)
+    for (int t = 0; t < num_threads; ++t) {
+        size_t begin = num_frames * t / num_threads;
+        size_t stop = num_frames * (t + 1) / num_threads;
+        DecodeRange(filename_, frame_timestamps_.data() + start + begin,
+                    stop - begin, frames.data() + begin);
+    }
+    return frames;
+}
+
 std::shared_ptr<geometry::RGBDImage> MKVReader::NextFrame() {
     if (!IsOpened()) {
         utility::LogError("Null file handler. Please call Open().");
     }
 
+    if (decode_ahead_threads_ > 0) {
+        if (decode_queue_ == nullptr) {
+            k4a_calibration_t calibration;
+            if (K4A_RESULT_SUCCEEDED !=
+                k4a_plugin::k4a_playback_get_calibration(handle_,
+                                                         &calibration)) {
+                utility::LogError("Failed to get calibration");
+            }
+            decode_queue_ = std::make_unique<DecodeQueue>(
+                    handle_, calibration, decode_ahead_threads_,
+                    decode_ahead_queue_size_);
+        }
+        std::shared_ptr<geometry::RGBDImage> rgbd;
+        if (!decode_queue_->Pop(rgbd)) {
+            utility::LogInfo("EOF reached");
+            is_eof_ = true;
+        }
+        return rgbd;
+    }
+
     k4a_capture_t k4a_capture;
     k4a_stream_result_t res =
             k4a_plugin::k4a_playback_get_next_capture(handle_, &k4a_capture);
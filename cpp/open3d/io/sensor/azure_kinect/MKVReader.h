@@ -26,6 +26,10 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/io/sensor/azure_kinect/MKVMetadata.h"
 #include "open3d/utility/IJsonConvertible.h"
@@ -41,11 +45,16 @@ namespace io {
 /// \class MKVReader
 ///
 /// AzureKinect mkv file reader.
+///
+/// Besides sequential reading with NextFrame(), the reader can build a frame
+/// index on Open() for frame-accurate seeking and parallel reading of frame
+/// ranges with ReadFrames(), and can decode frames ahead of NextFrame() on a
+/// pool of worker threads (see SetDecodeAhead()).
 class MKVReader {
 public:
     /// \brief Default Constructor.
     MKVReader();
-    virtual ~MKVReader() {}
+    virtual ~MKVReader();
 
     /// Check If the mkv file is opened.
     bool IsOpened();
@@ -55,7 +64,11 @@ public:
     /// Open an mkv playback.
     ///
     /// \param filename Path to the mkv file.
-    bool Open(const std::string &filename);
+    /// \param build_index If true, scan the file once to record the
+    /// timestamp of every capture. Captures without a valid timestamp are
+    /// left out of the index. Required by GetNumFrames(), SeekFrame() and
+    /// ReadFrames().
+    bool Open(const std::string &filename, bool build_index = false);
     /// Close the opened mkv playback.
     void Close();
 
@@ -66,12 +79,65 @@ public:
     /// Get next frame from the mkv playback and returns the RGBD object.
     std::shared_ptr<geometry::RGBDImage> NextFrame();
 
+    /// Check if the frame index has been built.
+    bool HasFrameIndex() const { return has_frame_index_; }
+    /// Number of indexed captures in the file. Requires the frame index.
+    size_t GetNumFrames() const;
+    /// Timestamps (in us, relative to the start of the recording) of every
+    /// indexed capture. Requires the frame index.
+    const std::vector<uint64_t> &GetFrameTimestamps() const {
+        return frame_timestamps_;
+    }
+    /// Seek to the capture with index \p frame_index, so that the next call
+    /// to NextFrame() returns it. Requires the frame index.
+    bool SeekFrame(size_t frame_index);
+
+    /// Decode frames ahead of NextFrame() on worker threads.
+    ///
+    /// Captures are read sequentially from the playback and decoded by
+    /// \p num_threads workers into a bounded queue of at most
+    /// \p queue_size frames. NextFrame() returns frames in file order.
+    /// Frames returned in this mode are not reused by the reader. Changing
+    /// the setting drops frames already decoded ahead; seek afterwards to
+    /// resume at a known position.
+    ///
+    /// \param num_threads Number of decoding threads. 0 disables decode-ahead.
+    /// \param queue_size Maximum number of frames decoded ahead.
+    void SetDecodeAhead(int num_threads, size_t queue_size = 8);
+
+    /// Read and decode captures [\p start, \p end) in parallel. Each worker
+    /// opens its own playback of the file and decodes a contiguous part of
+    /// the range, so the playback position of this reader is not changed.
+    /// Requires the frame index.
+    ///
+    /// \param start Index of the first capture.
+    /// \param end One past the index of the last capture.
+    /// \param num_threads Number of threads. -1 uses all available cores.
+    /// \return Frames in file order. Captures that cannot be decoded are
+    /// returned as nullptr.
+    std::vector<std::shared_ptr<geometry::RGBDImage>> ReadFrames(
+            size_t start, size_t end, int num_threads = -1);
+
 private:
+    class DecodeQueue;
+
     _k4a_playback_t *handle_;
     _k4a_transformation_t *transformation_;
     MKVMetadata metadata_;
     bool is_eof_ = false;
 
+    std::string filename_;
+    bool has_frame_index_ = false;
+    std::vector<uint64_t> frame_timestamps_;
+    uint64_t start_timestamp_offset_usec_ = 0;
+
+    int decode_ahead_threads_ = 0;
+    size_t decode_ahead_queue_size_ = 8;
+    std::unique_ptr<DecodeQueue> decode_queue_;
+
+    bool BuildFrameIndex();
+    void StopDecodeAhead();
+
     Json::Value GetMetadataJson();
     std::string GetTagInMetadata(const std::string &tag_name);
 };
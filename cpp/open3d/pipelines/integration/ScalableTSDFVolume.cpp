@@ -32,6 +32,7 @@
 #include "open3d/pipelines/integration/MarchingCubesConst.h"
 #include "open3d/pipelines/integration/UniformTSDFVolume.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace pipelines {
@@ -55,6 +56,7 @@ void ScalableTSDFVolume::Integrate(
         const geometry::RGBDImage &image,
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic) {
+    OPEN3D_PROFILE_SCOPE("integration::ScalableTSDFVolume::Integrate");
     if ((image.depth_.num_of_channels_ != 1) ||
         (image.depth_.bytes_per_channel_ != 4) ||
         (color_type_ == TSDFVolumeColorType::RGB8 &&
@@ -120,6 +122,7 @@ void ScalableTSDFVolume::Integrate(
 }
 
 std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
+    OPEN3D_PROFILE_SCOPE("integration::ScalableTSDFVolume::ExtractPointCloud");
     auto pointcloud = std::make_shared<geometry::PointCloud>();
     double half_voxel_length = voxel_length_ * 0.5;
     float w0, w1, f0, f1;
@@ -223,6 +226,8 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
 
 std::shared_ptr<geometry::TriangleMesh>
 ScalableTSDFVolume::ExtractTriangleMesh() {
+    OPEN3D_PROFILE_SCOPE(
+            "integration::ScalableTSDFVolume::ExtractTriangleMesh");
     // implementation of marching cubes, based on
     // http://paulbourke.net/geometry/polygonise/
     auto mesh = std::make_shared<geometry::TriangleMesh>();
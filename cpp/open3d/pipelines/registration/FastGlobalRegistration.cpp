@@ -24,19 +24,75 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4267)
+#endif
+
 #include "open3d/pipelines/registration/FastGlobalRegistration.h"
 
-#include "open3d/geometry/KDTreeFlann.h"
+#include <flann/flann.hpp>
+#include <memory>
+
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/registration/Feature.h"
 #include "open3d/pipelines/registration/Registration.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Eigen.h"
 #include "open3d/utility/Helper.h"
 
 namespace open3d {
 namespace pipelines {
 namespace registration {
 
+namespace {
+
+/// Nearest neighbor index in feature space. With \p checks > 0 the search is
+/// approximate over randomized kd-trees and visits at most \p checks leaves,
+/// otherwise it is exact.
+class FeatureIndex {
+public:
+    FeatureIndex(const Feature& feature, int checks)
+        : dimension_(feature.Dimension()),
+          dataset_((double*)feature.data_.data(),
+                   feature.data_.cols(),
+                   dimension_),
+          search_params_(checks > 0 ? checks : -1, 0.0) {
+        if (checks > 0) {
+            index_.reset(new flann::Index<flann::L2<double>>(
+                    dataset_, flann::KDTreeIndexParams(4)));
+        } else {
+            index_.reset(new flann::Index<flann::L2<double>>(
+                    dataset_, flann::KDTreeSingleIndexParams(15)));
+        }
+        index_->buildIndex();
+    }
+
+    /// Thread-safe nearest neighbor query of a \p dimension_ vector.
+    int SearchNearest(const double* query) const {
+        int index = -1;
+        double distance2;
+        flann::Matrix<double> query_flann((double*)query, 1, dimension_);
+        flann::Matrix<int> indices_flann(&index, 1, 1);
+        flann::Matrix<double> dists_flann(&distance2, 1, 1);
+        index_->knnSearch(query_flann, indices_flann, dists_flann, 1,
+                          search_params_);
+        return index;
+    }
+
+private:
+    size_t dimension_;
+    flann::Matrix<double> dataset_;
+    flann::SearchParams search_params_;
+    std::unique_ptr<flann::Index<flann::L2<double>>> index_;
+};
+
+/// Number of random tuples tested in parallel before the accepted ones are
+/// collected in order.
+constexpr int kTupleTrialBlock = 4096;
+
+}  // namespace
+
 static std::vector<std::pair<int, int>> AdvancedMatching(
         const std::vector<geometry::PointCloud>& point_cloud_vec,
         const std::vector<Feature>& features_vec,
@@ -56,115 +112,98 @@ static std::vector<std::pair<int, int>> AdvancedMatching(
     // STEP 1) Initial matching
     int nPti = int(point_cloud_vec[fi].points_.size());
     int nPtj = int(point_cloud_vec[fj].points_.size());
-    geometry::KDTreeFlann feature_tree_i(features_vec[fi]);
-    geometry::KDTreeFlann feature_tree_j(features_vec[fj]);
-    std::vector<int> corresK;
-    std::vector<double> dis;
-    std::vector<std::pair<int, int>> corres;
-    std::vector<std::pair<int, int>> corres_ij;
-    std::vector<std::pair<int, int>> corres_ji;
+    FeatureIndex feature_index_i(features_vec[fi],
+                                 option.feature_search_checks_);
+    FeatureIndex feature_index_j(features_vec[fj],
+                                 option.feature_search_checks_);
+    std::vector<int> j_to_i(nPtj);
+#pragma omp parallel for schedule(static)
+    for (int j = 0; j < nPtj; j++) {
+        j_to_i[j] = feature_index_i.SearchNearest(
+                features_vec[fj].data_.col(j).data());
+    }
+    // Only points of fi matched from fj are matched back.
     std::vector<int> i_to_j(nPti, -1);
     for (int j = 0; j < nPtj; j++) {
-        feature_tree_i.SearchKNN(Eigen::VectorXd(features_vec[fj].data_.col(j)),
-                                 1, corresK, dis);
-        int i = corresK[0];
-        if (i_to_j[i] == -1) {
-            feature_tree_j.SearchKNN(
-                    Eigen::VectorXd(features_vec[fi].data_.col(i)), 1, corresK,
-                    dis);
-            int ij = corresK[0];
-            i_to_j[i] = ij;
+        if (j_to_i[j] >= 0) i_to_j[j_to_i[j]] = 0;
+    }
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < nPti; i++) {
+        if (i_to_j[i] != -1) {
+            i_to_j[i] = feature_index_j.SearchNearest(
+                    features_vec[fi].data_.col(i).data());
         }
-        corres_ji.push_back(std::pair<int, int>(i, j));
     }
+    int ncorres_ij = 0;
     for (int i = 0; i < nPti; i++) {
-        if (i_to_j[i] != -1)
-            corres_ij.push_back(std::pair<int, int>(i, i_to_j[i]));
+        if (i_to_j[i] != -1) ncorres_ij++;
     }
-    int ncorres_ij = int(corres_ij.size());
-    int ncorres_ji = int(corres_ji.size());
-    for (int i = 0; i < ncorres_ij; ++i)
-        corres.push_back(
-                std::pair<int, int>(corres_ij[i].first, corres_ij[i].second));
-    for (int j = 0; j < ncorres_ji; ++j)
-        corres.push_back(
-                std::pair<int, int>(corres_ji[j].first, corres_ji[j].second));
-    utility::LogDebug("points are remained : {:d}", (int)corres.size());
+    utility::LogDebug("points are remained : {:d}", ncorres_ij + nPtj);
 
     // STEP 2) CROSS CHECK
     utility::LogDebug("\t[cross check] ");
     std::vector<std::pair<int, int>> corres_cross;
-    std::vector<std::vector<int>> Mi(nPti), Mj(nPtj);
-    int ci, cj;
-    for (int i = 0; i < ncorres_ij; ++i) {
-        ci = corres_ij[i].first;
-        cj = corres_ij[i].second;
-        Mi[ci].push_back(cj);
-    }
-    for (int j = 0; j < ncorres_ji; ++j) {
-        ci = corres_ji[j].first;
-        cj = corres_ji[j].second;
-        Mj[cj].push_back(ci);
-    }
     for (int i = 0; i < nPti; ++i) {
-        for (size_t ii = 0; ii < Mi[i].size(); ++ii) {
-            int j = Mi[i][ii];
-            for (size_t jj = 0; jj < Mj[j].size(); ++jj) {
-                if (Mj[j][jj] == i)
-                    corres_cross.push_back(std::pair<int, int>(i, j));
-            }
+        int j = i_to_j[i];
+        if (j >= 0 && j_to_i[j] == i) {
+            corres_cross.push_back(std::pair<int, int>(i, j));
         }
     }
-    utility::LogDebug("points are remained : %d", (int)corres_cross.size());
+    utility::LogDebug("points are remained : {:d}", (int)corres_cross.size());
 
     // STEP 3) TUPLE CONSTRAINT
     utility::LogDebug("\t[tuple constraint] ");
-    int rand0, rand1, rand2, i, cnt = 0;
-    int idi0, idi1, idi2, idj0, idj1, idj2;
+    int cnt = 0, num_trial = 0;
     double scale = option.tuple_scale_;
     int ncorr = static_cast<int>(corres_cross.size());
     int number_of_trial = ncorr * 100;
+    const auto& points_i = point_cloud_vec[fi].points_;
+    const auto& points_j = point_cloud_vec[fj].points_;
 
     std::vector<std::pair<int, int>> corres_tuple;
-    for (i = 0; i < number_of_trial; i++) {
-        rand0 = utility::UniformRandInt(0, ncorr - 1);
-        rand1 = utility::UniformRandInt(0, ncorr - 1);
-        rand2 = utility::UniformRandInt(0, ncorr - 1);
-        idi0 = corres_cross[rand0].first;
-        idj0 = corres_cross[rand0].second;
-        idi1 = corres_cross[rand1].first;
-        idj1 = corres_cross[rand1].second;
-        idi2 = corres_cross[rand2].first;
-        idj2 = corres_cross[rand2].second;
-
-        // collect 3 points from i-th fragment
-        Eigen::Vector3d pti0 = point_cloud_vec[fi].points_[idi0];
-        Eigen::Vector3d pti1 = point_cloud_vec[fi].points_[idi1];
-        Eigen::Vector3d pti2 = point_cloud_vec[fi].points_[idi2];
-        double li0 = (pti0 - pti1).norm();
-        double li1 = (pti1 - pti2).norm();
-        double li2 = (pti2 - pti0).norm();
-
-        // collect 3 points from j-th fragment
-        Eigen::Vector3d ptj0 = point_cloud_vec[fj].points_[idj0];
-        Eigen::Vector3d ptj1 = point_cloud_vec[fj].points_[idj1];
-        Eigen::Vector3d ptj2 = point_cloud_vec[fj].points_[idj2];
-        double lj0 = (ptj0 - ptj1).norm();
-        double lj1 = (ptj1 - ptj2).norm();
-        double lj2 = (ptj2 - ptj0).norm();
-
-        // check tuple constraint
-        if ((li0 * scale < lj0) && (lj0 < li0 / scale) && (li1 * scale < lj1) &&
-            (lj1 < li1 / scale) && (li2 * scale < lj2) && (lj2 < li2 / scale)) {
-            corres_tuple.push_back(std::pair<int, int>(idi0, idj0));
-            corres_tuple.push_back(std::pair<int, int>(idi1, idj1));
-            corres_tuple.push_back(std::pair<int, int>(idi2, idj2));
-            cnt++;
+    std::vector<Eigen::Vector3i> samples(kTupleTrialBlock);
+    std::vector<char> accepted(kTupleTrialBlock);
+    for (int begin = 0;
+         begin < number_of_trial && cnt < option.maximum_tuple_count_;
+         begin += kTupleTrialBlock) {
+        const int num_samples =
+                std::min(kTupleTrialBlock, number_of_trial - begin);
+#pragma omp parallel for schedule(static)
+        for (int t = 0; t < num_samples; t++) {
+            Eigen::Vector3i& sample = samples[t];
+            for (int k = 0; k < 3; k++) {
+                sample(k) = utility::UniformRandInt(0, ncorr - 1);
+            }
+            const std::pair<int, int>& c0 = corres_cross[sample(0)];
+            const std::pair<int, int>& c1 = corres_cross[sample(1)];
+            const std::pair<int, int>& c2 = corres_cross[sample(2)];
+
+            // collect 3 points from i-th fragment
+            double li0 = (points_i[c0.first] - points_i[c1.first]).norm();
+            double li1 = (points_i[c1.first] - points_i[c2.first]).norm();
+            double li2 = (points_i[c2.first] - points_i[c0.first]).norm();
+
+            // collect 3 points from j-th fragment
+            double lj0 = (points_j[c0.second] - points_j[c1.second]).norm();
+            double lj1 = (points_j[c1.second] - points_j[c2.second]).norm();
+            double lj2 = (points_j[c2.second] - points_j[c0.second]).norm();
+
+            // check tuple constraint
+            accepted[t] = (li0 * scale < lj0) && (lj0 < li0 / scale) &&
+                          (li1 * scale < lj1) && (lj1 < li1 / scale) &&
+                          (li2 * scale < lj2) && (lj2 < li2 / scale);
+        }
+        for (int t = 0; t < num_samples; t++) {
+            num_trial = begin + t + 1;
+            if (!accepted[t]) continue;
+            for (int k = 0; k < 3; k++) {
+                corres_tuple.push_back(corres_cross[samples[t](k)]);
+            }
+            if (++cnt >= option.maximum_tuple_count_) break;
         }
-        if (cnt >= option.maximum_tuple_count_) break;
     }
     utility::LogDebug("{:d} tuples ({:d} trial, {:d} actual).", cnt,
-                      number_of_trial, i);
+                      number_of_trial, num_trial);
 
     if (swapped) {
         std::vector<std::pair<int, int>> temp;
@@ -243,59 +282,35 @@ static Eigen::Matrix4d OptimizePairwiseRegistration(
 
     if (corres.size() < 10) return Eigen::Matrix4d::Identity();
 
-    std::vector<double> s(corres.size(), 1.0);
     Eigen::Matrix4d trans;
     trans.setIdentity();
 
     for (int itr = 0; itr < numIter; itr++) {
-        const int nvariable = 6;
-        Eigen::MatrixXd JTJ(nvariable, nvariable);
-        Eigen::MatrixXd JTr(nvariable, 1);
-        Eigen::MatrixXd J(nvariable, 1);
-        JTJ.setZero();
-        JTr.setZero();
-        double r = 0.0, r2 = 0.0;
-
-        for (size_t c = 0; c < corres.size(); c++) {
-            int ii = corres[c].first;
-            int jj = corres[c].second;
-            Eigen::Vector3d p, q;
-            p = point_cloud_vec[i].points_[ii];
-            q = point_cloud_copy_j.points_[jj];
+        // Each correspondence contributes one row per coordinate, weighted by
+        // the line process s = (par / (|p - q|^2 + par))^2.
+        auto compute_jacobian_and_residual = [&](int c, Eigen::Vector6d* J_r,
+                                                 double* r, double* w) {
+            const Eigen::Vector3d& p =
+                    point_cloud_vec[i].points_[corres[c].first];
+            const Eigen::Vector3d& q =
+                    point_cloud_copy_j.points_[corres[c].second];
             Eigen::Vector3d rpq = p - q;
-
-            size_t c2 = c;
             double temp = par / (rpq.dot(rpq) + par);
-            s[c2] = temp * temp;
-
-            J.setZero();
-            J(1) = -q(2);
-            J(2) = q(1);
-            J(3) = -1;
-            r = rpq(0);
-            JTJ += J * J.transpose() * s[c2];
-            JTr += J * r * s[c2];
-            r2 += r * r * s[c2];
-
-            J.setZero();
-            J(2) = -q(0);
-            J(0) = q(2);
-            J(4) = -1;
-            r = rpq(1);
-            JTJ += J * J.transpose() * s[c2];
-            JTr += J * r * s[c2];
-            r2 += r * r * s[c2];
-
-            J.setZero();
-            J(0) = -q(1);
-            J(1) = q(0);
-            J(5) = -1;
-            r = rpq(2);
-            JTJ += J * J.transpose() * s[c2];
-            JTr += J * r * s[c2];
-            r2 += r * r * s[c2];
-            r2 += (par * (1.0 - sqrt(s[c2])) * (1.0 - sqrt(s[c2])));
-        }
+            double s = temp * temp;
+
+            J_r[0] << 0, -q(2), q(1), -1, 0, 0;
+            J_r[1] << q(2), 0, -q(0), 0, -1, 0;
+            J_r[2] << -q(1), q(0), 0, 0, 0, -1;
+            for (int k = 0; k < 3; k++) {
+                r[k] = rpq(k);
+                w[k] = s;
+            }
+        };
+        Eigen::Matrix6d JTJ;
+        Eigen::Vector6d JTr;
+        std::tie(JTJ, JTr, std::ignore) = utility::ComputeJTJandJTr6DoF<3>(
+                compute_jacobian_and_residual, (int)corres.size(), false);
+
         bool success;
         Eigen::VectorXd result;
         std::tie(success, result) = utility::SolveLinearSystemPSD(-JTJ, JTr);
@@ -368,3 +383,7 @@ RegistrationResult FastGlobalRegistration(
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
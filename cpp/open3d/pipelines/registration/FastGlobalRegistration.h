@@ -61,20 +61,25 @@ public:
     /// \param iteration_number Maximum number of iterations.
     /// \param tuple_scale Similarity measure used for tuples of feature points.
     /// \param maximum_tuple_count Maximum numer of tuples.
+    /// \param feature_search_checks Number of leaves visited by the
+    /// approximate feature matching with randomized kd-trees. -1 for exact
+    /// matching.
     FastGlobalRegistrationOption(double division_factor = 1.4,
                                  bool use_absolute_scale = false,
                                  bool decrease_mu = true,
                                  double maximum_correspondence_distance = 0.025,
                                  int iteration_number = 64,
                                  double tuple_scale = 0.95,
-                                 int maximum_tuple_count = 1000)
+                                 int maximum_tuple_count = 1000,
+                                 int feature_search_checks = -1)
         : division_factor_(division_factor),
           use_absolute_scale_(use_absolute_scale),
           decrease_mu_(decrease_mu),
           maximum_correspondence_distance_(maximum_correspondence_distance),
           iteration_number_(iteration_number),
           tuple_scale_(tuple_scale),
-          maximum_tuple_count_(maximum_tuple_count) {}
+          maximum_tuple_count_(maximum_tuple_count),
+          feature_search_checks_(feature_search_checks) {}
     ~FastGlobalRegistrationOption() {}
 
 public:
@@ -95,6 +100,9 @@ public:
     double tuple_scale_;
     /// Maximum number of tuples..
     int maximum_tuple_count_;
+    /// Number of leaves visited by the approximate feature matching with
+    /// randomized kd-trees. -1 for exact matching.
+    int feature_search_checks_;
 };
 
 RegistrationResult FastGlobalRegistration(
@@ -31,6 +31,7 @@
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace pipelines {
@@ -112,6 +113,7 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::PointCloud &input,
         const geometry::KDTreeSearchParam
                 &search_param /* = geometry::KDTreeSearchParamKNN()*/) {
+    OPEN3D_PROFILE_SCOPE("registration::ComputeFPFHFeature");
     auto feature = std::make_shared<Feature>();
     feature->Resize(33, (int)input.points_.size());
     if (!input.HasNormals()) {
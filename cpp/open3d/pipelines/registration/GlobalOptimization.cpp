@@ -36,6 +36,7 @@
 #include "open3d/pipelines/registration/PoseGraph.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Eigen.h"
+#include "open3d/utility/Profiler.h"
 #include "open3d/utility/Timer.h"
 
 namespace open3d {
@@ -703,6 +704,7 @@ void GlobalOptimization(PoseGraph &pose_graph,
                         /* = GlobalOptimizationConvergenceCriteria() */,
                         const GlobalOptimizationOption &option
                         /* = GlobalOptimizationOption() */) {
+    OPEN3D_PROFILE_SCOPE("registration::GlobalOptimization");
     if (!ValidatePoseGraph(pose_graph)) return;
     std::shared_ptr<PoseGraph> pose_graph_pre = std::make_shared<PoseGraph>();
     *pose_graph_pre = pose_graph;
@@ -30,6 +30,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+
 namespace open3d {
 namespace pipelines {
 namespace registration {
@@ -211,6 +214,35 @@ public:
     double k_;
 };
 
+// Weights are defined inline, so that calls through the concrete kernel types
+// (see RobustKernelImpl.h) are inlined into the registration inner loops.
+inline double L2Loss::Weight(double /*residual*/) const { return 1.0; }
+
+inline double L1Loss::Weight(double residual) const {
+    return 1.0 / std::abs(residual);
+}
+
+inline double HuberLoss::Weight(double residual) const {
+    const double e = std::abs(residual);
+    return k_ / std::max(e, k_);
+}
+
+inline double CauchyLoss::Weight(double residual) const {
+    const double e = residual / k_;
+    return 1.0 / (1 + e * e);
+}
+
+inline double GMLoss::Weight(double residual) const {
+    const double e = k_ + residual * residual;
+    return k_ / (e * e);
+}
+
+inline double TukeyLoss::Weight(double residual) const {
+    const double e = std::min(1.0, std::abs(residual) / k_);
+    const double s = 1.0 - e * e;
+    return s * s;
+}
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
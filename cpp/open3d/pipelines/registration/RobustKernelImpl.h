@@ -0,0 +1,83 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <typeinfo>
+
+#include "open3d/pipelines/registration/RobustKernel.h"
+
+namespace open3d {
+namespace pipelines {
+namespace registration {
+
+/// Dispatches \p KERNEL (a const RobustKernel reference) to its dynamic type
+/// among the built-in kernels as kernel_t, so that GetWeight<kernel_t> can be
+/// inlined into the accumulation loops. Other kernels, e.g. kernels
+/// implemented in Python, fall back to kernel_t = RobustKernel and virtual
+/// calls.
+#define DISPATCH_ROBUST_KERNEL(KERNEL, ...)                     \
+    [&] {                                                       \
+        const std::type_info &kernel_type = typeid(KERNEL);     \
+        if (kernel_type == typeid(L2Loss)) {                    \
+            using kernel_t = L2Loss;                            \
+            return __VA_ARGS__();                               \
+        } else if (kernel_type == typeid(L1Loss)) {             \
+            using kernel_t = L1Loss;                            \
+            return __VA_ARGS__();                               \
+        } else if (kernel_type == typeid(HuberLoss)) {          \
+            using kernel_t = HuberLoss;                         \
+            return __VA_ARGS__();                               \
+        } else if (kernel_type == typeid(CauchyLoss)) {         \
+            using kernel_t = CauchyLoss;                        \
+            return __VA_ARGS__();                               \
+        } else if (kernel_type == typeid(GMLoss)) {             \
+            using kernel_t = GMLoss;                            \
+            return __VA_ARGS__();                               \
+        } else if (kernel_type == typeid(TukeyLoss)) {          \
+            using kernel_t = TukeyLoss;                         \
+            return __VA_ARGS__();                               \
+        } else {                                                \
+            using kernel_t = RobustKernel;                      \
+            return __VA_ARGS__();                               \
+        }                                                       \
+    }()
+
+/// Weight of \p residual under \p kernel, whose dynamic type is kernel_t.
+template <typename kernel_t>
+inline double GetWeight(const RobustKernel &kernel, double residual) {
+    return static_cast<const kernel_t &>(kernel).kernel_t::Weight(residual);
+}
+
+template <>
+inline double GetWeight<RobustKernel>(const RobustKernel &kernel,
+                                      double residual) {
+    return kernel.Weight(residual);
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace open3d
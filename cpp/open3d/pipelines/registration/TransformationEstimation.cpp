@@ -29,6 +29,7 @@
 #include <Eigen/Geometry>
 
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/pipelines/registration/RobustKernelImpl.h"
 #include "open3d/utility/Eigen.h"
 
 namespace open3d {
@@ -82,23 +83,23 @@ Eigen::Matrix4d TransformationEstimationPointToPlane::ComputeTransformation(
     if (corres.empty() || !target.HasNormals())
         return Eigen::Matrix4d::Identity();
 
-    auto compute_jacobian_and_residual = [&](int i, Eigen::Vector6d &J_r,
-                                             double &r, double &w) {
-        const Eigen::Vector3d &vs = source.points_[corres[i][0]];
-        const Eigen::Vector3d &vt = target.points_[corres[i][1]];
-        const Eigen::Vector3d &nt = target.normals_[corres[i][1]];
-        r = (vs - vt).dot(nt);
-        w = kernel_->Weight(r);
-        J_r.block<3, 1>(0, 0) = vs.cross(nt);
-        J_r.block<3, 1>(3, 0) = nt;
-    };
-
     Eigen::Matrix6d JTJ;
     Eigen::Vector6d JTr;
     double r2;
-    std::tie(JTJ, JTr, r2) =
-            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                    compute_jacobian_and_residual, (int)corres.size());
+    DISPATCH_ROBUST_KERNEL(*kernel_, [&]() {
+        auto compute_jacobian_and_residual = [&](int i, Eigen::Vector6d *J_r,
+                                                 double *r, double *w) {
+            const Eigen::Vector3d &vs = source.points_[corres[i][0]];
+            const Eigen::Vector3d &vt = target.points_[corres[i][1]];
+            const Eigen::Vector3d &nt = target.normals_[corres[i][1]];
+            r[0] = (vs - vt).dot(nt);
+            w[0] = GetWeight<kernel_t>(*kernel_, r[0]);
+            J_r[0].block<3, 1>(0, 0) = vs.cross(nt);
+            J_r[0].block<3, 1>(3, 0) = nt;
+        };
+        std::tie(JTJ, JTr, r2) = utility::ComputeJTJandJTr6DoF<1>(
+                compute_jacobian_and_residual, (int)corres.size());
+    });
 
     bool is_success;
     Eigen::Matrix4d extrinsic;
@@ -0,0 +1,110 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/Distance.h"
+
+#include <vector>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/utility/Profiler.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace distance {
+
+namespace {
+
+open3d::geometry::PointCloud ToLegacyPoints(const PointCloud &pcd) {
+    open3d::geometry::PointCloud pcd_legacy;
+    if (pcd.HasPoints()) {
+        pcd_legacy.points_ = core::eigen_converter::TensorToEigenVector3dVector(
+                pcd.GetPoints());
+    }
+    return pcd_legacy;
+}
+
+open3d::geometry::TriangleMesh ToLegacyTriangles(const TriangleMesh &mesh) {
+    open3d::geometry::TriangleMesh mesh_legacy;
+    if (mesh.HasVertices()) {
+        mesh_legacy.vertices_ =
+                core::eigen_converter::TensorToEigenVector3dVector(
+                        mesh.GetVertices());
+    }
+    if (mesh.HasTriangles()) {
+        mesh_legacy.triangles_ =
+                core::eigen_converter::TensorToEigenVector3iVector(
+                        mesh.GetTriangles());
+    }
+    return mesh_legacy;
+}
+
+}  // unnamed namespace
+
+core::Tensor ComputePointCloudDistance(const PointCloud &source,
+                                       const PointCloud &target,
+                                       double max_distance) {
+    OPEN3D_PROFILE_SCOPE("distance::ComputePointCloudDistance");
+    const std::vector<double> distances =
+            ToLegacyPoints(source).ComputePointCloudDistance(
+                    ToLegacyPoints(target), max_distance);
+    return core::Tensor(distances, {int64_t(distances.size())},
+                        core::Dtype::Float64, source.GetDevice());
+}
+
+core::Tensor ComputeTriangleMeshDistance(const PointCloud &source,
+                                         const TriangleMesh &target,
+                                         double max_distance) {
+    OPEN3D_PROFILE_SCOPE("distance::ComputeTriangleMeshDistance");
+    const std::vector<double> distances =
+            ToLegacyPoints(source).ComputeTriangleMeshDistance(
+                    ToLegacyTriangles(target), max_distance);
+    return core::Tensor(distances, {int64_t(distances.size())},
+                        core::Dtype::Float64, source.GetDevice());
+}
+
+open3d::geometry::DistanceSummary ComputeDistanceSummary(
+        const PointCloud &source,
+        const PointCloud &target,
+        double max_distance) {
+    OPEN3D_PROFILE_SCOPE("distance::ComputeDistanceSummary");
+    return open3d::geometry::ComputeDistanceSummary(
+            ToLegacyPoints(source), ToLegacyPoints(target), max_distance);
+}
+
+open3d::geometry::DistanceSummary ComputeDistanceSummary(
+        const PointCloud &source,
+        const TriangleMesh &target,
+        double max_distance) {
+    OPEN3D_PROFILE_SCOPE("distance::ComputeDistanceSummary");
+    return open3d::geometry::ComputeDistanceSummary(
+            ToLegacyPoints(source), ToLegacyTriangles(target), max_distance);
+}
+
+}  // namespace distance
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
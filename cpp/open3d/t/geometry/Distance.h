@@ -0,0 +1,87 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/Distance.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace distance {
+
+// These functions wrap the legacy implementations. The points and triangles
+// are copied from the tensors into legacy Eigen vectors on the host, and the
+// per-point distances are copied back into a tensor on the device of the
+// source, so each call costs one copy of the inputs and of the results.
+
+/// \brief Function to compute the distance from each point of \p source to
+/// its nearest point in \p target. Distances are computed on CPU as in
+/// open3d::geometry::PointCloud::ComputePointCloudDistance.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param max_distance If positive, the search is bounded by this distance,
+/// and larger distances are reported as max_distance.
+/// \return Float64 Tensor of shape {N,} on the device of \p source.
+core::Tensor ComputePointCloudDistance(const PointCloud &source,
+                                       const PointCloud &target,
+                                       double max_distance = 0.0);
+
+/// \brief Function to compute the distance from each point of \p source to
+/// the closest point on the triangles of \p target, with the bounding volume
+/// hierarchy of open3d::geometry::PointCloud::ComputeTriangleMeshDistance.
+///
+/// \param source The source point cloud.
+/// \param target The target triangle mesh.
+/// \param max_distance If positive, the search is bounded by this distance,
+/// and larger distances are reported as max_distance.
+/// \return Float64 Tensor of shape {N,} on the device of \p source.
+core::Tensor ComputeTriangleMeshDistance(const PointCloud &source,
+                                         const TriangleMesh &target,
+                                         double max_distance = 0.0);
+
+/// \brief Function to compute the Hausdorff and Chamfer distances between two
+/// point clouds. See open3d::geometry::ComputeDistanceSummary.
+open3d::geometry::DistanceSummary ComputeDistanceSummary(
+        const PointCloud &source,
+        const PointCloud &target,
+        double max_distance = 0.0);
+
+/// \brief Function to compute the Hausdorff and Chamfer distances between a
+/// point cloud and a mesh. See open3d::geometry::ComputeDistanceSummary.
+open3d::geometry::DistanceSummary ComputeDistanceSummary(
+        const PointCloud &source,
+        const TriangleMesh &target,
+        double max_distance = 0.0);
+
+}  // namespace distance
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
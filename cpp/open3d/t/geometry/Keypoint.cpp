@@ -0,0 +1,78 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/Keypoint.h"
+
+#include <vector>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/Keypoint.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Profiler.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace keypoint {
+
+PointCloud ComputeISSKeypoints(const PointCloud &input,
+                               double salient_radius,
+                               double non_max_radius,
+                               double gamma_21,
+                               double gamma_32,
+                               int min_neighbors,
+                               size_t max_cache_bytes) {
+    OPEN3D_PROFILE_SCOPE("keypoint::ComputeISSKeypoints");
+    const core::Device device = input.GetDevice();
+    if (!input.HasPoints() || input.GetPoints().GetLength() == 0) {
+        utility::LogWarning("[ComputeISSKeypoints] Input PointCloud is empty!");
+        return PointCloud(device);
+    }
+
+    open3d::geometry::PointCloud pcd_legacy;
+    pcd_legacy.points_ = core::eigen_converter::TensorToEigenVector3dVector(
+            input.GetPoints());
+    const std::vector<size_t> kp_indices =
+            open3d::geometry::keypoint::ComputeISSKeypointIndices(
+                    pcd_legacy, salient_radius, non_max_radius, gamma_21,
+                    gamma_32, min_neighbors, max_cache_bytes);
+
+    const std::vector<int64_t> indices(kp_indices.begin(), kp_indices.end());
+    const core::Tensor index(indices, {(int64_t)indices.size()},
+                             core::Dtype::Int64, device);
+    PointCloud output(device);
+    for (const auto &kv : input.GetPointAttr()) {
+        output.SetPointAttr(kv.first, kv.second.IndexGet({index}));
+    }
+    return output;
+}
+
+}  // namespace keypoint
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -37,6 +37,7 @@
 #include "open3d/core/linalg/Matmul.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/geometry/kernel/PointCloud.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace t {
@@ -148,12 +149,71 @@ PointCloud &PointCloud::Rotate(const core::Tensor &R,
     return *this;
 }
 
+std::unordered_map<std::string, core::Tensor>
+PointCloud::ComputeClusterStatistics(const core::Tensor &labels) const {
+    labels.AssertShape({GetPoints().GetLength()});
+    if (labels.GetDtype() != core::Dtype::Int32 &&
+        labels.GetDtype() != core::Dtype::Int64) {
+        utility::LogError("Labels must be Int32 or Int64, but got {}.",
+                          labels.GetDtype().ToString());
+    }
+    std::vector<int> labels_vec =
+            labels.To(core::Dtype::Int32).ToFlatVector<int>();
+
+    open3d::geometry::PointCloud pcd_legacy;
+    pcd_legacy.points_ =
+            core::eigen_converter::TensorToEigenVector3dVector(GetPoints());
+    const open3d::geometry::ClusterStatistics stats =
+            pcd_legacy.ComputeClusterStatistics(labels_vec);
+
+    const int64_t num_labels = int64_t(stats.counts_.size());
+    std::vector<int64_t> counts(stats.counts_.begin(), stats.counts_.end());
+    std::vector<double> centroids(num_labels * 3), covariances(num_labels * 9),
+            min_bounds(num_labels * 3), max_bounds(num_labels * 3),
+            obb_centers(num_labels * 3), obb_rotations(num_labels * 9),
+            obb_extents(num_labels * 3);
+    for (int64_t l = 0; l < num_labels; l++) {
+        const auto &aabb = stats.axis_aligned_bounding_boxes_[l];
+        const auto &obb = stats.oriented_bounding_boxes_[l];
+        for (int i = 0; i < 3; i++) {
+            centroids[l * 3 + i] = stats.centroids_[l](i);
+            min_bounds[l * 3 + i] = aabb.min_bound_(i);
+            max_bounds[l * 3 + i] = aabb.max_bound_(i);
+            obb_centers[l * 3 + i] = obb.center_(i);
+            obb_extents[l * 3 + i] = obb.extent_(i);
+            for (int j = 0; j < 3; j++) {
+                covariances[l * 9 + i * 3 + j] = stats.covariances_[l](i, j);
+                obb_rotations[l * 9 + i * 3 + j] = obb.R_(i, j);
+            }
+        }
+    }
+
+    const core::Dtype dtype = core::Dtype::Float64;
+    return {{"counts",
+             core::Tensor(counts, {num_labels}, core::Dtype::Int64, device_)},
+            {"centroids",
+             core::Tensor(centroids, {num_labels, 3}, dtype, device_)},
+            {"covariances",
+             core::Tensor(covariances, {num_labels, 3, 3}, dtype, device_)},
+            {"min_bounds",
+             core::Tensor(min_bounds, {num_labels, 3}, dtype, device_)},
+            {"max_bounds",
+             core::Tensor(max_bounds, {num_labels, 3}, dtype, device_)},
+            {"obb_centers",
+             core::Tensor(obb_centers, {num_labels, 3}, dtype, device_)},
+            {"obb_rotations",
+             core::Tensor(obb_rotations, {num_labels, 3, 3}, dtype, device_)},
+            {"obb_extents",
+             core::Tensor(obb_extents, {num_labels, 3}, dtype, device_)}};
+}
+
 PointCloud PointCloud::CreateFromDepthImage(const Image &depth,
                                             const core::Tensor &intrinsics,
                                             const core::Tensor &extrinsics,
                                             float depth_scale,
                                             float depth_max,
                                             int stride) {
+    OPEN3D_PROFILE_SCOPE("t::geometry::PointCloud::CreateFromDepthImage");
     depth.AsTensor().AssertDtype(core::Dtype::UInt16);
 
     core::Tensor points;
@@ -295,6 +295,21 @@ public:
     /// \brief Returns the device attribute of this PointCloud.
     core::Device GetDevice() const { return device_; }
 
+    /// \brief Computes the count, centroid, covariance, axis aligned and
+    /// oriented bounding box of the points of each label in parallel,
+    /// without extracting the clusters.
+    ///
+    /// \param labels Int32 or Int64 tensor of shape {N}, one label per point.
+    /// Negative labels (noise) are ignored.
+    /// \return Float64 tensors (Int64 for "counts") on the point cloud
+    /// device, indexed by label from 0 to the largest label: "counts" {L},
+    /// "centroids" {L, 3}, "covariances" {L, 3, 3}, "min_bounds" and
+    /// "max_bounds" {L, 3}, and "obb_centers" {L, 3}, "obb_rotations"
+    /// {L, 3, 3} and "obb_extents" {L, 3} for the oriented bounding boxes
+    /// along the principal axes.
+    std::unordered_map<std::string, core::Tensor> ComputeClusterStatistics(
+            const core::Tensor &labels) const;
+
     /// \brief Factory function to create a pointcloud from a depth image and a
     /// camera model.
     ///
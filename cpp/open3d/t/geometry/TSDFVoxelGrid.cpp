@@ -26,15 +26,176 @@
 
 #include "open3d/t/geometry/TSDFVoxelGrid.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+
 #include "open3d/Open3D.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/kernel/CPULauncher.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/kernel/TSDFVoxelGrid.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace t {
 namespace geometry {
 
+namespace {
+// Binary TSDFVoxelGrid file layout (native endianness):
+// - Header: magic, version, attribute count, voxel_size, sdf_trunc,
+// block_resolution, block_count, number of blocks, then (name, dtype) of
+// each attribute as 16-byte zero padded strings, in the voxel order.
+// - Block keys: (n, 3) Int32.
+// - One column per attribute: (n, resolution^3, channels) of its dtype.
+// Sections start at kSectionAlignment-byte offsets so that columns can be
+// used in place from a memory mapped file.
+const char kMagic[8] = {'O', '3', 'D', 'T', 'S', 'D', 'F', '\0'};
+const int32_t kVersion = 1;
+const int64_t kNameLength = 16;
+const int64_t kSectionAlignment = 64;
+
+struct FileHeader {
+    char magic[8];
+    int32_t version;
+    int32_t num_attrs;
+    float voxel_size;
+    float sdf_trunc;
+    int64_t block_resolution;
+    int64_t block_count;
+    int64_t num_blocks;
+};
+
+int64_t AlignSection(int64_t offset) {
+    return (offset + kSectionAlignment - 1) / kSectionAlignment *
+           kSectionAlignment;
+}
+
+// Attributes in the order they are laid out in a voxel, with the number of
+// channels for each of them.
+std::vector<std::pair<std::string, int64_t>> VoxelAttributes(
+        const std::unordered_map<std::string, core::Dtype> &attr_dtype_map) {
+    std::vector<std::pair<std::string, int64_t>> attrs = {{"tsdf", 1},
+                                                          {"weight", 1}};
+    if (attr_dtype_map.count("color") != 0) {
+        attrs.emplace_back("color", 3);
+    }
+    return attrs;
+}
+
+core::Dtype DtypeFromString(const std::string &name) {
+    for (const core::Dtype &dtype :
+         {core::Dtype::Float32, core::Dtype::Float64, core::Dtype::Int32,
+          core::Dtype::Int64, core::Dtype::UInt8, core::Dtype::UInt16,
+          core::Dtype::Bool}) {
+        if (dtype.ToString() == name) {
+            return dtype;
+        }
+    }
+    utility::LogError("[TSDFVoxelGrid] unknown dtype {}.", name);
+}
+
+// Copy bytes [byte_offset, byte_offset + byte_size) of every voxel in the
+// blocks at \p block_indices of an interleaved voxel buffer to a packed column.
+void GatherColumn(const uint8_t *voxels,
+                  const std::vector<int64_t> &block_indices,
+                  int64_t block_voxels,
+                  int64_t voxel_bytes,
+                  int64_t byte_offset,
+                  int64_t byte_size,
+                  uint8_t *column) {
+    const int64_t *indices_ptr = block_indices.data();
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            static_cast<int64_t>(block_indices.size()), [&](int64_t b) {
+                int64_t block_bytes = block_voxels * voxel_bytes;
+                const uint8_t *src =
+                        voxels + indices_ptr[b] * block_bytes + byte_offset;
+                uint8_t *dst = column + b * block_voxels * byte_size;
+                for (int64_t v = 0; v < block_voxels; ++v) {
+                    std::memcpy(dst + v * byte_size, src + v * voxel_bytes,
+                                byte_size);
+                }
+            });
+}
+
+// Inverse of GatherColumn for contiguous blocks.
+void ScatterColumn(const uint8_t *column,
+                   int64_t num_blocks,
+                   int64_t block_voxels,
+                   int64_t voxel_bytes,
+                   int64_t byte_offset,
+                   int64_t byte_size,
+                   uint8_t *voxels) {
+    core::kernel::CPULauncher::LaunchGeneralKernel(num_blocks, [&](int64_t b) {
+        const uint8_t *src = column + b * block_voxels * byte_size;
+        uint8_t *dst = voxels + b * block_voxels * voxel_bytes + byte_offset;
+        for (int64_t v = 0; v < block_voxels; ++v) {
+            std::memcpy(dst + v * voxel_bytes, src + v * byte_size, byte_size);
+        }
+    });
+}
+
+// Read-only view of a whole file as a CPU blob. The file is memory mapped when
+// supported, and read into memory otherwise.
+std::shared_ptr<core::Blob> MapFile(const std::string &file_name,
+                                    int64_t &file_size) {
+    core::Device host("CPU:0");
+#ifndef _WIN32
+    int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0) {
+        utility::LogError("[TSDFVoxelGrid] unable to open file {}.",
+                          file_name);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        utility::LogError("[TSDFVoxelGrid] unable to stat file {}.",
+                          file_name);
+    }
+    file_size = static_cast<int64_t>(st.st_size);
+    if (file_size == 0) {
+        close(fd);
+        utility::LogError("[TSDFVoxelGrid] file {} is empty.", file_name);
+    }
+    void *data = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        utility::LogError("[TSDFVoxelGrid] unable to map file {}.", file_name);
+    }
+    size_t length = static_cast<size_t>(file_size);
+    return std::make_shared<core::Blob>(
+            host, data, [data, length](void *) { munmap(data, length); });
+#else
+    FILE *fp = utility::filesystem::FOpen(file_name, "rb");
+    if (fp == nullptr) {
+        utility::LogError("[TSDFVoxelGrid] unable to open file {}.",
+                          file_name);
+    }
+    fseek(fp, 0, SEEK_END);
+    file_size = static_cast<int64_t>(ftell(fp));
+    fseek(fp, 0, SEEK_SET);
+    auto blob = std::make_shared<core::Blob>(file_size, host);
+    size_t read = fread(blob->GetDataPtr(), 1, file_size, fp);
+    fclose(fp);
+    if (static_cast<int64_t>(read) != file_size) {
+        utility::LogError("[TSDFVoxelGrid] unable to read file {}.",
+                          file_name);
+    }
+    return blob;
+#endif
+}
+}  // namespace
+
 TSDFVoxelGrid::TSDFVoxelGrid(
         std::unordered_map<std::string, core::Dtype> attr_dtype_map,
         float voxel_size,
@@ -55,39 +216,42 @@ TSDFVoxelGrid::TSDFVoxelGrid(
                 "missing.");
     }
 
-    int64_t total_bytes = 0;
-    if (attr_dtype_map_.count("tsdf") != 0) {
-        core::Dtype dtype = attr_dtype_map_.at("tsdf");
-        if (dtype != core::Dtype::Float32) {
-            utility::LogWarning(
-                    "[TSDFVoxelGrid] unexpected TSDF dtype, please "
-                    "implement your own Voxel structure in "
-                    "core/kernel/GeneralEWSharedImpl.h for dispatching.");
-        }
-        total_bytes += dtype.ByteSize();
-    }
+    // Voxels are reinterpreted as compile-time specialized structures in
+    // kernel/TSDFVoxelGridShared.h, chosen by the layout below.
+    core::Dtype tsdf_dtype = attr_dtype_map_.at("tsdf");
+    core::Dtype weight_dtype = attr_dtype_map_.at("weight");
+    bool has_color = attr_dtype_map_.count("color") != 0;
+    core::Dtype color_dtype =
+            has_color ? attr_dtype_map_.at("color") : core::Dtype::Undefined;
 
-    if (attr_dtype_map_.count("weight") != 0) {
-        core::Dtype dtype = attr_dtype_map_.at("weight");
-        if (dtype != core::Dtype::Float32 && dtype != core::Dtype::UInt16) {
-            utility::LogWarning(
-                    "[TSDFVoxelGrid] unexpected weight dtype, please "
-                    "implement your own Voxel structure in "
-                    "core/kernel/GeneralEWSharedImpl.h for "
-                    "dispatching.");
-        }
-        total_bytes += dtype.ByteSize();
+    auto IsLayout = [&](core::Dtype tsdf, core::Dtype weight,
+                        core::Dtype color) {
+        return tsdf_dtype == tsdf && weight_dtype == weight &&
+               color_dtype == color;
+    };
+    const core::Dtype kNoColor = core::Dtype::Undefined;
+    if (!IsLayout(core::Dtype::Float32, core::Dtype::Float32, kNoColor) &&
+        !IsLayout(core::Dtype::UInt16, core::Dtype::UInt16, kNoColor) &&
+        !IsLayout(core::Dtype::Float32, core::Dtype::Float32,
+                  core::Dtype::Float32) &&
+        !IsLayout(core::Dtype::Float32, core::Dtype::UInt16,
+                  core::Dtype::UInt16) &&
+        !IsLayout(core::Dtype::UInt16, core::Dtype::UInt8,
+                  core::Dtype::UInt8)) {
+        utility::LogError(
+                "[TSDFVoxelGrid] unsupported voxel layout (tsdf: {}, weight: "
+                "{}, color: {}). Supported (tsdf, weight[, color]) layouts "
+                "are (Float32, Float32), (UInt16, UInt16), (Float32, Float32, "
+                "Float32), (Float32, UInt16, UInt16) and (UInt16, UInt8, "
+                "UInt8). Please implement your own Voxel structure in "
+                "t/geometry/kernel/TSDFVoxelGridShared.h for other layouts.",
+                tsdf_dtype.ToString(), weight_dtype.ToString(),
+                has_color ? color_dtype.ToString() : "None");
     }
 
-    if (attr_dtype_map_.count("color") != 0) {
-        core::Dtype dtype = attr_dtype_map_.at("color");
-        if (dtype != core::Dtype::Float32 && dtype != core::Dtype::UInt16) {
-            utility::LogWarning(
-                    "[TSDFVoxelGrid] unexpected color dtype, please "
-                    "implement your own Voxel structure in "
-                    "core/kernel/GeneralEWSharedImpl.h for dispatching.");
-        }
-        total_bytes += dtype.ByteSize() * 3;
+    int64_t total_bytes = tsdf_dtype.ByteSize() + weight_dtype.ByteSize();
+    if (has_color) {
+        total_bytes += color_dtype.ByteSize() * 3;
     }
     // Users can add other key/dtype checkers here for potential extensions.
 
@@ -123,6 +287,7 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
                               const core::Tensor &extrinsics,
                               float depth_scale,
                               float depth_max) {
+    OPEN3D_PROFILE_SCOPE("t::geometry::TSDFVoxelGrid::Integrate");
     if (depth.IsEmpty()) {
         utility::LogError(
                 "[TSDFVoxelGrid] input depth is empty for integration.");
@@ -187,7 +352,125 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
                             sdf_trunc_, depth_scale, depth_max);
 }
 
+void TSDFVoxelGrid::IntegrateBatch(const std::vector<Image> &depths,
+                                   const std::vector<Image> &colors,
+                                   const core::Tensor &intrinsics,
+                                   const std::vector<core::Tensor> &extrinsics,
+                                   float depth_scale,
+                                   float depth_max) {
+    OPEN3D_PROFILE_SCOPE("t::geometry::TSDFVoxelGrid::IntegrateBatch");
+    int64_t num_frames = static_cast<int64_t>(depths.size());
+    if (num_frames == 0) {
+        utility::LogWarning("[TSDFIntegrateBatch] no frames to integrate.");
+        return;
+    }
+    if (static_cast<int64_t>(extrinsics.size()) != num_frames) {
+        utility::LogError(
+                "[TSDFIntegrateBatch] expected {} extrinsics, but got {}.",
+                num_frames, extrinsics.size());
+    }
+    bool integrate_color = !colors.empty();
+    if (integrate_color && static_cast<int64_t>(colors.size()) != num_frames) {
+        utility::LogError(
+                "[TSDFIntegrateBatch] expected {} color images, but got {}.",
+                num_frames, colors.size());
+    }
+    if (integrate_color && attr_dtype_map_.count("color") == 0) {
+        utility::LogWarning(
+                "[TSDFIntegrateBatch] color images are ignored since voxels "
+                "do not contain colors.");
+        integrate_color = false;
+    }
+
+    int64_t rows = depths[0].GetRows();
+    int64_t cols = depths[0].GetCols();
+    for (int64_t i = 0; i < num_frames; ++i) {
+        if (depths[i].IsEmpty()) {
+            utility::LogError(
+                    "[TSDFIntegrateBatch] input depth {} is empty for "
+                    "integration.",
+                    i);
+        }
+        if (depths[i].GetRows() != rows || depths[i].GetCols() != cols ||
+            depths[i].GetChannels() != 1) {
+            utility::LogError(
+                    "[TSDFIntegrateBatch] depth {} has an incompatible shape.",
+                    i);
+        }
+        if (integrate_color &&
+            (colors[i].GetRows() != rows || colors[i].GetCols() != cols ||
+             colors[i].GetChannels() != 3)) {
+            utility::LogError(
+                    "[TSDFIntegrateBatch] color {} has an incompatible shape.",
+                    i);
+        }
+    }
+
+    // Stack the inputs, and collect the rough surface points of all the frames
+    // so that blocks are touched and activated once.
+    core::Tensor depth_tensor({num_frames, rows, cols, 1}, core::Dtype::Float32,
+                              device_);
+    core::Tensor color_tensor;
+    if (integrate_color) {
+        color_tensor = core::Tensor({num_frames, rows, cols, 3},
+                                    core::Dtype::Float32, device_);
+    }
+    core::Tensor extrinsics_tensor({num_frames, 4, 4}, core::Dtype::Float32,
+                                   device_);
+
+    std::vector<core::Tensor> frame_points(num_frames);
+    int64_t num_points = 0;
+    for (int64_t i = 0; i < num_frames; ++i) {
+        depth_tensor[i] = depths[i].AsTensor().To(core::Dtype::Float32);
+        if (integrate_color) {
+            color_tensor[i] = colors[i].AsTensor().To(core::Dtype::Float32);
+        }
+        extrinsics_tensor[i] = extrinsics[i].To(device_, core::Dtype::Float32);
+
+        frame_points[i] = PointCloud::CreateFromDepthImage(
+                                  depths[i], intrinsics, extrinsics[i],
+                                  depth_scale, depth_max, 4)
+                                  .GetPoints();
+        num_points += frame_points[i].GetLength();
+    }
+
+    core::Tensor points({num_points, 3}, core::Dtype::Float32, device_);
+    int64_t offset = 0;
+    for (const core::Tensor &frame_point : frame_points) {
+        int64_t n = frame_point.GetLength();
+        points.Slice(0, offset, offset + n) = frame_point;
+        offset += n;
+    }
+    frame_points.clear();
+
+    core::Tensor block_coords;
+    kernel::tsdf::Touch(points, block_coords, block_resolution_, voxel_size_,
+                        sdf_trunc_);
+
+    core::Tensor addrs, masks;
+    int64_t n = block_hashmap_->Size();
+    try {
+        block_hashmap_->Activate(block_coords, addrs, masks);
+    } catch (const std::runtime_error &) {
+        utility::LogError(
+                "[TSDFIntegrateBatch] Unable to allocate volume during "
+                "rehashing. Consider using a larger block_count at "
+                "initialization to avoid rehashing (currently {}), or "
+                "choosing a larger voxel_size (currently {})",
+                n, voxel_size_);
+    }
+    block_hashmap_->Find(block_coords, addrs, masks);
+
+    core::Tensor dst = block_hashmap_->GetValueTensor();
+    kernel::tsdf::IntegrateBatch(
+            depth_tensor, color_tensor,
+            addrs.To(core::Dtype::Int64).IndexGet({masks}),
+            block_hashmap_->GetKeyTensor(), dst, intrinsics, extrinsics_tensor,
+            block_resolution_, voxel_size_, sdf_trunc_, depth_scale, depth_max);
+}
+
 PointCloud TSDFVoxelGrid::ExtractSurfacePoints(float weight_threshold) {
+    OPEN3D_PROFILE_SCOPE("t::geometry::TSDFVoxelGrid::ExtractSurfacePoints");
     // Extract active voxel blocks from the hashmap.
     core::Tensor active_addrs;
     block_hashmap_->GetActiveIndices(active_addrs);
@@ -213,6 +496,7 @@ PointCloud TSDFVoxelGrid::ExtractSurfacePoints(float weight_threshold) {
 }
 
 TriangleMesh TSDFVoxelGrid::ExtractSurfaceMesh(float weight_threshold) {
+    OPEN3D_PROFILE_SCOPE("t::geometry::TSDFVoxelGrid::ExtractSurfaceMesh");
     // Query active blocks and their nearest neighbors to handle boundary cases.
     core::Tensor active_addrs;
     block_hashmap_->GetActiveIndices(active_addrs);
@@ -246,6 +530,263 @@ TriangleMesh TSDFVoxelGrid::ExtractSurfaceMesh(float weight_threshold) {
     return mesh;
 }
 
+std::unordered_map<std::string, core::Tensor> TSDFVoxelGrid::RayCast(
+        const core::Tensor &intrinsics,
+        const core::Tensor &extrinsics,
+        int width,
+        int height,
+        float depth_scale,
+        float depth_min,
+        float depth_max,
+        float weight_threshold) {
+    OPEN3D_PROFILE_SCOPE("t::geometry::TSDFVoxelGrid::RayCast");
+    core::Tensor active_addrs;
+    block_hashmap_->GetActiveIndices(active_addrs);
+
+    core::Tensor vertex_map, depth_map, color_map, normal_map;
+    kernel::tsdf::RayCast(
+            active_addrs.To(core::Dtype::Int64),
+            block_hashmap_->GetKeyTensor(), block_hashmap_->GetValueTensor(),
+            vertex_map, depth_map, color_map, normal_map, intrinsics,
+            extrinsics, height, width, block_resolution_, voxel_size_,
+            sdf_trunc_, depth_scale, depth_min, depth_max, weight_threshold);
+
+    std::unordered_map<std::string, core::Tensor> result{
+            {"vertex", vertex_map},
+            {"depth", depth_map},
+            {"normal", normal_map}};
+    if (color_map.NumElements() != 0) {
+        result["color"] = color_map;
+    }
+    return result;
+}
+
+void TSDFVoxelGrid::Save(const std::string &file_name) const {
+    OPEN3D_PROFILE_SCOPE("t::geometry::TSDFVoxelGrid::Save");
+    core::Device host("CPU:0");
+
+    core::Tensor active_addrs;
+    block_hashmap_->GetActiveIndices(active_addrs);
+    active_addrs = active_addrs.To(core::Dtype::Int64);
+    int64_t num_blocks = active_addrs.GetLength();
+
+    core::Tensor keys = block_hashmap_->GetKeyTensor()
+                                .IndexGet({active_addrs})
+                                .To(host)
+                                .Contiguous();
+
+    // Voxels of the active blocks are read in place on CPU, and gathered on
+    // the device before being copied to host otherwise.
+    core::Tensor values = block_hashmap_->GetValueTensor();
+    std::vector<int64_t> block_indices(num_blocks);
+    if (device_.GetType() == core::Device::DeviceType::CPU) {
+        block_indices = active_addrs.ToFlatVector<int64_t>();
+    } else {
+        values = values.IndexGet({active_addrs}).To(host);
+        std::iota(block_indices.begin(), block_indices.end(), 0);
+    }
+    values = values.Contiguous();
+    const uint8_t *values_ptr =
+            static_cast<const uint8_t *>(values.GetDataPtr());
+    int64_t block_voxels =
+            block_resolution_ * block_resolution_ * block_resolution_;
+    int64_t voxel_bytes = values.GetShape()[4];
+
+    FileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    auto attrs = VoxelAttributes(attr_dtype_map_);
+    header.num_attrs = static_cast<int32_t>(attrs.size());
+    header.voxel_size = voxel_size_;
+    header.sdf_trunc = sdf_trunc_;
+    header.block_resolution = block_resolution_;
+    header.block_count = block_count_;
+    header.num_blocks = num_blocks;
+
+    FILE *fp = utility::filesystem::FOpen(file_name, "wb");
+    if (fp == nullptr) {
+        utility::LogError("[TSDFVoxelGrid] unable to open file {}.",
+                          file_name);
+    }
+
+    int64_t offset = 0;
+    bool ok = true;
+    auto write = [&](const void *data, int64_t byte_size) {
+        if (byte_size > 0 && ok) {
+            ok = fwrite(data, 1, byte_size, fp) ==
+                 static_cast<size_t>(byte_size);
+        }
+        offset += byte_size;
+    };
+    auto pad = [&]() {
+        static const char zeros[kSectionAlignment] = {0};
+        write(zeros, AlignSection(offset) - offset);
+    };
+
+    write(&header, sizeof(header));
+    for (const auto &attr : attrs) {
+        char name[kNameLength] = {0}, dtype[kNameLength] = {0};
+        std::strncpy(name, attr.first.c_str(), kNameLength - 1);
+        std::strncpy(dtype, attr_dtype_map_.at(attr.first).ToString().c_str(),
+                     kNameLength - 1);
+        write(name, kNameLength);
+        write(dtype, kNameLength);
+    }
+    pad();
+    write(keys.GetDataPtr(), keys.NumElements() * keys.GetDtype().ByteSize());
+
+    // Split voxels into attribute columns in parallel, one column at a time.
+    std::vector<uint8_t> column;
+    int64_t byte_offset = 0;
+    for (const auto &attr : attrs) {
+        int64_t byte_size =
+                attr_dtype_map_.at(attr.first).ByteSize() * attr.second;
+        column.resize(num_blocks * block_voxels * byte_size);
+        GatherColumn(values_ptr, block_indices, block_voxels, voxel_bytes,
+                     byte_offset, byte_size, column.data());
+        pad();
+        write(column.data(), static_cast<int64_t>(column.size()));
+        byte_offset += byte_size;
+    }
+    fclose(fp);
+
+    if (!ok) {
+        utility::LogError("[TSDFVoxelGrid] unable to write file {}.",
+                          file_name);
+    }
+}
+
+TSDFVoxelGrid TSDFVoxelGrid::Load(const std::string &file_name,
+                                  const core::Device &device) {
+    OPEN3D_PROFILE_SCOPE("t::geometry::TSDFVoxelGrid::Load");
+    int64_t file_size = 0;
+    std::shared_ptr<core::Blob> blob = MapFile(file_name, file_size);
+    char *data = static_cast<char *>(blob->GetDataPtr());
+
+    FileHeader header;
+    if (file_size < static_cast<int64_t>(sizeof(header))) {
+        utility::LogError("[TSDFVoxelGrid] {} is truncated.", file_name);
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+        utility::LogError("[TSDFVoxelGrid] {} is not a TSDFVoxelGrid file.",
+                          file_name);
+    }
+    if (header.version != kVersion) {
+        utility::LogError("[TSDFVoxelGrid] unsupported file version {}.",
+                          header.version);
+    }
+
+    int64_t offset = sizeof(header);
+    if (header.num_attrs < 0 ||
+        file_size < offset + 2 * kNameLength * header.num_attrs) {
+        utility::LogError("[TSDFVoxelGrid] {} is truncated.", file_name);
+    }
+    std::unordered_map<std::string, core::Dtype> attr_dtype_map;
+    std::vector<std::string> attr_names;
+    for (int32_t i = 0; i < header.num_attrs; ++i) {
+        std::string name(data + offset, strnlen(data + offset, kNameLength));
+        offset += kNameLength;
+        std::string dtype(data + offset, strnlen(data + offset, kNameLength));
+        offset += kNameLength;
+        attr_dtype_map[name] = DtypeFromString(dtype);
+        attr_names.push_back(name);
+    }
+
+    auto attrs = VoxelAttributes(attr_dtype_map);
+    for (size_t i = 0; i < attrs.size(); ++i) {
+        if (i >= attr_names.size() || attrs[i].first != attr_names[i]) {
+            utility::LogError("[TSDFVoxelGrid] unexpected attribute order.");
+        }
+    }
+
+    // Check the header against the file size before anything is allocated.
+    // Every block takes at least resolution^3 bytes, which bounds the sizes
+    // below and keeps them from overflowing.
+    int64_t num_blocks = header.num_blocks;
+    int64_t resolution = header.block_resolution;
+    if (num_blocks < 0 || header.block_count < 0 || resolution <= 0) {
+        utility::LogError("[TSDFVoxelGrid] {} has an invalid header.",
+                          file_name);
+    }
+    if (num_blocks > 0 &&
+        (resolution > file_size / resolution / resolution ||
+         num_blocks > file_size / (resolution * resolution * resolution))) {
+        utility::LogError("[TSDFVoxelGrid] {} is truncated.", file_name);
+    }
+    int64_t block_voxels = resolution * resolution * resolution;
+    std::vector<int64_t> section_sizes{num_blocks * 3 *
+                                       int64_t(sizeof(int32_t))};
+    for (const auto &attr : attrs) {
+        section_sizes.push_back(num_blocks * block_voxels *
+                                attr_dtype_map.at(attr.first).ByteSize() *
+                                attr.second);
+    }
+    int64_t expected_size = offset;
+    for (int64_t byte_size : section_sizes) {
+        expected_size = AlignSection(expected_size) + byte_size;
+    }
+    if (expected_size != file_size) {
+        utility::LogError(
+                "[TSDFVoxelGrid] {} has {} bytes, but its header expects {}.",
+                file_name, file_size, expected_size);
+    }
+
+    // The constructor validates the voxel layout.
+    TSDFVoxelGrid voxel_grid(attr_dtype_map, header.voxel_size,
+                             header.sdf_trunc, header.block_resolution,
+                             std::max(header.block_count, num_blocks), device);
+    if (num_blocks == 0) {
+        return voxel_grid;
+    }
+
+    // Sections of the mapped file are used in place. Keys are wrapped as a
+    // tensor sharing the blob, which keeps the file mapped while in use.
+    size_t section_index = 0;
+    auto section = [&]() {
+        offset = AlignSection(offset);
+        char *ptr = data + offset;
+        offset += section_sizes[section_index++];
+        return ptr;
+    };
+
+    core::SizeVector key_shape{num_blocks, 3};
+    core::Tensor keys(key_shape, core::shape_util::DefaultStrides(key_shape),
+                      section(), core::Dtype::Int32, blob);
+
+    // Interleave the attribute columns into voxels in parallel.
+    core::SizeVector value_shape =
+            voxel_grid.block_hashmap_->GetValueTensor().GetShape();
+    value_shape[0] = num_blocks;
+    core::Tensor values(value_shape, core::Dtype::UInt8, core::Device("CPU:0"));
+    uint8_t *values_ptr = static_cast<uint8_t *>(values.GetDataPtr());
+    int64_t voxel_bytes = value_shape[4];
+    int64_t byte_offset = 0;
+    for (const auto &attr : attrs) {
+        int64_t byte_size =
+                attr_dtype_map.at(attr.first).ByteSize() * attr.second;
+        const uint8_t *column = reinterpret_cast<const uint8_t *>(section());
+        ScatterColumn(column, num_blocks, block_voxels, voxel_bytes,
+                      byte_offset, byte_size, values_ptr);
+        byte_offset += byte_size;
+    }
+    keys = keys.To(device);
+    values = values.To(device);
+
+    // Re-insert all the blocks in bulk.
+    core::Tensor addrs, masks;
+    voxel_grid.block_hashmap_->Insert(keys, values, addrs, masks);
+    int64_t num_inserted =
+            masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>();
+    if (num_inserted != num_blocks) {
+        utility::LogWarning(
+                "[TSDFVoxelGrid] {} duplicated blocks in {} are ignored.",
+                num_blocks - num_inserted, file_name);
+    }
+    return voxel_grid;
+}
+
 TSDFVoxelGrid TSDFVoxelGrid::To(const core::Device &device, bool copy) const {
     if (!copy && GetDevice() == device) {
         return *this;
@@ -30,6 +30,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorList.h"
@@ -57,6 +58,11 @@ namespace geometry {
 class TSDFVoxelGrid {
 public:
     /// \brief Default Constructor.
+    /// \p attr_dtype_map selects the voxel layout among (tsdf, weight[,
+    /// color]) = (Float32, Float32), (UInt16, UInt16), (Float32, Float32,
+    /// Float32), (Float32, UInt16, UInt16) and (UInt16, UInt8, UInt8). UInt16
+    /// TSDFs are quantized, and the last layout takes 6 bytes per voxel
+    /// compared to 20 bytes with Float32 colors.
     TSDFVoxelGrid(std::unordered_map<std::string, core::Dtype> attr_dtype_map =
                           {{"tsdf", core::Dtype::Float32},
                            {"weight", core::Dtype::UInt16},
@@ -84,6 +90,22 @@ public:
                    float depth_scale = 1000.0f,
                    float depth_max = 3.0f);
 
+    /// Batched RGB-D integration for offline reconstruction, where all the
+    /// frames with their \p extrinsics (world to camera) are known upfront.
+    /// Voxel blocks touched by all the frames are allocated at once, and each
+    /// voxel is then updated by all the frames in order while it is in cache.
+    /// All frames must share the same shape. \p colors can be empty for
+    /// depth-only integration. Compared to calling Integrate per frame, a
+    /// frame also updates the blocks allocated by the other frames in the
+    /// batch. Frames are stacked on the device, so memory grows linearly with
+    /// the batch size.
+    void IntegrateBatch(const std::vector<Image> &depths,
+                        const std::vector<Image> &colors,
+                        const core::Tensor &intrinsics,
+                        const std::vector<core::Tensor> &extrinsics,
+                        float depth_scale = 1000.0f,
+                        float depth_max = 3.0f);
+
     /// Extract point cloud near iso-surfaces.
     /// Weight threshold is used to filter outliers. By default we use 3.0,
     /// where we assume a reliable surface point comes from the fusion of at
@@ -98,6 +120,36 @@ public:
     /// observations.
     TriangleMesh ExtractSurfaceMesh(float weight_threshold = 3.0f);
 
+    /// Ray cast the surface into a virtual camera of size \p width x
+    /// \p height, given \p intrinsics and \p extrinsics (world to camera).
+    /// Rays skip unallocated voxel blocks and locate the zero crossing with
+    /// trilinear interpolation. Returned images (pixels without a hit are 0):
+    /// - "vertex": (height, width, 3) Float32 points in the camera frame.
+    /// - "depth": (height, width, 1) Float32 depth multiplied by depth_scale,
+    /// compatible with the depth input of Integrate.
+    /// - "normal": (height, width, 3) Float32 normals in the camera frame.
+    /// - "color": (height, width, 3) Float32 colors in [0, 1], only available
+    /// if voxels contain colors.
+    std::unordered_map<std::string, core::Tensor> RayCast(
+            const core::Tensor &intrinsics,
+            const core::Tensor &extrinsics,
+            int width,
+            int height,
+            float depth_scale = 1000.0f,
+            float depth_min = 0.1f,
+            float depth_max = 3.0f,
+            float weight_threshold = 3.0f);
+
+    /// Save active voxel blocks and parameters to a binary file. Block keys
+    /// and each voxel attribute are written as contiguous columns.
+    void Save(const std::string &file_name) const;
+
+    /// Load a TSDFVoxelGrid written by Save to \p device. The file is memory
+    /// mapped and its blocks are inserted into the hashmap in bulk.
+    static TSDFVoxelGrid Load(
+            const std::string &file_name,
+            const core::Device &device = core::Device("CPU:0"));
+
     /// Convert TSDFVoxelGrid to the target device.
     /// \param device The targeted device to convert to.
     /// \param copy If true, a new TSDFVoxelGrid is always created; if false,
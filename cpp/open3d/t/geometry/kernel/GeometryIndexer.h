@@ -84,6 +84,22 @@ public:
                  z_in * extrinsic_[2][2] + extrinsic_[2][3];
     }
 
+    /// Rotate a 3D direction (e.g. a normal) with the rotation part of the
+    /// extrinsic, ignoring translation and scale
+    OPEN3D_HOST_DEVICE void Rotate(float x_in,
+                                   float y_in,
+                                   float z_in,
+                                   float* x_out,
+                                   float* y_out,
+                                   float* z_out) const {
+        *x_out = x_in * extrinsic_[0][0] + y_in * extrinsic_[0][1] +
+                 z_in * extrinsic_[0][2];
+        *y_out = x_in * extrinsic_[1][0] + y_in * extrinsic_[1][1] +
+                 z_in * extrinsic_[1][2];
+        *z_out = x_in * extrinsic_[2][0] + y_in * extrinsic_[2][1] +
+                 z_in * extrinsic_[2][2];
+    }
+
     /// Project a 3D coordinate in camera coordinate to a 2D uv coordinate
     OPEN3D_HOST_DEVICE void Project(float x_in,
                                     float y_in,
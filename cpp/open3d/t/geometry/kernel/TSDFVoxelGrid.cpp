@@ -74,7 +74,8 @@ void Integrate(const core::Tensor& depth,
                float depth_max) {
     core::Device device = depth.GetDevice();
 
-    if (color.GetDevice() != device) {
+    bool has_color = color.NumElements() != 0;
+    if (has_color && color.GetDevice() != device) {
         utility::LogError("Incompatible color device type for depth and color");
     }
     if (block_indices.GetDevice() != device ||
@@ -85,7 +86,8 @@ void Integrate(const core::Tensor& depth,
     }
 
     core::Tensor depthf32 = depth.To(core::Dtype::Float32);
-    core::Tensor colorf32 = color.To(core::Dtype::Float32);
+    core::Tensor colorf32 =
+            has_color ? color.To(core::Dtype::Float32) : core::Tensor();
     core::Tensor intrinsicsf32 = intrinsics.To(device, core::Dtype::Float32);
     core::Tensor extrinsicsf32 = extrinsics.To(device, core::Dtype::Float32);
 
@@ -107,6 +109,64 @@ void Integrate(const core::Tensor& depth,
     }
 }
 
+void IntegrateBatch(const core::Tensor& depths,
+                    const core::Tensor& colors,
+                    const core::Tensor& block_indices,
+                    const core::Tensor& block_keys,
+                    core::Tensor& block_values,
+                    const core::Tensor& intrinsics,
+                    const core::Tensor& extrinsics,
+                    int64_t resolution,
+                    float voxel_size,
+                    float sdf_trunc,
+                    float depth_scale,
+                    float depth_max) {
+    core::Device device = depths.GetDevice();
+
+    bool has_color = colors.NumElements() != 0;
+    if (has_color && colors.GetDevice() != device) {
+        utility::LogError("Incompatible color device type for depth and color");
+    }
+    if (block_indices.GetDevice() != device ||
+        block_keys.GetDevice() != device ||
+        block_values.GetDevice() != device) {
+        utility::LogError(
+                "Incompatible device type for depth and TSDF voxel grid");
+    }
+    if (has_color && colors.GetLength() != depths.GetLength()) {
+        utility::LogError("Expected {} color frames, but got {}",
+                          depths.GetLength(), colors.GetLength());
+    }
+    extrinsics.AssertShape({depths.GetLength(), 4, 4});
+
+    core::Tensor depthsf32 = depths.To(core::Dtype::Float32).Contiguous();
+    core::Tensor colorsf32 =
+            has_color ? colors.To(core::Dtype::Float32).Contiguous()
+                      : core::Tensor();
+    core::Tensor intrinsicsf32 = intrinsics.To(device, core::Dtype::Float32);
+    core::Tensor extrinsicsf32 =
+            extrinsics.To(device, core::Dtype::Float32).Contiguous();
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        IntegrateBatchCPU(depthsf32, colorsf32, block_indices, block_keys,
+                          block_values, intrinsicsf32, extrinsicsf32,
+                          resolution, voxel_size, sdf_trunc, depth_scale,
+                          depth_max);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        IntegrateBatchCUDA(depthsf32, colorsf32, block_indices, block_keys,
+                           block_values, intrinsicsf32, extrinsicsf32,
+                           resolution, voxel_size, sdf_trunc, depth_scale,
+                           depth_max);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 void ExtractSurfacePoints(const core::Tensor& block_indices,
                           const core::Tensor& nb_block_indices,
                           const core::Tensor& nb_block_masks,
@@ -176,6 +236,56 @@ void ExtractSurfaceMesh(const core::Tensor& block_indices,
         utility::LogError("Unimplemented device");
     }
 }
+
+void RayCast(const core::Tensor& block_indices,
+             const core::Tensor& block_keys,
+             const core::Tensor& block_values,
+             core::Tensor& vertex_map,
+             core::Tensor& depth_map,
+             core::Tensor& color_map,
+             core::Tensor& normal_map,
+             const core::Tensor& intrinsics,
+             const core::Tensor& extrinsics,
+             int64_t h,
+             int64_t w,
+             int64_t block_resolution,
+             float voxel_size,
+             float sdf_trunc,
+             float depth_scale,
+             float depth_min,
+             float depth_max,
+             float weight_threshold) {
+    core::Device device = block_keys.GetDevice();
+    if (block_indices.GetDevice() != device ||
+        block_values.GetDevice() != device) {
+        utility::LogError("Incompatible device type for TSDF voxel grid");
+    }
+
+    // Camera parameters are only read on host to set up the rays.
+    core::Device host("CPU:0");
+    core::Tensor intrinsicsf32 = intrinsics.To(host, core::Dtype::Float32);
+    core::Tensor extrinsicsf32 = extrinsics.To(host, core::Dtype::Float32);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        RayCastCPU(block_indices, block_keys, block_values, vertex_map,
+                   depth_map, color_map, normal_map, intrinsicsf32,
+                   extrinsicsf32, h, w, block_resolution, voxel_size, sdf_trunc,
+                   depth_scale, depth_min, depth_max, weight_threshold);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        RayCastCUDA(block_indices, block_keys, block_values, vertex_map,
+                    depth_map, color_map, normal_map, intrinsicsf32,
+                    extrinsicsf32, h, w, block_resolution, voxel_size,
+                    sdf_trunc, depth_scale, depth_min, depth_max,
+                    weight_threshold);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
 }  // namespace tsdf
 }  // namespace kernel
 }  // namespace geometry
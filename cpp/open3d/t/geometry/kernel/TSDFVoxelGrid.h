@@ -54,6 +54,19 @@ void Integrate(const core::Tensor& depth,
                float depth_scale,
                float depth_max);
 
+void IntegrateBatch(const core::Tensor& depths,
+                    const core::Tensor& colors,
+                    const core::Tensor& block_indices,
+                    const core::Tensor& block_keys,
+                    core::Tensor& block_values,
+                    const core::Tensor& intrinsics,
+                    const core::Tensor& extrinsics,
+                    int64_t resolution,
+                    float voxel_size,
+                    float sdf_trunc,
+                    float depth_scale,
+                    float depth_max);
+
 void ExtractSurfacePoints(const core::Tensor& block_indices,
                           const core::Tensor& nb_block_indices,
                           const core::Tensor& nb_block_masks,
@@ -80,6 +93,25 @@ void ExtractSurfaceMesh(const core::Tensor& block_indices,
                         float voxel_size,
                         float weight_threshold);
 
+void RayCast(const core::Tensor& block_indices,
+             const core::Tensor& block_keys,
+             const core::Tensor& block_values,
+             core::Tensor& vertex_map,
+             core::Tensor& depth_map,
+             core::Tensor& color_map,
+             core::Tensor& normal_map,
+             const core::Tensor& intrinsics,
+             const core::Tensor& extrinsics,
+             int64_t h,
+             int64_t w,
+             int64_t block_resolution,
+             float voxel_size,
+             float sdf_trunc,
+             float depth_scale,
+             float depth_min,
+             float depth_max,
+             float weight_threshold);
+
 void TouchCPU(const core::Tensor& points,
               core::Tensor& voxel_block_coords,
               int64_t voxel_grid_resolution,
@@ -99,6 +131,19 @@ void IntegrateCPU(const core::Tensor& depth,
                   float depth_scale,
                   float depth_max);
 
+void IntegrateBatchCPU(const core::Tensor& depths,
+                       const core::Tensor& colors,
+                       const core::Tensor& block_indices,
+                       const core::Tensor& block_keys,
+                       core::Tensor& block_values,
+                       const core::Tensor& intrinsics,
+                       const core::Tensor& extrinsics,
+                       int64_t resolution,
+                       float voxel_size,
+                       float sdf_trunc,
+                       float depth_scale,
+                       float depth_max);
+
 void ExtractSurfacePointsCPU(const core::Tensor& block_indices,
                              const core::Tensor& nb_block_indices,
                              const core::Tensor& nb_block_masks,
@@ -125,6 +170,25 @@ void ExtractSurfaceMeshCPU(const core::Tensor& block_indices,
                            float voxel_size,
                            float weight_threshold);
 
+void RayCastCPU(const core::Tensor& block_indices,
+                const core::Tensor& block_keys,
+                const core::Tensor& block_values,
+                core::Tensor& vertex_map,
+                core::Tensor& depth_map,
+                core::Tensor& color_map,
+                core::Tensor& normal_map,
+                const core::Tensor& intrinsics,
+                const core::Tensor& extrinsics,
+                int64_t h,
+                int64_t w,
+                int64_t block_resolution,
+                float voxel_size,
+                float sdf_trunc,
+                float depth_scale,
+                float depth_min,
+                float depth_max,
+                float weight_threshold);
+
 #ifdef BUILD_CUDA_MODULE
 void TouchCUDA(const core::Tensor& points,
                core::Tensor& voxel_block_coords,
@@ -145,6 +209,19 @@ void IntegrateCUDA(const core::Tensor& depth,
                    float depth_scale,
                    float depth_max);
 
+void IntegrateBatchCUDA(const core::Tensor& depths,
+                        const core::Tensor& colors,
+                        const core::Tensor& block_indices,
+                        const core::Tensor& block_keys,
+                        core::Tensor& block_values,
+                        const core::Tensor& intrinsics,
+                        const core::Tensor& extrinsics,
+                        int64_t resolution,
+                        float voxel_size,
+                        float sdf_trunc,
+                        float depth_scale,
+                        float depth_max);
+
 void ExtractSurfacePointsCUDA(const core::Tensor& block_indices,
                               const core::Tensor& nb_block_indices,
                               const core::Tensor& nb_block_masks,
@@ -171,6 +248,25 @@ void ExtractSurfaceMeshCUDA(const core::Tensor& block_indices,
                             float voxel_size,
                             float weight_threshold);
 
+void RayCastCUDA(const core::Tensor& block_indices,
+                 const core::Tensor& block_keys,
+                 const core::Tensor& block_values,
+                 core::Tensor& vertex_map,
+                 core::Tensor& depth_map,
+                 core::Tensor& color_map,
+                 core::Tensor& normal_map,
+                 const core::Tensor& intrinsics,
+                 const core::Tensor& extrinsics,
+                 int64_t h,
+                 int64_t w,
+                 int64_t block_resolution,
+                 float voxel_size,
+                 float sdf_trunc,
+                 float depth_scale,
+                 float depth_min,
+                 float depth_max,
+                 float weight_threshold);
+
 #endif
 }  // namespace tsdf
 }  // namespace kernel
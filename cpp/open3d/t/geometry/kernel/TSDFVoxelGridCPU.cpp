@@ -24,7 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
-#include <tbb/concurrent_unordered_set.h>
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
@@ -37,34 +41,37 @@
 #include "open3d/t/geometry/kernel/TSDFVoxelGrid.h"
 #include "open3d/t/geometry/kernel/TSDFVoxelGridShared.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/ParallelScan.h"
 
 namespace open3d {
 namespace t {
 namespace geometry {
 namespace kernel {
 namespace tsdf {
-struct Coord3i {
-    Coord3i(int x, int y, int z) : x_(x), y_(y), z_(z) {}
-    bool operator==(const Coord3i& other) const {
-        return x_ == other.x_ && y_ == other.y_ && z_ == other.z_;
-    }
-
-    int64_t x_;
-    int64_t y_;
-    int64_t z_;
-};
+// Block coordinates are packed into 64-bit keys with 21 bits per axis, so that
+// touched blocks can be deduplicated by sorting plain integers.
+static constexpr int kBlockKeyBits = 21;
+static constexpr int64_t kBlockKeyOffset = int64_t(1) << (kBlockKeyBits - 1);
+static constexpr uint64_t kBlockKeyMask = (uint64_t(1) << kBlockKeyBits) - 1;
+static constexpr uint64_t kInvalidBlockKey = ~uint64_t(0);
 
-struct Coord3iHash {
-    size_t operator()(const Coord3i& k) const {
-        static const size_t p0 = 73856093;
-        static const size_t p1 = 19349669;
-        static const size_t p2 = 83492791;
+inline uint64_t PackBlockKey(int xb, int yb, int zb) {
+    uint64_t x = static_cast<uint64_t>(xb + kBlockKeyOffset);
+    uint64_t y = static_cast<uint64_t>(yb + kBlockKeyOffset);
+    uint64_t z = static_cast<uint64_t>(zb + kBlockKeyOffset);
+    return (x << (2 * kBlockKeyBits)) | (y << kBlockKeyBits) | z;
+}
 
-        return (static_cast<size_t>(k.x_) * p0) ^
-               (static_cast<size_t>(k.y_) * p1) ^
-               (static_cast<size_t>(k.z_) * p2);
-    }
-};
+inline void UnpackBlockKey(uint64_t key, int* block_coord) {
+    block_coord[0] = static_cast<int>(
+            static_cast<int64_t>((key >> (2 * kBlockKeyBits)) & kBlockKeyMask) -
+            kBlockKeyOffset);
+    block_coord[1] = static_cast<int>(
+            static_cast<int64_t>((key >> kBlockKeyBits) & kBlockKeyMask) -
+            kBlockKeyOffset);
+    block_coord[2] = static_cast<int>(
+            static_cast<int64_t>(key & kBlockKeyMask) - kBlockKeyOffset);
+}
 
 void TouchCPU(const core::Tensor& points,
               core::Tensor& voxel_block_coords,
@@ -77,35 +84,78 @@ void TouchCPU(const core::Tensor& points,
     int64_t n = points.GetLength();
     const float* pcd_ptr = static_cast<const float*>(points.GetDataPtr());
 
-    tbb::concurrent_unordered_set<Coord3i, Coord3iHash> set;
+    // Range of blocks within sdf_trunc of a point. Since sdf_trunc is smaller
+    // than half a block, a point touches at most 2 blocks per axis.
+    auto GetBlockRange = [&](int64_t idx, int* lo, int* hi) {
+        for (int i = 0; i < 3; ++i) {
+            float v = pcd_ptr[3 * idx + i];
+            lo[i] = static_cast<int>(std::floor((v - sdf_trunc) / block_size));
+            hi[i] = static_cast<int>(std::floor((v + sdf_trunc) / block_size));
+        }
+    };
+
+    // Write candidate keys into a flat buffer with 8 slots per point. Points
+    // from a depth image are ordered by pixels, so a point often touches the
+    // same blocks as the previous one; such duplicates are skipped early.
+    std::vector<uint64_t> keys(8 * n, kInvalidBlockKey);
+    std::atomic<bool> out_of_range(false);
     core::kernel::CPULauncher::LaunchGeneralKernel(
             n, [&](int64_t workload_idx) {
-                float x = pcd_ptr[3 * workload_idx + 0];
-                float y = pcd_ptr[3 * workload_idx + 1];
-                float z = pcd_ptr[3 * workload_idx + 2];
+                int lo[3], hi[3];
+                GetBlockRange(workload_idx, lo, hi);
+                if (workload_idx > 0) {
+                    int lo_prev[3], hi_prev[3];
+                    GetBlockRange(workload_idx - 1, lo_prev, hi_prev);
+                    if (lo[0] == lo_prev[0] && lo[1] == lo_prev[1] &&
+                        lo[2] == lo_prev[2] && hi[0] == hi_prev[0] &&
+                        hi[1] == hi_prev[1] && hi[2] == hi_prev[2]) {
+                        return;
+                    }
+                }
+                for (int i = 0; i < 3; ++i) {
+                    if (lo[i] < -kBlockKeyOffset ||
+                        hi[i] >= kBlockKeyOffset) {
+                        out_of_range = true;
+                        return;
+                    }
+                }
 
-                int xb_lo = static_cast<int>(
-                        std::floor((x - sdf_trunc) / block_size));
-                int xb_hi = static_cast<int>(
-                        std::floor((x + sdf_trunc) / block_size));
-                int yb_lo = static_cast<int>(
-                        std::floor((y - sdf_trunc) / block_size));
-                int yb_hi = static_cast<int>(
-                        std::floor((y + sdf_trunc) / block_size));
-                int zb_lo = static_cast<int>(
-                        std::floor((z - sdf_trunc) / block_size));
-                int zb_hi = static_cast<int>(
-                        std::floor((z + sdf_trunc) / block_size));
-                for (int xb = xb_lo; xb <= xb_hi; ++xb) {
-                    for (int yb = yb_lo; yb <= yb_hi; ++yb) {
-                        for (int zb = zb_lo; zb <= zb_hi; ++zb) {
-                            set.emplace(xb, yb, zb);
+                uint64_t* keys_ptr = keys.data() + 8 * workload_idx;
+                for (int xb = lo[0]; xb <= hi[0]; ++xb) {
+                    for (int yb = lo[1]; yb <= hi[1]; ++yb) {
+                        for (int zb = lo[2]; zb <= hi[2]; ++zb) {
+                            *keys_ptr++ = PackBlockKey(xb, yb, zb);
                         }
                     }
                 }
             });
+    if (out_of_range) {
+        utility::LogWarning(
+                "Points too far away from the origin are ignored in TSDF "
+                "volume allocation.");
+    }
+
+    // Sort and deduplicate. Invalid keys are sorted to the end.
+    tbb::parallel_sort(keys.begin(), keys.end());
+    int64_t num_keys =
+            std::lower_bound(keys.begin(), keys.end(), kInvalidBlockKey) -
+            keys.begin();
+
+    std::vector<int64_t> is_unique(num_keys);
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            num_keys, [&](int64_t workload_idx) {
+                is_unique[workload_idx] =
+                        (workload_idx == 0 ||
+                         keys[workload_idx] != keys[workload_idx - 1])
+                                ? 1
+                                : 0;
+            });
+    std::vector<int64_t> unique_offsets(num_keys + 1, 0);
+    utility::InclusivePrefixSum(is_unique.data(),
+                                is_unique.data() + num_keys,
+                                unique_offsets.data() + 1);
 
-    int64_t block_count = set.size();
+    int64_t block_count = unique_offsets[num_keys];
     if (block_count == 0) {
         utility::LogError(
                 "No block is touched in TSDF volume, abort integration. Please "
@@ -116,13 +166,14 @@ void TouchCPU(const core::Tensor& points,
     voxel_block_coords = core::Tensor({block_count, 3}, core::Dtype::Int32,
                                       points.GetDevice());
     int* block_coords_ptr = static_cast<int*>(voxel_block_coords.GetDataPtr());
-    int count = 0;
-    for (auto it = set.begin(); it != set.end(); ++it, ++count) {
-        int64_t offset = count * 3;
-        block_coords_ptr[offset + 0] = static_cast<int>(it->x_);
-        block_coords_ptr[offset + 1] = static_cast<int>(it->y_);
-        block_coords_ptr[offset + 2] = static_cast<int>(it->z_);
-    }
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            num_keys, [&](int64_t workload_idx) {
+                if (is_unique[workload_idx]) {
+                    int64_t offset = 3 * unique_offsets[workload_idx];
+                    UnpackBlockKey(keys[workload_idx],
+                                   block_coords_ptr + offset);
+                }
+            });
 }
 }  // namespace tsdf
 }  // namespace kernel
@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include <atomic>
+#include <vector>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
@@ -36,6 +37,10 @@
 #include "open3d/t/geometry/kernel/TSDFVoxelGrid.h"
 #include "open3d/utility/Console.h"
 
+#if !defined(BUILD_CUDA_MODULE) || !defined(__CUDACC__)
+#include "open3d/utility/ParallelScan.h"
+#endif
+
 #define DISPATCH_BYTESIZE_TO_VOXEL(BYTESIZE, ...)            \
     [&] {                                                    \
         if (BYTESIZE == sizeof(ColoredVoxel32f)) {           \
@@ -47,6 +52,12 @@
         } else if (BYTESIZE == sizeof(Voxel32f)) {           \
             using voxel_t = Voxel32f;                        \
             return __VA_ARGS__();                            \
+        } else if (BYTESIZE == sizeof(ColoredVoxel8i)) {     \
+            using voxel_t = ColoredVoxel8i;                  \
+            return __VA_ARGS__();                            \
+        } else if (BYTESIZE == sizeof(Voxel16i)) {           \
+            using voxel_t = Voxel16i;                        \
+            return __VA_ARGS__();                            \
         } else {                                             \
             utility::LogError("Unsupported voxel bytesize"); \
         }                                                    \
@@ -174,6 +185,99 @@ struct ColoredVoxel32f {
     }
 };
 
+/// 4-byte voxel structure.
+/// TSDF in [-1, 1] is quantized to uint16_t, and the weight is uint16_t. Half
+/// the memory of Voxel32f for depth-only integration.
+struct Voxel16i {
+    static const uint16_t kMaxUint16 = 65535;
+    static constexpr float kTSDFFactor = 32767.5f;
+
+    uint16_t tsdf;
+    uint16_t weight;
+
+    static bool HasColor() { return false; }
+    OPEN3D_HOST_DEVICE float GetTSDF() {
+        return static_cast<float>(tsdf) / kTSDFFactor - 1.0f;
+    }
+    OPEN3D_HOST_DEVICE float GetWeight() { return static_cast<float>(weight); }
+    OPEN3D_HOST_DEVICE float GetR() { return 1.0; }
+    OPEN3D_HOST_DEVICE float GetG() { return 1.0; }
+    OPEN3D_HOST_DEVICE float GetB() { return 1.0; }
+
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
+        float inc_wsum = static_cast<float>(weight) + 1;
+        float inv_wsum = 1.0f / inc_wsum;
+        float tsdf_new = (weight * GetTSDF() + dsdf) * inv_wsum;
+        tsdf = static_cast<uint16_t>(round((tsdf_new + 1.0f) * kTSDFFactor));
+        weight = static_cast<uint16_t>(inc_wsum < static_cast<float>(kMaxUint16)
+                                               ? weight + 1
+                                               : kMaxUint16);
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf,
+                                      float dr,
+                                      float dg,
+                                      float db) {
+        printf("[Voxel16i] should never reach here.\n");
+    }
+};
+
+/// 6-byte voxel structure.
+/// Quantized uint16_t TSDF as in Voxel16i, with uint8_t weight and colors.
+/// The weight saturates at 255 observations, after which new observations
+/// keep being blended in with a fixed rate. Suitable for large scenes where
+/// memory matters more than color precision.
+struct ColoredVoxel8i {
+    static const uint8_t kMaxUint8 = 255;
+    static constexpr float kTSDFFactor = 32767.5f;
+
+    uint16_t tsdf;
+    uint8_t weight;
+
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+
+    static bool HasColor() { return true; }
+    OPEN3D_HOST_DEVICE float GetTSDF() {
+        return static_cast<float>(tsdf) / kTSDFFactor - 1.0f;
+    }
+    OPEN3D_HOST_DEVICE float GetWeight() { return static_cast<float>(weight); }
+    OPEN3D_HOST_DEVICE float GetR() { return static_cast<float>(r); }
+    OPEN3D_HOST_DEVICE float GetG() { return static_cast<float>(g); }
+    OPEN3D_HOST_DEVICE float GetB() { return static_cast<float>(b); }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
+        float inc_wsum = static_cast<float>(weight) + 1;
+        float inv_wsum = 1.0f / inc_wsum;
+        float tsdf_new = (weight * GetTSDF() + dsdf) * inv_wsum;
+        tsdf = static_cast<uint16_t>(round((tsdf_new + 1.0f) * kTSDFFactor));
+        weight = static_cast<uint8_t>(inc_wsum < static_cast<float>(kMaxUint8)
+                                              ? weight + 1
+                                              : kMaxUint8);
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf,
+                                      float dr,
+                                      float dg,
+                                      float db) {
+        float inc_wsum = static_cast<float>(weight) + 1;
+        float inv_wsum = 1.0f / inc_wsum;
+        float tsdf_new = (weight * GetTSDF() + dsdf) * inv_wsum;
+        tsdf = static_cast<uint16_t>(round((tsdf_new + 1.0f) * kTSDFFactor));
+        r = static_cast<uint8_t>(round((weight * r + dr) * inv_wsum));
+        g = static_cast<uint8_t>(round((weight * g + dg) * inv_wsum));
+        b = static_cast<uint8_t>(round((weight * b + db) * inv_wsum));
+        weight = static_cast<uint8_t>(inc_wsum < static_cast<float>(kMaxUint8)
+                                              ? weight + 1
+                                              : kMaxUint8);
+    }
+};
+
+// Voxel layouts are dispatched by their byte size, which must be unique.
+static_assert(sizeof(Voxel16i) == 4, "Unexpected Voxel16i size");
+static_assert(sizeof(ColoredVoxel8i) == 6, "Unexpected ColoredVoxel8i size");
+static_assert(sizeof(Voxel32f) == 8, "Unexpected Voxel32f size");
+static_assert(sizeof(ColoredVoxel16i) == 12, "Unexpected ColoredVoxel16i size");
+static_assert(sizeof(ColoredVoxel32f) == 20, "Unexpected ColoredVoxel32f size");
+
 // Get a voxel in a certain voxel block given the block id with its neighbors.
 template <typename voxel_t>
 inline OPEN3D_DEVICE voxel_t* DeviceGetVoxelAt(
@@ -236,6 +340,340 @@ inline OPEN3D_DEVICE void DeviceGetNormalAt(
     if (vzp && vzn) n[2] = (vzp->GetTSDF() - vzn->GetTSDF()) / (2 * voxel_size);
 };
 
+// Find the surface crossings on the edges from a voxel to its +x, +y and +z
+// neighbors. Returns a mask where bit i is set if the edge along axis i
+// crosses the zero level set between two observed voxels.
+template <typename voxel_t>
+inline OPEN3D_DEVICE int DeviceGetSurfaceCrossings(
+        int xv,
+        int yv,
+        int zv,
+        int curr_block_idx,
+        int64_t block_idx,
+        int resolution,
+        float weight_threshold,
+        const NDArrayIndexer& nb_block_masks_indexer,
+        const NDArrayIndexer& nb_block_indices_indexer,
+        const NDArrayIndexer& blocks_indexer) {
+    voxel_t* voxel_ptr = blocks_indexer.GetDataPtrFromCoord<voxel_t>(
+            xv, yv, zv, block_idx);
+    float tsdf_o = voxel_ptr->GetTSDF();
+    float weight_o = voxel_ptr->GetWeight();
+    if (weight_o <= weight_threshold) return 0;
+
+    int crossings = 0;
+    for (int i = 0; i < 3; ++i) {
+        voxel_t* ptr = DeviceGetVoxelAt<voxel_t>(
+                xv + (i == 0), yv + (i == 1), zv + (i == 2), curr_block_idx,
+                resolution, nb_block_masks_indexer, nb_block_indices_indexer,
+                blocks_indexer);
+        if (ptr == nullptr) continue;
+
+        float tsdf_i = ptr->GetTSDF();
+        float weight_i = ptr->GetWeight();
+        if (weight_i > weight_threshold && tsdf_i * tsdf_o < 0) {
+            crossings |= (1 << i);
+        }
+    }
+    return crossings;
+}
+
+// Number of set bits in a 3-bit mask.
+OPEN3D_HOST_DEVICE inline int CountBits3(int mask) {
+    return (mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1);
+}
+
+// Floor division for possibly negative voxel coordinates.
+OPEN3D_HOST_DEVICE inline int FloorDiv(int a, int b) {
+    return (a >= 0) ? a / b : (a - b + 1) / b;
+}
+
+// Slot of a block coordinate in the block lookup table. mask = capacity - 1,
+// where capacity is a power of 2.
+OPEN3D_HOST_DEVICE inline int64_t BlockLookupSlot(int xb,
+                                                  int yb,
+                                                  int zb,
+                                                  int64_t mask) {
+    uint64_t hash = (static_cast<uint64_t>(xb) * 73856093) ^
+                    (static_cast<uint64_t>(yb) * 19349669) ^
+                    (static_cast<uint64_t>(zb) * 83492791);
+    return static_cast<int64_t>(hash & static_cast<uint64_t>(mask));
+}
+
+// Build an open addressing table (linear probing, load factor <= 0.5) mapping
+// block coordinates to block buffer indices, so that kernels can look up
+// arbitrary blocks along a ray. It is built on host: the cost is linear in the
+// number of blocks and negligible compared to the per-pixel work.
+inline core::Tensor BuildBlockLookupTable(const core::Tensor& indices,
+                                          const core::Tensor& block_keys,
+                                          int64_t& mask) {
+    core::Device host("CPU:0");
+    core::Tensor indices_host = indices.To(host).Contiguous();
+    core::Tensor keys_host =
+            block_keys.IndexGet({indices}).To(host).Contiguous();
+
+    int64_t n = indices_host.GetLength();
+    int64_t capacity = 2;
+    while (capacity < 2 * n) {
+        capacity <<= 1;
+    }
+    mask = capacity - 1;
+
+    const int64_t* indices_ptr =
+            static_cast<const int64_t*>(indices_host.GetDataPtr());
+    const int* keys_ptr = static_cast<const int*>(keys_host.GetDataPtr());
+    std::vector<int64_t> table(capacity, -1);
+    for (int64_t i = 0; i < n; ++i) {
+        int64_t slot = BlockLookupSlot(keys_ptr[3 * i + 0], keys_ptr[3 * i + 1],
+                                       keys_ptr[3 * i + 2], mask);
+        while (table[slot] >= 0) {
+            slot = (slot + 1) & mask;
+        }
+        table[slot] = indices_ptr[i];
+    }
+    return core::Tensor(table, {capacity}, core::Dtype::Int64,
+                        block_keys.GetDevice());
+}
+
+// Get the buffer index of block (xb, yb, zb) from the block lookup table, or
+// -1 if the block is not allocated.
+inline OPEN3D_DEVICE int64_t
+DeviceLookupBlock(int xb,
+                  int yb,
+                  int zb,
+                  const int64_t* table_ptr,
+                  int64_t mask,
+                  const NDArrayIndexer& block_keys_indexer) {
+    int64_t slot = BlockLookupSlot(xb, yb, zb, mask);
+    while (true) {
+        int64_t block_idx = table_ptr[slot];
+        if (block_idx < 0) return -1;
+
+        int* key = block_keys_indexer.GetDataPtrFromCoord<int>(block_idx);
+        if (key[0] == xb && key[1] == yb && key[2] == zb) return block_idx;
+        slot = (slot + 1) & mask;
+    }
+}
+
+// Trilinearly interpolate the TSDF at (x, y, z) in voxel units. Optionally
+// also returns the TSDF gradient (in voxel units) and the color. Returns false
+// if any of the 8 surrounding voxels is missing or below the weight threshold.
+template <typename voxel_t>
+inline OPEN3D_DEVICE bool DeviceGetTrilinearAt(
+        float x,
+        float y,
+        float z,
+        int resolution,
+        float weight_threshold,
+        const int64_t* table_ptr,
+        int64_t mask,
+        const NDArrayIndexer& block_keys_indexer,
+        const NDArrayIndexer& blocks_indexer,
+        float* tsdf,
+        float* gradient,
+        float* color) {
+    float xf = floorf(x), yf = floorf(y), zf = floorf(z);
+    float dx = x - xf, dy = y - yf, dz = z - zf;
+    int x0 = static_cast<int>(xf);
+    int y0 = static_cast<int>(yf);
+    int z0 = static_cast<int>(zf);
+
+    // All 8 corners share the block of (x0, y0, z0) unless it lies on the
+    // upper boundary of the block.
+    int xb = FloorDiv(x0, resolution);
+    int yb = FloorDiv(y0, resolution);
+    int zb = FloorDiv(z0, resolution);
+    int64_t base_block_idx = DeviceLookupBlock(xb, yb, zb, table_ptr, mask,
+                                               block_keys_indexer);
+    if (base_block_idx < 0) return false;
+
+    *tsdf = 0;
+    for (int k = 0; k < 3; ++k) {
+        if (gradient) gradient[k] = 0;
+        if (color) color[k] = 0;
+    }
+
+    for (int i = 0; i < 8; ++i) {
+        int di = i & 1, dj = (i >> 1) & 1, dk = (i >> 2) & 1;
+        int xl = x0 + di - xb * resolution;
+        int yl = y0 + dj - yb * resolution;
+        int zl = z0 + dk - zb * resolution;
+
+        int64_t block_idx = base_block_idx;
+        if (xl == resolution || yl == resolution || zl == resolution) {
+            int dxb = xl / resolution, dyb = yl / resolution,
+                dzb = zl / resolution;
+            block_idx = DeviceLookupBlock(xb + dxb, yb + dyb, zb + dzb,
+                                          table_ptr, mask, block_keys_indexer);
+            if (block_idx < 0) return false;
+            xl -= dxb * resolution;
+            yl -= dyb * resolution;
+            zl -= dzb * resolution;
+        }
+
+        voxel_t* voxel_ptr = blocks_indexer.GetDataPtrFromCoord<voxel_t>(
+                xl, yl, zl, block_idx);
+        if (voxel_ptr->GetWeight() <= weight_threshold) return false;
+
+        float wx = di ? dx : 1 - dx;
+        float wy = dj ? dy : 1 - dy;
+        float wz = dk ? dz : 1 - dz;
+        float tsdf_i = voxel_ptr->GetTSDF();
+        *tsdf += wx * wy * wz * tsdf_i;
+        if (gradient) {
+            gradient[0] += (di ? 1 : -1) * wy * wz * tsdf_i;
+            gradient[1] += (dj ? 1 : -1) * wx * wz * tsdf_i;
+            gradient[2] += (dk ? 1 : -1) * wx * wy * tsdf_i;
+        }
+        if (color) {
+            color[0] += wx * wy * wz * voxel_ptr->GetR();
+            color[1] += wx * wy * wz * voxel_ptr->GetG();
+            color[2] += wx * wy * wz * voxel_ptr->GetB();
+        }
+    }
+    return true;
+}
+
+#if !defined(BUILD_CUDA_MODULE) || !defined(__CUDACC__)
+// Launch a per-voxel kernel so that all voxels of a block are visited in order
+// by the same thread. Kernels can then append their outputs through per-block
+// cursors (see ExclusiveScanCPU) instead of contending on a global atomic
+// counter, and the output order is deterministic.
+template <typename func_t>
+void LaunchBlockwiseKernelCPU(int64_t n_blocks,
+                              int64_t resolution3,
+                              const func_t& kernel) {
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            n_blocks, [&](int64_t workload_block_idx) {
+                int64_t offset = workload_block_idx * resolution3;
+                for (int64_t voxel_idx = 0; voxel_idx < resolution3;
+                     ++voxel_idx) {
+                    kernel(offset + voxel_idx);
+                }
+            });
+}
+
+// Exclusive scan of per-block output counts. Returns the total count.
+inline int ExclusiveScanCPU(const std::vector<int>& counts,
+                            std::vector<int>& offsets) {
+    offsets.resize(counts.size() + 1);
+    offsets[0] = 0;
+    utility::InclusivePrefixSum(counts.data(), counts.data() + counts.size(),
+                                offsets.data() + 1);
+    return offsets.back();
+}
+#endif
+
+// Integrate the observation at pixel (u, v) into a voxel at depth zc in the
+// camera frame. Observations out of the image, invalid or behind the
+// truncation band are skipped. The image indexers are 2D for a single frame,
+// or 3D with the frames as the outer-most dimension if \p frame >= 0.
+template <typename voxel_t>
+inline OPEN3D_DEVICE void DeviceIntegrateVoxel(
+        voxel_t* voxel_ptr,
+        float zc,
+        float u,
+        float v,
+        const NDArrayIndexer& depth_indexer,
+        const NDArrayIndexer& color_indexer,
+        bool integrate_color,
+        float sdf_trunc,
+        float depth_scale,
+        float depth_max,
+        int64_t frame = -1) {
+    const bool batched = frame >= 0;
+    if (batched ? !depth_indexer.InBoundary(u, v, static_cast<float>(frame))
+                : !depth_indexer.InBoundary(u, v)) {
+        return;
+    }
+
+    // Associate image workload and compute SDF and TSDF.
+    int64_t ui = static_cast<int64_t>(u);
+    int64_t vi = static_cast<int64_t>(v);
+    float* depth_ptr =
+            batched ? depth_indexer.GetDataPtrFromCoord<float>(ui, vi, frame)
+                    : depth_indexer.GetDataPtrFromCoord<float>(ui, vi);
+    float depth = *depth_ptr / depth_scale;
+
+    float sdf = (depth - zc);
+    if (depth <= 0 || depth > depth_max || zc <= 0 || sdf < -sdf_trunc) {
+        return;
+    }
+    sdf = sdf < sdf_trunc ? sdf : sdf_trunc;
+    sdf /= sdf_trunc;
+
+    if (integrate_color) {
+        float* color_ptr =
+                batched ? color_indexer.GetDataPtrFromCoord<float>(ui, vi,
+                                                                   frame)
+                        : color_indexer.GetDataPtrFromCoord<float>(ui, vi);
+        voxel_ptr->Integrate(sdf, color_ptr[0], color_ptr[1], color_ptr[2]);
+    } else {
+        voxel_ptr->Integrate(sdf);
+    }
+}
+
+#if !defined(BUILD_CUDA_MODULE) || !defined(__CUDACC__)
+// Integrate a whole block row by row. Voxels of a row are contiguous along x,
+// so their projections are computed in a SIMD loop free of branches and
+// memory dependencies, followed by a scalar loop that gathers the depth and
+// updates the voxels. Both loops evaluate the same expressions as the
+// per-voxel kernel, so results are identical.
+template <typename voxel_t>
+void IntegrateBlockCPU(int64_t block_idx,
+                       int64_t resolution,
+                       const TransformIndexer& transform_indexer,
+                       const NDArrayIndexer& depth_indexer,
+                       const NDArrayIndexer& color_indexer,
+                       const NDArrayIndexer& block_keys_indexer,
+                       const NDArrayIndexer& voxel_block_buffer_indexer,
+                       bool integrate_color,
+                       float sdf_trunc,
+                       float depth_scale,
+                       float depth_max) {
+    int* block_key_ptr =
+            block_keys_indexer.GetDataPtrFromCoord<int>(block_idx);
+    int64_t xb = static_cast<int64_t>(block_key_ptr[0]);
+    int64_t yb = static_cast<int64_t>(block_key_ptr[1]);
+    int64_t zb = static_cast<int64_t>(block_key_ptr[2]);
+
+    std::vector<float> zcs(resolution), us(resolution), vs(resolution);
+    float* zc_ptr = zcs.data();
+    float* u_ptr = us.data();
+    float* v_ptr = vs.data();
+    // Voxel coordinates are far below 2^24, so they are exact as floats.
+    int x0 = static_cast<int>(xb * resolution);
+    for (int64_t zv = 0; zv < resolution; ++zv) {
+        float z = static_cast<float>(zb * resolution + zv);
+        for (int64_t yv = 0; yv < resolution; ++yv) {
+            float y = static_cast<float>(yb * resolution + yv);
+
+            // coordinate in camera (in voxel -> in meter), then in image
+#pragma omp simd
+            for (int xv = 0; xv < resolution; ++xv) {
+                float x = static_cast<float>(x0 + xv);
+                float xc, yc, zc, u, v;
+                transform_indexer.RigidTransform(x, y, z, &xc, &yc, &zc);
+                transform_indexer.Project(xc, yc, zc, &u, &v);
+                zc_ptr[xv] = zc;
+                u_ptr[xv] = u;
+                v_ptr[xv] = v;
+            }
+
+            voxel_t* row_ptr =
+                    voxel_block_buffer_indexer.GetDataPtrFromCoord<voxel_t>(
+                            0, yv, zv, block_idx);
+            for (int64_t xv = 0; xv < resolution; ++xv) {
+                DeviceIntegrateVoxel(row_ptr + xv, zc_ptr[xv], u_ptr[xv],
+                                     v_ptr[xv], depth_indexer, color_indexer,
+                                     integrate_color, sdf_trunc, depth_scale,
+                                     depth_max);
+            }
+        }
+    }
+}
+#endif
+
 #if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
 void IntegrateCUDA
 #else
@@ -255,11 +693,7 @@ void IntegrateCPU
          float sdf_trunc,
          float depth_scale,
          float depth_max) {
-    // Parameters
-    int64_t resolution3 = resolution * resolution * resolution;
-
     // Shape / transform indexers, no data involved
-    NDArrayIndexer voxel_indexer({resolution, resolution, resolution});
     TransformIndexer transform_indexer(intrinsics, extrinsics, voxel_size);
 
     // Real data indexer
@@ -279,13 +713,11 @@ void IntegrateCPU
     const int64_t* indices_ptr =
             static_cast<const int64_t*>(indices.GetDataPtr());
 
-    int64_t n = indices.GetLength() * resolution3;
-
 #if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    int64_t resolution3 = resolution * resolution * resolution;
+    int64_t n = indices.GetLength() * resolution3;
+    NDArrayIndexer voxel_indexer({resolution, resolution, resolution});
     core::kernel::CUDALauncher launcher;
-#else
-    core::kernel::CPULauncher launcher;
-#endif
 
     DISPATCH_BYTESIZE_TO_VOXEL(
             voxel_block_buffer_indexer.ElementByteSize(), [&]() {
@@ -321,41 +753,139 @@ void IntegrateCPU
 
                     // coordinate in image (in pixel)
                     transform_indexer.Project(xc, yc, zc, &u, &v);
-                    if (!depth_indexer.InBoundary(u, v)) {
-                        return;
-                    }
 
-                    // Associate image workload and compute SDF and TSDF.
-                    float depth = *depth_indexer.GetDataPtrFromCoord<float>(
-                                          static_cast<int64_t>(u),
-                                          static_cast<int64_t>(v)) /
-                                  depth_scale;
+                    // Associate voxel workload and update TSDF/Weights
+                    voxel_t* voxel_ptr = voxel_block_buffer_indexer
+                                                 .GetDataPtrFromCoord<voxel_t>(
+                                                         xv, yv, zv, block_idx);
+                    DeviceIntegrateVoxel(voxel_ptr, zc, u, v, depth_indexer,
+                                         color_indexer, integrate_color,
+                                         sdf_trunc, depth_scale, depth_max);
+                });
+            });
+#else
+    int64_t n_blocks = indices.GetLength();
+    DISPATCH_BYTESIZE_TO_VOXEL(
+            voxel_block_buffer_indexer.ElementByteSize(), [&]() {
+                core::kernel::CPULauncher::LaunchGeneralKernel(
+                        n_blocks, [&](int64_t workload_block_idx) {
+                            IntegrateBlockCPU<voxel_t>(
+                                    indices_ptr[workload_block_idx],
+                                    resolution, transform_indexer,
+                                    depth_indexer, color_indexer,
+                                    block_keys_indexer,
+                                    voxel_block_buffer_indexer,
+                                    integrate_color, sdf_trunc, depth_scale,
+                                    depth_max);
+                        });
+            });
+#endif
+}
 
-                    float sdf = (depth - zc);
-                    if (depth <= 0 || depth > depth_max || zc <= 0 ||
-                        sdf < -sdf_trunc) {
-                        return;
-                    }
-                    sdf = sdf < sdf_trunc ? sdf : sdf_trunc;
-                    sdf /= sdf_trunc;
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void IntegrateBatchCUDA
+#else
+void IntegrateBatchCPU
+#endif
+        (const core::Tensor& depths,
+         const core::Tensor& colors,
+         const core::Tensor& indices,
+         const core::Tensor& block_keys,
+         core::Tensor& block_values,
+         // Transforms
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         // Parameters
+         int64_t resolution,
+         float voxel_size,
+         float sdf_trunc,
+         float depth_scale,
+         float depth_max) {
+    // Parameters
+    int64_t resolution3 = resolution * resolution * resolution;
+    int64_t num_frames = depths.GetLength();
+
+    // Shape / transform indexers, no data involved. Extrinsics are read per
+    // frame in the kernel, so only the projection is used here.
+    NDArrayIndexer voxel_indexer({resolution, resolution, resolution});
+    TransformIndexer transform_indexer(intrinsics.To(core::Device("CPU:0")));
+
+    // Real data indexer, frames are indexed as the outer-most dimension.
+    NDArrayIndexer depth_indexer(depths, 3);
+    NDArrayIndexer block_keys_indexer(block_keys, 1);
+    NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
+
+    // Optional color integration
+    NDArrayIndexer color_indexer;
+    bool integrate_color = false;
+    if (colors.NumElements() != 0) {
+        color_indexer = NDArrayIndexer(colors, 3);
+        integrate_color = true;
+    }
+
+    // Plain arrays that does not require indexers
+    const int64_t* indices_ptr =
+            static_cast<const int64_t*>(indices.GetDataPtr());
+    const float* extrinsics_ptr =
+            static_cast<const float*>(extrinsics.GetDataPtr());
+
+    int64_t n_blocks = indices.GetLength();
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#endif
+
+    DISPATCH_BYTESIZE_TO_VOXEL(
+            voxel_block_buffer_indexer.ElementByteSize(), [&]() {
+                auto kernel = [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    // Natural index (0, N) -> (block_idx, voxel_idx)
+                    int64_t block_idx = indices_ptr[workload_idx / resolution3];
+                    int64_t voxel_idx = workload_idx % resolution3;
+
+                    int* block_key_ptr =
+                            block_keys_indexer.GetDataPtrFromCoord<int>(
+                                    block_idx);
+                    int64_t xv, yv, zv;
+                    voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
+
+                    // Coordinate in world (in meter)
+                    float x = static_cast<float>(block_key_ptr[0] * resolution +
+                                                 xv) *
+                              voxel_size;
+                    float y = static_cast<float>(block_key_ptr[1] * resolution +
+                                                 yv) *
+                              voxel_size;
+                    float z = static_cast<float>(block_key_ptr[2] * resolution +
+                                                 zv) *
+                              voxel_size;
 
-                    // Associate voxel workload and update TSDF/Weights
                     voxel_t* voxel_ptr = voxel_block_buffer_indexer
                                                  .GetDataPtrFromCoord<voxel_t>(
                                                          xv, yv, zv, block_idx);
 
-                    if (integrate_color) {
-                        float* color_ptr =
-                                color_indexer.GetDataPtrFromCoord<float>(
-                                        static_cast<int64_t>(u),
-                                        static_cast<int64_t>(v));
-
-                        voxel_ptr->Integrate(sdf, color_ptr[0], color_ptr[1],
-                                             color_ptr[2]);
-                    } else {
-                        voxel_ptr->Integrate(sdf);
+                    // The voxel stays in cache (or registers) while all the
+                    // frames are fused in order.
+                    for (int64_t f = 0; f < num_frames; ++f) {
+                        const float* T = extrinsics_ptr + f * 16;
+                        float zc = T[8] * x + T[9] * y + T[10] * z + T[11];
+                        if (zc <= 0) continue;
+                        float xc = T[0] * x + T[1] * y + T[2] * z + T[3];
+                        float yc = T[4] * x + T[5] * y + T[6] * z + T[7];
+
+                        float u, v;
+                        transform_indexer.Project(xc, yc, zc, &u, &v);
+                        DeviceIntegrateVoxel(voxel_ptr, zc, u, v, depth_indexer,
+                                             color_indexer, integrate_color,
+                                             sdf_trunc, depth_scale, depth_max,
+                                             f);
                     }
-                });
+                };
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+                launcher.LaunchGeneralKernel(n_blocks * resolution3, kernel);
+#else
+                LaunchBlockwiseKernelCPU(n_blocks, resolution3, kernel);
+#endif
             });
 }
 
@@ -394,16 +924,6 @@ void ExtractSurfacePointsCPU
     int64_t n_blocks = indices.GetLength();
     int64_t n = n_blocks * resolution3;
 
-    // Output
-#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
-    core::Tensor count(std::vector<int>{0}, {}, core::Dtype::Int32,
-                       block_values.GetDevice());
-    int* count_ptr = static_cast<int*>(count.GetDataPtr());
-#else
-    std::atomic<int> count_atomic(0);
-    std::atomic<int>* count_ptr = &count_atomic;
-#endif
-
 #if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
     core::kernel::CUDALauncher launcher;
 #else
@@ -411,21 +931,15 @@ void ExtractSurfacePointsCPU
 #endif
 
     // This pass determines valid number of points.
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::Tensor count(std::vector<int>{0}, {}, core::Dtype::Int32,
+                       block_values.GetDevice());
+    int* count_ptr = static_cast<int*>(count.GetDataPtr());
+
     DISPATCH_BYTESIZE_TO_VOXEL(
             voxel_block_buffer_indexer.ElementByteSize(), [&]() {
                 launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
                                                         int64_t workload_idx) {
-                    auto GetVoxelAt = [&] OPEN3D_DEVICE(
-                                              int xo, int yo, int zo,
-                                              int curr_block_idx) -> voxel_t* {
-                        return DeviceGetVoxelAt<voxel_t>(
-                                xo, yo, zo, curr_block_idx,
-                                static_cast<int>(resolution),
-                                nb_block_masks_indexer,
-                                nb_block_indices_indexer,
-                                voxel_block_buffer_indexer);
-                    };
-
                     // Natural index (0, N) -> (block_idx, voxel_idx)
                     int64_t workload_block_idx = workload_idx / resolution3;
                     int64_t block_idx = indices_ptr[workload_block_idx];
@@ -435,37 +949,71 @@ void ExtractSurfacePointsCPU
                     int64_t xv, yv, zv;
                     voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
 
-                    voxel_t* voxel_ptr = voxel_block_buffer_indexer
-                                                 .GetDataPtrFromCoord<voxel_t>(
-                                                         xv, yv, zv, block_idx);
-                    float tsdf_o = voxel_ptr->GetTSDF();
-                    float weight_o = voxel_ptr->GetWeight();
-                    if (weight_o <= weight_threshold) return;
-
-                    // Enumerate x-y-z directions
-                    for (int i = 0; i < 3; ++i) {
-                        voxel_t* ptr = GetVoxelAt(
-                                static_cast<int>(xv) + (i == 0),
-                                static_cast<int>(yv) + (i == 1),
-                                static_cast<int>(zv) + (i == 2),
-                                static_cast<int>(workload_block_idx));
-                        if (ptr == nullptr) continue;
-
-                        float tsdf_i = ptr->GetTSDF();
-                        float weight_i = ptr->GetWeight();
-
-                        if (weight_i > weight_threshold &&
-                            tsdf_i * tsdf_o < 0) {
-                            OPEN3D_ATOMIC_ADD(count_ptr, 1);
-                        }
+                    int crossings = DeviceGetSurfaceCrossings<voxel_t>(
+                            static_cast<int>(xv), static_cast<int>(yv),
+                            static_cast<int>(zv),
+                            static_cast<int>(workload_block_idx), block_idx,
+                            static_cast<int>(resolution), weight_threshold,
+                            nb_block_masks_indexer, nb_block_indices_indexer,
+                            voxel_block_buffer_indexer);
+                    if (crossings != 0) {
+                        OPEN3D_ATOMIC_ADD(count_ptr, CountBits3(crossings));
                     }
                 });
             });
 
-#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
     int total_count = count.Item<int>();
+
+    // Reset count
+    count = core::Tensor(std::vector<int>{0}, {}, core::Dtype::Int32,
+                         block_values.GetDevice());
+    count_ptr = static_cast<int*>(count.GetDataPtr());
 #else
-    int total_count = (*count_ptr).load();
+    // Count per block and keep the crossing masks, so that the extraction
+    // pass writes to precomputed offsets without re-testing the voxels.
+    std::vector<uint8_t> crossings_buffer(n);
+    std::vector<int> block_counts(n_blocks);
+    uint8_t* crossings_ptr = crossings_buffer.data();
+    int* block_counts_ptr = block_counts.data();
+
+    DISPATCH_BYTESIZE_TO_VOXEL(
+            voxel_block_buffer_indexer.ElementByteSize(), [&]() {
+                launcher.LaunchGeneralKernel(
+                        n_blocks, [&](int64_t workload_block_idx) {
+                            int64_t block_idx =
+                                    indices_ptr[workload_block_idx];
+                            int64_t offset = workload_block_idx * resolution3;
+                            int count = 0;
+                            for (int64_t voxel_idx = 0;
+                                 voxel_idx < resolution3; ++voxel_idx) {
+                                int64_t xv, yv, zv;
+                                voxel_indexer.WorkloadToCoord(voxel_idx, &xv,
+                                                              &yv, &zv);
+                                int crossings =
+                                        DeviceGetSurfaceCrossings<voxel_t>(
+                                                static_cast<int>(xv),
+                                                static_cast<int>(yv),
+                                                static_cast<int>(zv),
+                                                static_cast<int>(
+                                                        workload_block_idx),
+                                                block_idx,
+                                                static_cast<int>(resolution),
+                                                weight_threshold,
+                                                nb_block_masks_indexer,
+                                                nb_block_indices_indexer,
+                                                voxel_block_buffer_indexer);
+                                crossings_ptr[offset + voxel_idx] =
+                                        static_cast<uint8_t>(crossings);
+                                count += CountBits3(crossings);
+                            }
+                            block_counts_ptr[workload_block_idx] = count;
+                        });
+            });
+
+    // Exclusive scan into per-block write cursors.
+    std::vector<int> block_offsets;
+    int total_count = ExclusiveScanCPU(block_counts, block_offsets);
+    int* block_cursors_ptr = block_offsets.data();
 #endif
     utility::LogInfo("Total point count = {}", total_count);
 
@@ -476,15 +1024,6 @@ void ExtractSurfacePointsCPU
     NDArrayIndexer point_indexer(points, 1);
     NDArrayIndexer normal_indexer(normals, 1);
 
-    // Reset count
-#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
-    count = core::Tensor(std::vector<int>{0}, {}, core::Dtype::Int32,
-                         block_values.GetDevice());
-    count_ptr = static_cast<int*>(count.GetDataPtr());
-#else
-    (*count_ptr) = 0;
-#endif
-
     // This pass extracts exact surface points.
     DISPATCH_BYTESIZE_TO_VOXEL(
             voxel_block_buffer_indexer.ElementByteSize(), [&]() {
@@ -498,8 +1037,7 @@ void ExtractSurfacePointsCPU
                     color_indexer = NDArrayIndexer(colors, 1);
                 }
 
-                launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
-                                                        int64_t workload_idx) {
+                auto kernel = [=] OPEN3D_DEVICE(int64_t workload_idx) {
                     auto GetVoxelAt = [&] OPEN3D_DEVICE(
                                               int xo, int yo, int zo,
                                               int curr_block_idx) -> voxel_t* {
@@ -526,6 +1064,30 @@ void ExtractSurfacePointsCPU
                     int64_t block_idx = indices_ptr[workload_block_idx];
                     int64_t voxel_idx = workload_idx % resolution3;
 
+                    // voxel_idx -> (x_voxel, y_voxel, z_voxel)
+                    int64_t xv, yv, zv;
+                    voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+                    int crossings = DeviceGetSurfaceCrossings<voxel_t>(
+                            static_cast<int>(xv), static_cast<int>(yv),
+                            static_cast<int>(zv),
+                            static_cast<int>(workload_block_idx), block_idx,
+                            static_cast<int>(resolution), weight_threshold,
+                            nb_block_masks_indexer, nb_block_indices_indexer,
+                            voxel_block_buffer_indexer);
+                    if (crossings == 0) return;
+                    int idx = OPEN3D_ATOMIC_ADD(count_ptr,
+                                                CountBits3(crossings));
+#else
+                    int crossings = crossings_ptr[workload_idx];
+                    if (crossings == 0) return;
+                    // Voxels of a block are visited in order by one thread.
+                    int idx = block_cursors_ptr[workload_block_idx];
+                    block_cursors_ptr[workload_block_idx] +=
+                            CountBits3(crossings);
+#endif
+
                     /// Coordinate transform
                     // block_idx -> (x_block, y_block, z_block)
                     int* block_key_ptr =
@@ -535,17 +1097,10 @@ void ExtractSurfacePointsCPU
                     int64_t yb = static_cast<int64_t>(block_key_ptr[1]);
                     int64_t zb = static_cast<int64_t>(block_key_ptr[2]);
 
-                    // voxel_idx -> (x_voxel, y_voxel, z_voxel)
-                    int64_t xv, yv, zv;
-                    voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
-
                     voxel_t* voxel_ptr = voxel_block_buffer_indexer
                                                  .GetDataPtrFromCoord<voxel_t>(
                                                          xv, yv, zv, block_idx);
                     float tsdf_o = voxel_ptr->GetTSDF();
-                    float weight_o = voxel_ptr->GetWeight();
-
-                    if (weight_o <= weight_threshold) return;
 
                     int64_t x = xb * resolution + xv;
                     int64_t y = yb * resolution + yv;
@@ -558,76 +1113,66 @@ void ExtractSurfacePointsCPU
 
                     // Enumerate x-y-z axis
                     for (int i = 0; i < 3; ++i) {
+                        if (!(crossings & (1 << i))) continue;
+
                         voxel_t* ptr = GetVoxelAt(
                                 static_cast<int>(xv) + (i == 0),
                                 static_cast<int>(yv) + (i == 1),
                                 static_cast<int>(zv) + (i == 2),
                                 static_cast<int>(workload_block_idx));
-                        if (ptr == nullptr) continue;
-
                         float tsdf_i = ptr->GetTSDF();
-                        float weight_i = ptr->GetWeight();
-
-                        if (weight_i > weight_threshold &&
-                            tsdf_i * tsdf_o < 0) {
-                            float ratio = (0 - tsdf_o) / (tsdf_i - tsdf_o);
+                        float ratio = (0 - tsdf_o) / (tsdf_i - tsdf_o);
+
+                        float* point_ptr =
+                                point_indexer.GetDataPtrFromCoord<float>(idx);
+                        point_ptr[0] = voxel_size * (x + ratio * int(i == 0));
+                        point_ptr[1] = voxel_size * (y + ratio * int(i == 1));
+                        point_ptr[2] = voxel_size * (z + ratio * int(i == 2));
+                        GetNormalAt(static_cast<int>(xv) + (i == 0),
+                                    static_cast<int>(yv) + (i == 1),
+                                    static_cast<int>(zv) + (i == 2),
+                                    static_cast<int>(workload_block_idx), ni);
 
-                            int idx = OPEN3D_ATOMIC_ADD(count_ptr, 1);
+                        float* normal_ptr =
+                                normal_indexer.GetDataPtrFromCoord<float>(idx);
+                        float nx = (1 - ratio) * no[0] + ratio * ni[0];
+                        float ny = (1 - ratio) * no[1] + ratio * ni[1];
+                        float nz = (1 - ratio) * no[2] + ratio * ni[2];
+                        float norm = static_cast<float>(
+                                sqrt(nx * nx + ny * ny + nz * nz) + 1e-5);
+                        normal_ptr[0] = nx / norm;
+                        normal_ptr[1] = ny / norm;
+                        normal_ptr[2] = nz / norm;
 
-                            float* point_ptr =
-                                    point_indexer.GetDataPtrFromCoord<float>(
-                                            idx);
-                            point_ptr[0] =
-                                    voxel_size * (x + ratio * int(i == 0));
-                            point_ptr[1] =
-                                    voxel_size * (y + ratio * int(i == 1));
-                            point_ptr[2] =
-                                    voxel_size * (z + ratio * int(i == 2));
-                            GetNormalAt(static_cast<int>(xv) + (i == 0),
-                                        static_cast<int>(yv) + (i == 1),
-                                        static_cast<int>(zv) + (i == 2),
-                                        static_cast<int>(workload_block_idx),
-                                        ni);
-
-                            float* normal_ptr =
-                                    normal_indexer.GetDataPtrFromCoord<float>(
+                        if (extract_color) {
+                            float* color_ptr =
+                                    color_indexer.GetDataPtrFromCoord<float>(
                                             idx);
-                            float nx = (1 - ratio) * no[0] + ratio * ni[0];
-                            float ny = (1 - ratio) * no[1] + ratio * ni[1];
-                            float nz = (1 - ratio) * no[2] + ratio * ni[2];
-                            float norm = static_cast<float>(
-                                    sqrt(nx * nx + ny * ny + nz * nz) + 1e-5);
-                            normal_ptr[0] = nx / norm;
-                            normal_ptr[1] = ny / norm;
-                            normal_ptr[2] = nz / norm;
-
-                            if (extract_color) {
-                                float* color_ptr =
-                                        color_indexer
-                                                .GetDataPtrFromCoord<float>(
-                                                        idx);
-
-                                float r_o = voxel_ptr->GetR();
-                                float g_o = voxel_ptr->GetG();
-                                float b_o = voxel_ptr->GetB();
-
-                                float r_i = ptr->GetR();
-                                float g_i = ptr->GetG();
-                                float b_i = ptr->GetB();
-
-                                color_ptr[0] =
-                                        ((1 - ratio) * r_o + ratio * r_i) /
-                                        255.0f;
-                                color_ptr[1] =
-                                        ((1 - ratio) * g_o + ratio * g_i) /
-                                        255.0f;
-                                color_ptr[2] =
-                                        ((1 - ratio) * b_o + ratio * b_i) /
-                                        255.0f;
-                            }
+
+                            float r_o = voxel_ptr->GetR();
+                            float g_o = voxel_ptr->GetG();
+                            float b_o = voxel_ptr->GetB();
+
+                            float r_i = ptr->GetR();
+                            float g_i = ptr->GetG();
+                            float b_i = ptr->GetB();
+
+                            color_ptr[0] =
+                                    ((1 - ratio) * r_o + ratio * r_i) / 255.0f;
+                            color_ptr[1] =
+                                    ((1 - ratio) * g_o + ratio * g_i) / 255.0f;
+                            color_ptr[2] =
+                                    ((1 - ratio) * b_o + ratio * b_i) / 255.0f;
                         }
+                        ++idx;
                     }
-                });
+                };
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+                launcher.LaunchGeneralKernel(n, kernel);
+#else
+                LaunchBlockwiseKernelCPU(n_blocks, resolution3, kernel);
+#endif
             });
 }
 
@@ -788,18 +1333,9 @@ void ExtractSurfaceMeshCPU
     core::Tensor vtx_count(std::vector<int>{0}, {}, core::Dtype::Int32,
                            block_values.GetDevice());
     int* vtx_count_ptr = static_cast<int*>(vtx_count.GetDataPtr());
-#else
-    std::atomic<int> vtx_count_atomic(0);
-    std::atomic<int>* vtx_count_ptr = &vtx_count_atomic;
-#endif
 
-#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
     core::kernel::CUDALauncher::LaunchGeneralKernel(
             n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
-#else
-    core::kernel::CPULauncher::LaunchGeneralKernel(
-            n, [&](int64_t workload_idx) {
-#endif
                 // Natural index (0, N) -> (block_idx, voxel_idx)
                 int64_t workload_block_idx = workload_idx / resolution3;
                 int64_t voxel_idx = workload_idx % resolution3;
@@ -829,14 +1365,46 @@ void ExtractSurfaceMeshCPU
             });
 
     // Reset count_ptr
-#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
     int total_vtx_count = vtx_count.Item<int>();
     vtx_count = core::Tensor(std::vector<int>{0}, {}, core::Dtype::Int32,
                              block_values.GetDevice());
     vtx_count_ptr = static_cast<int*>(vtx_count.GetDataPtr());
 #else
-    int total_vtx_count = (*vtx_count_ptr).load();
-    (*vtx_count_ptr) = 0;
+    // Count vertices and triangles per block, then scan the counts into
+    // per-block write cursors for passes 2 and 3.
+    std::vector<int> block_vtx_counts(n_blocks);
+    std::vector<int> block_tri_counts(n_blocks);
+    int* block_vtx_counts_ptr = block_vtx_counts.data();
+    int* block_tri_counts_ptr = block_tri_counts.data();
+
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            n_blocks, [&](int64_t workload_block_idx) {
+                int block_vtx_count = 0;
+                int block_tri_count = 0;
+                for (int64_t voxel_idx = 0; voxel_idx < resolution3;
+                     ++voxel_idx) {
+                    // voxel_idx -> (x_voxel, y_voxel, z_voxel)
+                    int64_t xv, yv, zv;
+                    voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
+
+                    // Obtain voxel's mesh struct ptr
+                    int* mesh_struct_ptr =
+                            mesh_structure_indexer.GetDataPtrFromCoord<int>(
+                                    xv, yv, zv, workload_block_idx);
+                    for (int e = 0; e < 3; ++e) {
+                        block_vtx_count += (mesh_struct_ptr[e] == -1);
+                    }
+                    block_tri_count += tri_count[mesh_struct_ptr[3]];
+                }
+                block_vtx_counts_ptr[workload_block_idx] = block_vtx_count;
+                block_tri_counts_ptr[workload_block_idx] = block_tri_count;
+            });
+
+    std::vector<int> vtx_offsets, tri_offsets;
+    int total_vtx_count = ExclusiveScanCPU(block_vtx_counts, vtx_offsets);
+    int total_tri_count = ExclusiveScanCPU(block_tri_counts, tri_offsets);
+    int* vtx_cursors_ptr = vtx_offsets.data();
+    int* tri_cursors_ptr = tri_offsets.data();
 #endif
 
     utility::LogInfo("Total vertex count = {}", total_vtx_count);
@@ -861,8 +1429,7 @@ void ExtractSurfaceMeshCPU
                                           block_values.GetDevice());
                     color_indexer = NDArrayIndexer(colors, 1);
                 }
-                launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
-                                                        int64_t workload_idx) {
+                auto kernel = [=] OPEN3D_DEVICE(int64_t workload_idx) {
                     auto GetVoxelAt = [&] OPEN3D_DEVICE(
                                               int xo, int yo, int zo,
                                               int curr_block_idx) -> voxel_t* {
@@ -941,7 +1508,11 @@ void ExtractSurfaceMeshCPU
                         float tsdf_e = voxel_ptr_e->GetTSDF();
                         float ratio = (0 - tsdf_o) / (tsdf_e - tsdf_o);
 
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
                         int idx = OPEN3D_ATOMIC_ADD(vtx_count_ptr, 1);
+#else
+                        int idx = vtx_cursors_ptr[workload_block_idx]++;
+#endif
                         mesh_struct_ptr[e] = idx;
 
                         float ratio_x = ratio * int(e == 0);
@@ -988,7 +1559,13 @@ void ExtractSurfaceMeshCPU
                                     ((1 - ratio) * b_o + ratio * b_e) / 255.0f;
                         }
                     }
-                });
+                };
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+                launcher.LaunchGeneralKernel(n, kernel);
+#else
+                LaunchBlockwiseKernelCPU(n_blocks, resolution3, kernel);
+#endif
             });
 
     // Pass 3: connect vertices and form triangles.
@@ -996,84 +1573,319 @@ void ExtractSurfaceMeshCPU
     core::Tensor triangle_count(std::vector<int>{0}, {}, core::Dtype::Int32,
                                 block_values.GetDevice());
     int* tri_count_ptr = static_cast<int*>(triangle_count.GetDataPtr());
-#else
-    std::atomic<int> tri_count_atomic(0);
-    std::atomic<int>* tri_count_ptr = &tri_count_atomic;
-#endif
 
     triangles = core::Tensor({total_vtx_count * 3, 3}, core::Dtype::Int64,
                              block_values.GetDevice());
+#else
+    triangles = core::Tensor({total_tri_count, 3}, core::Dtype::Int64,
+                             block_values.GetDevice());
+#endif
     NDArrayIndexer triangle_indexer(triangles, 1);
 
+    auto kernel = [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        // Natural index (0, N) -> (block_idx, voxel_idx)
+        int64_t workload_block_idx = workload_idx / resolution3;
+        int64_t voxel_idx = workload_idx % resolution3;
+
+        // voxel_idx -> (x_voxel, y_voxel, z_voxel)
+        int64_t xv, yv, zv;
+        voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
+
+        // Obtain voxel's mesh struct ptr
+        int* mesh_struct_ptr = mesh_structure_indexer.GetDataPtrFromCoord<int>(
+                xv, yv, zv, workload_block_idx);
+
+        int table_idx = mesh_struct_ptr[3];
+        if (tri_count[table_idx] == 0) return;
+
+        for (size_t tri = 0; tri < 16; tri += 3) {
+            if (tri_table[table_idx][tri] == -1) return;
+
 #if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
-    core::kernel::CUDALauncher::LaunchGeneralKernel(
-            n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            int tri_idx = OPEN3D_ATOMIC_ADD(tri_count_ptr, 1);
 #else
-    core::kernel::CPULauncher::LaunchGeneralKernel(
-            n, [&](int64_t workload_idx) {
+            int tri_idx = tri_cursors_ptr[workload_block_idx]++;
 #endif
-                // Natural index (0, N) -> (block_idx,
-                // voxel_idx)
-                int64_t workload_block_idx = workload_idx / resolution3;
-                int64_t voxel_idx = workload_idx % resolution3;
 
-                // voxel_idx -> (x_voxel, y_voxel, z_voxel)
-                int64_t xv, yv, zv;
-                voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
+            for (size_t vertex = 0; vertex < 3; ++vertex) {
+                int edge = tri_table[table_idx][tri + vertex];
 
-                // Obtain voxel's mesh struct ptr
-                int* mesh_struct_ptr =
+                int64_t xv_i = xv + edge_shifts[edge][0];
+                int64_t yv_i = yv + edge_shifts[edge][1];
+                int64_t zv_i = zv + edge_shifts[edge][2];
+                int64_t edge_i = edge_shifts[edge][3];
+
+                int dxb = static_cast<int>(xv_i / resolution);
+                int dyb = static_cast<int>(yv_i / resolution);
+                int dzb = static_cast<int>(zv_i / resolution);
+
+                int nb_idx = (dxb + 1) + (dyb + 1) * 3 + (dzb + 1) * 9;
+
+                int64_t block_idx_i =
+                        *nb_block_indices_indexer.GetDataPtrFromCoord<int64_t>(
+                                workload_block_idx, nb_idx);
+                int* mesh_struct_ptr_i =
                         mesh_structure_indexer.GetDataPtrFromCoord<int>(
-                                xv, yv, zv, workload_block_idx);
+                                xv_i - dxb * resolution,
+                                yv_i - dyb * resolution,
+                                zv_i - dzb * resolution,
+                                inv_indices_ptr[block_idx_i]);
+
+                int64_t* triangle_ptr =
+                        triangle_indexer.GetDataPtrFromCoord<int64_t>(tri_idx);
+                triangle_ptr[2 - vertex] = mesh_struct_ptr_i[edge_i];
+            }
+        }
+    };
 
-                int table_idx = mesh_struct_ptr[3];
-                if (tri_count[table_idx] == 0) return;
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    launcher.LaunchGeneralKernel(n, kernel);
 
-                for (size_t tri = 0; tri < 16; tri += 3) {
-                    if (tri_table[table_idx][tri] == -1) return;
+    int total_tri_count = triangle_count.Item<int>();
+    utility::LogInfo("Total triangle count = {}", total_tri_count);
+    triangles = triangles.Slice(0, 0, total_tri_count);
+#else
+    LaunchBlockwiseKernelCPU(n_blocks, resolution3, kernel);
 
-                    int tri_idx = OPEN3D_ATOMIC_ADD(tri_count_ptr, 1);
+    utility::LogInfo("Total triangle count = {}", total_tri_count);
+#endif
+}
 
-                    for (size_t vertex = 0; vertex < 3; ++vertex) {
-                        int edge = tri_table[table_idx][tri + vertex];
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void RayCastCUDA
+#else
+void RayCastCPU
+#endif
+        (const core::Tensor& indices,
+         const core::Tensor& block_keys,
+         const core::Tensor& block_values,
+         core::Tensor& vertex_map,
+         core::Tensor& depth_map,
+         core::Tensor& color_map,
+         core::Tensor& normal_map,
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         int64_t h,
+         int64_t w,
+         int64_t block_resolution,
+         float voxel_size,
+         float sdf_trunc,
+         float depth_scale,
+         float depth_min,
+         float depth_max,
+         float weight_threshold) {
+    core::Device device = block_keys.GetDevice();
 
-                        int64_t xv_i = xv + edge_shifts[edge][0];
-                        int64_t yv_i = yv + edge_shifts[edge][1];
-                        int64_t zv_i = zv + edge_shifts[edge][2];
-                        int64_t edge_i = edge_shifts[edge][3];
+    int64_t mask;
+    core::Tensor block_table = BuildBlockLookupTable(indices, block_keys, mask);
+    const int64_t* table_ptr =
+            static_cast<const int64_t*>(block_table.GetDataPtr());
 
-                        int dxb = static_cast<int>(xv_i / resolution);
-                        int dyb = static_cast<int>(yv_i / resolution);
-                        int dzb = static_cast<int>(zv_i / resolution);
+    // Rays are generated in the world frame with the inverse extrinsics, and
+    // normals are rotated back to the camera frame with the extrinsics.
+    core::Tensor extrinsics_inv = extrinsics.Inverse();
+    TransformIndexer c2w_transform_indexer(intrinsics, extrinsics_inv);
+    TransformIndexer w2c_transform_indexer(intrinsics, extrinsics);
 
-                        int nb_idx = (dxb + 1) + (dyb + 1) * 3 + (dzb + 1) * 9;
+    NDArrayIndexer block_keys_indexer(block_keys, 1);
+    NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
 
-                        int64_t block_idx_i =
-                                *nb_block_indices_indexer
-                                         .GetDataPtrFromCoord<int64_t>(
-                                                 workload_block_idx, nb_idx);
-                        int* mesh_struct_ptr_i =
-                                mesh_structure_indexer.GetDataPtrFromCoord<int>(
-                                        xv_i - dxb * resolution,
-                                        yv_i - dyb * resolution,
-                                        zv_i - dzb * resolution,
-                                        inv_indices_ptr[block_idx_i]);
+    vertex_map = core::Tensor::Zeros({h, w, 3}, core::Dtype::Float32, device);
+    depth_map = core::Tensor::Zeros({h, w, 1}, core::Dtype::Float32, device);
+    normal_map = core::Tensor::Zeros({h, w, 3}, core::Dtype::Float32, device);
+    NDArrayIndexer vertex_map_indexer(vertex_map, 2);
+    NDArrayIndexer depth_map_indexer(depth_map, 2);
+    NDArrayIndexer normal_map_indexer(normal_map, 2);
 
-                        int64_t* triangle_ptr =
-                                triangle_indexer.GetDataPtrFromCoord<int64_t>(
-                                        tri_idx);
-                        triangle_ptr[2 - vertex] = mesh_struct_ptr_i[edge_i];
-                    }
-                }
-            });
+    int resolution = static_cast<int>(block_resolution);
+    float block_size = voxel_size * block_resolution;
 
 #if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
-    int total_tri_count = triangle_count.Item<int>();
+    core::kernel::CUDALauncher launcher;
 #else
-    int total_tri_count = (*tri_count_ptr).load();
+    core::kernel::CPULauncher launcher;
 #endif
-    utility::LogInfo("Total triangle count = {}", total_tri_count);
-    triangles = triangles.Slice(0, 0, total_tri_count);
+
+    DISPATCH_BYTESIZE_TO_VOXEL(
+            voxel_block_buffer_indexer.ElementByteSize(), [&]() {
+                bool has_color = voxel_t::HasColor();
+                NDArrayIndexer color_map_indexer;
+                if (has_color) {
+                    color_map = core::Tensor::Zeros(
+                            {h, w, 3}, core::Dtype::Float32, device);
+                    color_map_indexer = NDArrayIndexer(color_map, 2);
+                } else {
+                    color_map = core::Tensor();
+                }
+
+                auto kernel = [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t y = workload_idx / w;
+                    int64_t x = workload_idx % w;
+
+                    // Ray origin and direction in the world frame (in
+                    // meter). The direction is scaled so that the ray
+                    // parameter t is the depth in the camera frame.
+                    float x_c, y_c, z_c;
+                    float o[3], d[3];
+                    c2w_transform_indexer.RigidTransform(0, 0, 0, &o[0], &o[1],
+                                                         &o[2]);
+                    c2w_transform_indexer.Unproject(
+                            static_cast<float>(x), static_cast<float>(y), 1.0f,
+                            &x_c, &y_c, &z_c);
+                    c2w_transform_indexer.Rotate(x_c, y_c, z_c, &d[0], &d[1],
+                                                 &d[2]);
+                    float inv_ray_norm = 1.0f / sqrtf(d[0] * d[0] +
+                                                      d[1] * d[1] +
+                                                      d[2] * d[2]);
+
+                    // Last visited block, to avoid repeated lookups.
+                    int b_cache[3] = {0, 0, 0};
+                    int64_t block_idx = -1;
+                    bool cache_valid = false;
+
+                    float t = depth_min, t_prev = depth_min;
+                    float tsdf = 0, tsdf_prev = 0;
+                    bool has_prev = false;
+                    bool hit = false;
+                    while (t < depth_max) {
+                        float p[3] = {o[0] + t * d[0], o[1] + t * d[1],
+                                      o[2] + t * d[2]};
+
+                        // Nearest voxel and its block.
+                        int v[3], b[3];
+                        for (int i = 0; i < 3; ++i) {
+                            v[i] = static_cast<int>(
+                                    floorf(p[i] / voxel_size + 0.5f));
+                            b[i] = FloorDiv(v[i], resolution);
+                        }
+                        if (!cache_valid || b[0] != b_cache[0] ||
+                            b[1] != b_cache[1] || b[2] != b_cache[2]) {
+                            block_idx = DeviceLookupBlock(
+                                    b[0], b[1], b[2], table_ptr, mask,
+                                    block_keys_indexer);
+                            b_cache[0] = b[0];
+                            b_cache[1] = b[1];
+                            b_cache[2] = b[2];
+                            cache_valid = true;
+                        }
+
+                        if (block_idx < 0) {
+                            // Empty space skipping: jump to where the ray
+                            // leaves the unallocated block.
+                            float t_exit = depth_max;
+                            for (int i = 0; i < 3; ++i) {
+                                if (fabsf(d[i]) < 1e-6f) continue;
+                                float bound =
+                                        (b[i] + (d[i] > 0 ? 1 : 0)) *
+                                                block_size -
+                                        0.5f * voxel_size;
+                                float t_i = (bound - o[i]) / d[i];
+                                t_exit = t_i < t_exit ? t_i : t_exit;
+                            }
+                            t = (t_exit > t ? t_exit : t) +
+                                1e-3f * voxel_size;
+                            has_prev = false;
+                            continue;
+                        }
+
+                        voxel_t* voxel_ptr =
+                                voxel_block_buffer_indexer
+                                        .GetDataPtrFromCoord<voxel_t>(
+                                                v[0] - b[0] * resolution,
+                                                v[1] - b[1] * resolution,
+                                                v[2] - b[2] * resolution,
+                                                block_idx);
+                        if (voxel_ptr->GetWeight() <= weight_threshold) {
+                            has_prev = false;
+                            t += voxel_size * inv_ray_norm;
+                            continue;
+                        }
+
+                        tsdf = voxel_ptr->GetTSDF();
+                        if (has_prev && tsdf_prev > 0 && tsdf <= 0) {
+                            hit = true;
+                            break;
+                        }
+
+                        t_prev = t;
+                        tsdf_prev = tsdf;
+                        has_prev = true;
+
+                        // Step by the distance to the surface bounded by the
+                        // TSDF, but at least one voxel.
+                        float step = tsdf * sdf_trunc;
+                        step = step > voxel_size ? step : voxel_size;
+                        t += step * inv_ray_norm;
+                    }
+                    if (!hit) return;
+
+                    // Refine the zero crossing with trilinear interpolation,
+                    // and fall back to the nearest voxel estimates if the
+                    // neighborhood is not fully observed.
+                    float inv_voxel_size = 1.0f / voxel_size;
+                    auto GetTrilinearAt = [&] OPEN3D_DEVICE(
+                                                  float t_i, float* tsdf_i,
+                                                  float* gradient_i,
+                                                  float* color_i) {
+                        return DeviceGetTrilinearAt<voxel_t>(
+                                (o[0] + t_i * d[0]) * inv_voxel_size,
+                                (o[1] + t_i * d[1]) * inv_voxel_size,
+                                (o[2] + t_i * d[2]) * inv_voxel_size,
+                                resolution, weight_threshold, table_ptr, mask,
+                                block_keys_indexer, voxel_block_buffer_indexer,
+                                tsdf_i, gradient_i, color_i);
+                    };
+                    float tsdf_a, tsdf_b;
+                    if (GetTrilinearAt(t_prev, &tsdf_a, nullptr, nullptr) &&
+                        GetTrilinearAt(t, &tsdf_b, nullptr, nullptr) &&
+                        tsdf_a > 0 && tsdf_b <= 0) {
+                        tsdf_prev = tsdf_a;
+                        tsdf = tsdf_b;
+                    }
+                    float t_hit = t_prev + (t - t_prev) * tsdf_prev /
+                                                   (tsdf_prev - tsdf);
+
+                    // Depth and vertex in the camera frame.
+                    float* depth_ptr =
+                            depth_map_indexer.GetDataPtrFromCoord<float>(x, y);
+                    *depth_ptr = t_hit * depth_scale;
+                    float* vertex_ptr =
+                            vertex_map_indexer.GetDataPtrFromCoord<float>(x,
+                                                                          y);
+                    c2w_transform_indexer.Unproject(
+                            static_cast<float>(x), static_cast<float>(y),
+                            t_hit, &vertex_ptr[0], &vertex_ptr[1],
+                            &vertex_ptr[2]);
+
+                    // Normal (rotated to the camera frame) and color.
+                    float tsdf_hit, gradient[3], color[3];
+                    if (!GetTrilinearAt(t_hit, &tsdf_hit, gradient,
+                                        has_color ? color : nullptr)) {
+                        return;
+                    }
+                    float norm = sqrtf(gradient[0] * gradient[0] +
+                                       gradient[1] * gradient[1] +
+                                       gradient[2] * gradient[2]);
+                    if (norm > 0) {
+                        float* normal_ptr =
+                                normal_map_indexer.GetDataPtrFromCoord<float>(
+                                        x, y);
+                        w2c_transform_indexer.Rotate(
+                                gradient[0] / norm, gradient[1] / norm,
+                                gradient[2] / norm, &normal_ptr[0],
+                                &normal_ptr[1], &normal_ptr[2]);
+                    }
+                    if (has_color) {
+                        float* color_ptr =
+                                color_map_indexer.GetDataPtrFromCoord<float>(
+                                        x, y);
+                        color_ptr[0] = color[0] / 255.0f;
+                        color_ptr[1] = color[1] / 255.0f;
+                        color_ptr[2] = color[2] / 255.0f;
+                    }
+                };
+                launcher.LaunchGeneralKernel(h * w, kernel);
+            });
 }
 
 }  // namespace tsdf
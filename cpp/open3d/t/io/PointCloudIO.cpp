@@ -33,6 +33,7 @@
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Profiler.h"
 #include "open3d/utility/ProgressReporters.h"
 
 namespace open3d {
@@ -71,6 +72,7 @@ std::shared_ptr<geometry::PointCloud> CreatetPointCloudFromFile(
 bool ReadPointCloud(const std::string &filename,
                     geometry::PointCloud &pointcloud,
                     const open3d::io::ReadPointCloudOption &params) {
+    OPEN3D_PROFILE_SCOPE("t::io::ReadPointCloud");
     std::string format = params.format;
     if (format == "auto") {
         format = utility::filesystem::GetFileExtensionInLowerCase(filename);
@@ -127,6 +129,7 @@ bool ReadPointCloud(const std::string &filename,
 bool WritePointCloud(const std::string &filename,
                      const geometry::PointCloud &pointcloud,
                      const open3d::io::WritePointCloudOption &params) {
+    OPEN3D_PROFILE_SCOPE("t::io::WritePointCloud");
     std::string format =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     auto map_itr = file_extension_to_pointcloud_write_function.find(format);
@@ -0,0 +1,86 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/TriangleMeshIO.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// Factory function to create a mesh from a file.
+/// Return an empty mesh if fail to read the file.
+std::shared_ptr<geometry::TriangleMesh> CreateMeshFromFile(
+        const std::string &filename, bool print_progress = false);
+
+/// The general entrance for reading a TriangleMesh from a file
+/// The function calls read functions based on the extension name of filename.
+/// Formats without a tensor reader are read with open3d::io::ReadTriangleMesh
+/// and converted.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadTriangleMesh(const std::string &filename,
+                      geometry::TriangleMesh &mesh,
+                      bool enable_post_processing = false,
+                      bool print_progress = false);
+
+/// The general entrance for writing a TriangleMesh to a file
+/// The mesh is converted to a legacy TriangleMesh and written with
+/// open3d::io::WriteTriangleMesh.
+/// \return return true if the write function is successful, false otherwise.
+bool WriteTriangleMesh(const std::string &filename,
+                       const geometry::TriangleMesh &mesh,
+                       bool write_ascii = false,
+                       bool compressed = false,
+                       bool write_vertex_normals = true,
+                       bool write_vertex_colors = true,
+                       bool write_triangle_uvs = true,
+                       bool print_progress = false);
+
+/// Reads an OBJ file by parsing chunks of lines in parallel. Polygons are
+/// triangulated as fans. A vertex is created for each distinct v/vt/vn
+/// triplet referenced by the faces, with "vertices", "normals", "colors" and
+/// "texture_uvs" (Float32) vertex attributes and Int64 triangles. Materials
+/// are not read.
+bool ReadTriangleMeshFromOBJ(const std::string &filename,
+                             geometry::TriangleMesh &mesh,
+                             bool print_progress);
+
+/// Reads an OBJ file with the parallel parser into a legacy TriangleMesh.
+/// Vertices follow the v lines of the file as in
+/// open3d::io::ReadTriangleMeshFromOBJ, with texture coordinates stored in
+/// triangle_uvs_. Materials are not read.
+bool ReadTriangleMeshFromOBJ(const std::string &filename,
+                             open3d::geometry::TriangleMesh &mesh,
+                             bool print_progress);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
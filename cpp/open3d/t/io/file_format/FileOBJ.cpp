@@ -0,0 +1,571 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/FileFormatIO.h"
+#include "open3d/t/io/TriangleMeshIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+// Files are split into chunks of about this size at line boundaries, and the
+// chunks are parsed in parallel.
+constexpr size_t kOBJChunkSize = size_t(1) << 20;
+
+// Flags of OBJCorner for indices given relative to the end of the element
+// list, which are resolved against chunk local counts while parsing and need
+// the element offset of the chunk.
+constexpr uint8_t kRelativeV = 1;
+constexpr uint8_t kRelativeVT = 2;
+constexpr uint8_t kRelativeVN = 4;
+
+/// v/vt/vn indices of a triangle corner, -1 if not given.
+struct OBJCorner {
+    int64_t v;
+    int64_t vt;
+    int64_t vn;
+    uint8_t relative;
+};
+
+/// Elements parsed from the lines of a chunk. Polygons are triangulated as
+/// fans, with 3 corners per triangle.
+struct OBJChunk {
+    std::vector<float> positions;
+    std::vector<float> colors;
+    std::vector<float> texcoords;
+    std::vector<float> normals;
+    std::vector<OBJCorner> corners;
+    int64_t num_colored_positions = 0;
+    std::string error;
+};
+
+/// Vertex, texture coordinate and normal lists and triangle corners of an OBJ
+/// file, with absolute indices.
+struct OBJData {
+    std::vector<float> positions;
+    std::vector<float> colors;
+    std::vector<float> texcoords;
+    std::vector<float> normals;
+    std::vector<OBJCorner> corners;
+    bool has_texcoords = false;
+    bool has_normals = false;
+};
+
+inline const char *SkipSpaces(const char *p) {
+    while (*p == ' ' || *p == '\t') ++p;
+    return p;
+}
+
+inline bool IsLineEnd(char c) {
+    return c == '\n' || c == '\r' || c == '#' || c == '\0';
+}
+
+/// Parses up to max_count floats, and returns the number parsed.
+inline int ParseFloats(const char *&p, float *values, int max_count) {
+    int count = 0;
+    while (count < max_count) {
+        p = SkipSpaces(p);
+        if (IsLineEnd(*p)) break;
+        char *next;
+        values[count] = std::strtof(p, &next);
+        if (next == p) break;
+        p = next;
+        count++;
+    }
+    return count;
+}
+
+/// Parses an index and converts it to a 0-based index. Negative indices are
+/// relative to the count of elements seen so far in the chunk, and set
+/// relative_flag in relative.
+inline bool ParseIndex(const char *&p,
+                       int64_t local_count,
+                       uint8_t relative_flag,
+                       int64_t &index,
+                       uint8_t &relative) {
+    char *next;
+    long long value = std::strtoll(p, &next, 10);
+    if (next == p || value == 0) {
+        return false;
+    }
+    p = next;
+    if (value > 0) {
+        index = value - 1;
+    } else {
+        index = local_count + value;
+        relative |= relative_flag;
+    }
+    return true;
+}
+
+void ParseOBJChunk(const char *begin, const char *end, OBJChunk &chunk) {
+    std::vector<OBJCorner> face;
+    int64_t line_number = 0;
+    for (const char *line = begin; line < end; line_number++) {
+        const char *line_end = static_cast<const char *>(
+                std::memchr(line, '\n', end - line));
+        line_end = line_end == nullptr ? end : line_end + 1;
+        const char *p = SkipSpaces(line);
+
+        if (p[0] == 'v' && (p[1] == ' ' || p[1] == '\t')) {
+            float values[6];
+            p += 2;
+            int count = ParseFloats(p, values, 6);
+            if (count < 3) {
+                chunk.error = "vertex with less than 3 coordinates";
+                return;
+            }
+            chunk.positions.insert(chunk.positions.end(), values, values + 3);
+            if (count == 6) {
+                chunk.colors.insert(chunk.colors.end(), values + 3,
+                                    values + 6);
+                chunk.num_colored_positions++;
+            }
+        } else if (p[0] == 'v' && p[1] == 't' &&
+                   (p[2] == ' ' || p[2] == '\t')) {
+            float values[3] = {0, 0, 0};
+            p += 3;
+            if (ParseFloats(p, values, 3) < 1) {
+                chunk.error = "texture coordinate without values";
+                return;
+            }
+            chunk.texcoords.insert(chunk.texcoords.end(), values, values + 2);
+        } else if (p[0] == 'v' && p[1] == 'n' &&
+                   (p[2] == ' ' || p[2] == '\t')) {
+            float values[3];
+            p += 3;
+            if (ParseFloats(p, values, 3) < 3) {
+                chunk.error = "normal with less than 3 coordinates";
+                return;
+            }
+            chunk.normals.insert(chunk.normals.end(), values, values + 3);
+        } else if (p[0] == 'f' && (p[1] == ' ' || p[1] == '\t')) {
+            p += 2;
+            face.clear();
+            const int64_t num_v = int64_t(chunk.positions.size() / 3);
+            const int64_t num_vt = int64_t(chunk.texcoords.size() / 2);
+            const int64_t num_vn = int64_t(chunk.normals.size() / 3);
+            while (true) {
+                p = SkipSpaces(p);
+                if (IsLineEnd(*p)) break;
+                OBJCorner corner{-1, -1, -1, 0};
+                bool valid = ParseIndex(p, num_v, kRelativeV, corner.v,
+                                        corner.relative);
+                if (valid && *p == '/') {
+                    ++p;
+                    if (*p != '/') {
+                        valid = ParseIndex(p, num_vt, kRelativeVT, corner.vt,
+                                           corner.relative);
+                    }
+                    if (valid && *p == '/') {
+                        ++p;
+                        valid = ParseIndex(p, num_vn, kRelativeVN, corner.vn,
+                                           corner.relative);
+                    }
+                }
+                if (!valid) {
+                    chunk.error = "invalid face index";
+                    return;
+                }
+                face.push_back(corner);
+            }
+            if (face.size() < 3) {
+                chunk.error = "facet with less than 3 vertices";
+                return;
+            }
+            for (size_t i = 1; i + 1 < face.size(); i++) {
+                chunk.corners.push_back(face[0]);
+                chunk.corners.push_back(face[i]);
+                chunk.corners.push_back(face[i + 1]);
+            }
+        }
+        line = line_end;
+    }
+}
+
+template <typename T>
+void CopyChunkElements(const std::vector<OBJChunk> &chunks,
+                       std::vector<T> OBJChunk::*member,
+                       std::vector<T> &output) {
+    std::vector<size_t> offsets(chunks.size() + 1, 0);
+    for (size_t c = 0; c < chunks.size(); c++) {
+        offsets[c + 1] = offsets[c] + (chunks[c].*member).size();
+    }
+    output.resize(offsets.back());
+#pragma omp parallel for schedule(static)
+    for (int c = 0; c < int(chunks.size()); c++) {
+        std::copy((chunks[c].*member).begin(), (chunks[c].*member).end(),
+                  output.begin() + offsets[c]);
+    }
+}
+
+bool ParseOBJFile(const std::string &filename,
+                  bool print_progress,
+                  OBJData &data) {
+    std::vector<char> buffer;
+    {
+        utility::filesystem::CFile file;
+        if (!file.Open(filename, "rb")) {
+            utility::LogWarning("Read OBJ failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        size_t size = size_t(file.GetFileSize());
+        // A trailing newline and terminator bound the parsing of every line.
+        buffer.resize(size + 2);
+        if (file.ReadData(buffer.data(), size) != size) {
+            utility::LogWarning("Read OBJ failed: unable to read file: {}",
+                                filename);
+            return false;
+        }
+        buffer[size] = '\n';
+        buffer[size + 1] = '\0';
+    }
+
+    const char *begin = buffer.data();
+    const char *end = begin + buffer.size() - 1;
+    std::vector<const char *> chunk_begins = {begin};
+    while (size_t(end - chunk_begins.back()) > kOBJChunkSize) {
+        const char *p = chunk_begins.back() + kOBJChunkSize;
+        p = static_cast<const char *>(std::memchr(p, '\n', end - p));
+        chunk_begins.push_back(p + 1);
+    }
+    chunk_begins.push_back(end);
+    const int num_chunks = int(chunk_begins.size()) - 1;
+
+    std::vector<OBJChunk> chunks(num_chunks);
+    utility::ConsoleProgressBar progress_bar(num_chunks, "Reading OBJ: ",
+                                             print_progress);
+#pragma omp parallel for schedule(dynamic)
+    for (int c = 0; c < num_chunks; c++) {
+        ParseOBJChunk(chunk_begins[c], chunk_begins[c + 1], chunks[c]);
+#pragma omp critical
+        { ++progress_bar; }
+    }
+    for (const auto &chunk : chunks) {
+        if (!chunk.error.empty()) {
+            utility::LogWarning("Read OBJ failed: {}", chunk.error);
+            return false;
+        }
+    }
+
+    CopyChunkElements(chunks, &OBJChunk::positions, data.positions);
+    CopyChunkElements(chunks, &OBJChunk::texcoords, data.texcoords);
+    CopyChunkElements(chunks, &OBJChunk::normals, data.normals);
+    int64_t num_colored_positions = 0;
+    for (const auto &chunk : chunks) {
+        num_colored_positions += chunk.num_colored_positions;
+    }
+    if (num_colored_positions * 3 == int64_t(data.positions.size())) {
+        CopyChunkElements(chunks, &OBJChunk::colors, data.colors);
+    }
+
+    // Resolve relative indices with the element offsets of the chunks.
+    std::vector<int64_t> v_offsets(num_chunks, 0), vt_offsets(num_chunks, 0),
+            vn_offsets(num_chunks, 0), corner_offsets(num_chunks + 1, 0);
+    for (int c = 1; c < num_chunks; c++) {
+        v_offsets[c] = v_offsets[c - 1] + chunks[c - 1].positions.size() / 3;
+        vt_offsets[c] = vt_offsets[c - 1] + chunks[c - 1].texcoords.size() / 2;
+        vn_offsets[c] = vn_offsets[c - 1] + chunks[c - 1].normals.size() / 3;
+    }
+    for (int c = 0; c < num_chunks; c++) {
+        corner_offsets[c + 1] = corner_offsets[c] + chunks[c].corners.size();
+    }
+    data.corners.resize(corner_offsets.back());
+    const int64_t num_v = int64_t(data.positions.size() / 3);
+    const int64_t num_vt = int64_t(data.texcoords.size() / 2);
+    const int64_t num_vn = int64_t(data.normals.size() / 3);
+    bool valid = true, has_texcoords = false, has_normals = false;
+#pragma omp parallel for schedule(static) \
+        reduction(&& : valid) reduction(|| : has_texcoords, has_normals)
+    for (int c = 0; c < num_chunks; c++) {
+        OBJCorner *output = data.corners.data() + corner_offsets[c];
+        for (OBJCorner corner : chunks[c].corners) {
+            if (corner.relative & kRelativeV) corner.v += v_offsets[c];
+            if (corner.relative & kRelativeVT) corner.vt += vt_offsets[c];
+            if (corner.relative & kRelativeVN) corner.vn += vn_offsets[c];
+            corner.relative = 0;
+            valid = valid && corner.v >= 0 && corner.v < num_v &&
+                    corner.vt < num_vt && corner.vn < num_vn &&
+                    corner.vt >= -1 && corner.vn >= -1;
+            has_texcoords = has_texcoords || corner.vt >= 0;
+            has_normals = has_normals || corner.vn >= 0;
+            *output++ = corner;
+        }
+    }
+    if (!valid) {
+        utility::LogWarning("Read OBJ failed: face index out of range.");
+        return false;
+    }
+    data.has_texcoords = has_texcoords;
+    data.has_normals = has_normals;
+    return true;
+}
+
+/// Assigns a vertex to each distinct v/vt/vn triplet. Corners are bucketed by
+/// position, and the triplets of each bucket are deduplicated in parallel.
+/// Vertices are ordered by position index, and positions not referenced by
+/// any face are kept as vertices without texture coordinates and normals.
+/// Returns the vertex of each corner, and the position index and the first
+/// corner (-1 for unreferenced positions) of each vertex.
+void DeduplicateOBJCorners(const OBJData &data,
+                           std::vector<int64_t> &corner_vertices,
+                           std::vector<int64_t> &vertex_positions,
+                           std::vector<int64_t> &vertex_corners) {
+    const int64_t num_positions = int64_t(data.positions.size() / 3);
+    const int64_t num_corners = int64_t(data.corners.size());
+
+    std::vector<int64_t> bucket_offsets(num_positions + 1, 0);
+    for (int64_t i = 0; i < num_corners; i++) {
+        bucket_offsets[data.corners[i].v + 1]++;
+    }
+    for (int64_t v = 0; v < num_positions; v++) {
+        bucket_offsets[v + 1] += bucket_offsets[v];
+    }
+    std::vector<int64_t> bucket_corners(num_corners);
+    {
+        std::vector<int64_t> cursors(bucket_offsets.begin(),
+                                     bucket_offsets.end() - 1);
+        for (int64_t i = 0; i < num_corners; i++) {
+            bucket_corners[cursors[data.corners[i].v]++] = i;
+        }
+    }
+
+    // Sort each bucket by (vt, vn), and count its distinct triplets. Corners
+    // were inserted in increasing order, and the stable sort keeps the
+    // vertex order deterministic.
+    corner_vertices.resize(num_corners);
+    std::vector<int64_t> vertex_offsets(num_positions + 1, 0);
+#pragma omp parallel for schedule(static)
+    for (int64_t v = 0; v < num_positions; v++) {
+        auto bucket_begin = bucket_corners.begin() + bucket_offsets[v];
+        auto bucket_end = bucket_corners.begin() + bucket_offsets[v + 1];
+        std::stable_sort(bucket_begin, bucket_end,
+                         [&](int64_t a, int64_t b) {
+                             const OBJCorner &ca = data.corners[a];
+                             const OBJCorner &cb = data.corners[b];
+                             return ca.vt < cb.vt ||
+                                    (ca.vt == cb.vt && ca.vn < cb.vn);
+                         });
+        int64_t count = 0;
+        for (auto it = bucket_begin; it != bucket_end; ++it) {
+            if (it != bucket_begin) {
+                const OBJCorner &prev = data.corners[*(it - 1)];
+                const OBJCorner &curr = data.corners[*it];
+                if (prev.vt != curr.vt || prev.vn != curr.vn) count++;
+            }
+            corner_vertices[*it] = count;
+        }
+        vertex_offsets[v + 1] = std::max(count + 1, int64_t(1));
+    }
+    for (int64_t v = 0; v < num_positions; v++) {
+        vertex_offsets[v + 1] += vertex_offsets[v];
+    }
+
+    vertex_positions.resize(vertex_offsets.back());
+    vertex_corners.assign(vertex_offsets.back(), -1);
+#pragma omp parallel for schedule(static)
+    for (int64_t v = 0; v < num_positions; v++) {
+        std::fill(vertex_positions.begin() + vertex_offsets[v],
+                  vertex_positions.begin() + vertex_offsets[v + 1], v);
+        for (int64_t k = bucket_offsets[v]; k < bucket_offsets[v + 1]; k++) {
+            int64_t corner = bucket_corners[k];
+            int64_t &vertex = corner_vertices[corner];
+            vertex += vertex_offsets[v];
+            if (vertex_corners[vertex] < 0) {
+                vertex_corners[vertex] = corner;
+            }
+        }
+    }
+}
+
+}  // unnamed namespace
+
+bool ReadTriangleMeshFromOBJ(const std::string &filename,
+                             geometry::TriangleMesh &mesh,
+                             bool print_progress) {
+    OBJData data;
+    if (!ParseOBJFile(filename, print_progress, data)) {
+        return false;
+    }
+
+    const int64_t num_positions = int64_t(data.positions.size() / 3);
+    const int64_t num_triangles = int64_t(data.corners.size() / 3);
+    const bool has_colors = !data.colors.empty();
+    core::Tensor triangles({num_triangles, 3}, core::Dtype::Int64);
+    int64_t *triangles_ptr = static_cast<int64_t *>(triangles.GetDataPtr());
+
+    mesh.Clear();
+    if (!data.has_texcoords && !data.has_normals) {
+        // Vertices are the positions.
+        mesh.SetVertices(core::Tensor(data.positions, {num_positions, 3},
+                                      core::Dtype::Float32));
+        if (has_colors) {
+            mesh.SetVertexColors(core::Tensor(data.colors, {num_positions, 3},
+                                              core::Dtype::Float32));
+        }
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < 3 * num_triangles; i++) {
+            triangles_ptr[i] = data.corners[i].v;
+        }
+        mesh.SetTriangles(triangles);
+        return true;
+    }
+
+    std::vector<int64_t> corner_vertices, vertex_positions, vertex_corners;
+    DeduplicateOBJCorners(data, corner_vertices, vertex_positions,
+                          vertex_corners);
+    const int64_t num_vertices = int64_t(vertex_corners.size());
+
+    core::Tensor vertices({num_vertices, 3}, core::Dtype::Float32);
+    core::Tensor colors, normals, texture_uvs;
+    float *vertices_ptr = static_cast<float *>(vertices.GetDataPtr());
+    float *colors_ptr = nullptr, *normals_ptr = nullptr, *uvs_ptr = nullptr;
+    if (has_colors) {
+        colors = core::Tensor({num_vertices, 3}, core::Dtype::Float32);
+        colors_ptr = static_cast<float *>(colors.GetDataPtr());
+    }
+    if (data.has_normals) {
+        normals = core::Tensor::Zeros({num_vertices, 3}, core::Dtype::Float32);
+        normals_ptr = static_cast<float *>(normals.GetDataPtr());
+    }
+    if (data.has_texcoords) {
+        texture_uvs =
+                core::Tensor::Zeros({num_vertices, 2}, core::Dtype::Float32);
+        uvs_ptr = static_cast<float *>(texture_uvs.GetDataPtr());
+    }
+
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_vertices; i++) {
+        const int64_t v = vertex_positions[i];
+        std::copy_n(&data.positions[3 * v], 3, vertices_ptr + 3 * i);
+        if (has_colors) {
+            std::copy_n(&data.colors[3 * v], 3, colors_ptr + 3 * i);
+        }
+        if (vertex_corners[i] < 0) continue;
+        const OBJCorner &corner = data.corners[vertex_corners[i]];
+        if (normals_ptr != nullptr && corner.vn >= 0) {
+            std::copy_n(&data.normals[3 * corner.vn], 3, normals_ptr + 3 * i);
+        }
+        if (uvs_ptr != nullptr && corner.vt >= 0) {
+            std::copy_n(&data.texcoords[2 * corner.vt], 2, uvs_ptr + 2 * i);
+        }
+    }
+    std::copy(corner_vertices.begin(), corner_vertices.end(), triangles_ptr);
+
+    mesh.SetVertices(vertices);
+    if (has_colors) mesh.SetVertexColors(colors);
+    if (data.has_normals) mesh.SetVertexNormals(normals);
+    if (data.has_texcoords) mesh.SetVertexAttr("texture_uvs", texture_uvs);
+    mesh.SetTriangles(triangles);
+    return true;
+}
+
+bool ReadTriangleMeshFromOBJ(const std::string &filename,
+                             open3d::geometry::TriangleMesh &mesh,
+                             bool print_progress) {
+    OBJData data;
+    if (!ParseOBJFile(filename, print_progress, data)) {
+        return false;
+    }
+
+    const int64_t num_positions = int64_t(data.positions.size() / 3);
+    const int64_t num_triangles = int64_t(data.corners.size() / 3);
+    mesh.Clear();
+    mesh.vertices_.resize(num_positions);
+    mesh.triangles_.resize(num_triangles);
+    if (!data.colors.empty()) {
+        mesh.vertex_colors_.resize(num_positions);
+    }
+#pragma omp parallel for schedule(static)
+    for (int64_t v = 0; v < num_positions; v++) {
+        mesh.vertices_[v] = Eigen::Map<const Eigen::Vector3f>(
+                                    &data.positions[3 * v])
+                                    .cast<double>();
+        if (!data.colors.empty()) {
+            mesh.vertex_colors_[v] =
+                    Eigen::Map<const Eigen::Vector3f>(&data.colors[3 * v])
+                            .cast<double>();
+        }
+    }
+#pragma omp parallel for schedule(static)
+    for (int64_t t = 0; t < num_triangles; t++) {
+        for (int k = 0; k < 3; k++) {
+            mesh.triangles_[t](k) = int(data.corners[3 * t + k].v);
+        }
+    }
+
+    // As in open3d::io::ReadTriangleMeshFromOBJ, a vertex takes the normal of
+    // its first corner with a normal, and normals are kept only if every
+    // vertex has one. Texture coordinates are kept only if every corner has
+    // one.
+    if (data.has_normals) {
+        std::vector<int64_t> vertex_normals(num_positions, -1);
+        for (const OBJCorner &corner : data.corners) {
+            if (vertex_normals[corner.v] < 0) {
+                vertex_normals[corner.v] = corner.vn;
+            }
+        }
+        if (std::find(vertex_normals.begin(), vertex_normals.end(), -1) ==
+            vertex_normals.end()) {
+            mesh.vertex_normals_.resize(num_positions);
+#pragma omp parallel for schedule(static)
+            for (int64_t v = 0; v < num_positions; v++) {
+                mesh.vertex_normals_[v] =
+                        Eigen::Map<const Eigen::Vector3f>(
+                                &data.normals[3 * vertex_normals[v]])
+                                .cast<double>();
+            }
+        }
+    }
+    if (data.has_texcoords &&
+        std::all_of(data.corners.begin(), data.corners.end(),
+                    [](const OBJCorner &corner) { return corner.vt >= 0; })) {
+        mesh.triangle_uvs_.resize(data.corners.size());
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < int64_t(data.corners.size()); i++) {
+            const float *uv = &data.texcoords[2 * data.corners[i].vt];
+            mesh.triangle_uvs_[i] = Eigen::Vector2d(uv[0], uv[1]);
+        }
+    }
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
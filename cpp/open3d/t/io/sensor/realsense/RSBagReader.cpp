@@ -28,13 +28,16 @@
 
 #include <json/json.h>
 
+#include <algorithm>
 #include <chrono>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <tuple>
 
+#include "open3d/core/MemoryManager.h"
 #include "open3d/t/io/sensor/realsense/RealSensePrivate.h"
 #include "open3d/t/io/sensor/realsense/RealSenseSensorConfig.h"
 
@@ -42,6 +45,28 @@ namespace open3d {
 namespace t {
 namespace io {
 
+namespace {
+
+/// Copy \p data into \p image, reusing its memory when it is a CPU image of
+/// matching size and dtype.
+void CopyToImage(t::geometry::Image &image,
+                 const void *data,
+                 int64_t rows,
+                 int64_t cols,
+                 int64_t channels,
+                 core::Dtype dtype) {
+    if (image.GetRows() != rows || image.GetCols() != cols ||
+        image.GetChannels() != channels || image.GetDtype() != dtype ||
+        image.GetDevice() != core::Device("CPU:0")) {
+        image = t::geometry::Image(rows, cols, channels, dtype);
+    }
+    core::MemoryManager::MemcpyFromHost(
+            image.GetDataPtr(), image.GetDevice(), data,
+            rows * cols * channels * dtype.ByteSize());
+}
+
+}  // namespace
+
 RSBagReader::RSBagReader(size_t buffer_size)
     : frame_buffer_(buffer_size),
       frame_position_us_(buffer_size),
@@ -135,17 +160,15 @@ void RSBagReader::fill_frame_buffer() try {
 
                 frames = align_to_color.process(frames);
                 const auto &color_frame = frames.get_color_frame();
-                // Copy frame data to Tensors
-                current_frame.color_ = core::Tensor(
-                        static_cast<const uint8_t *>(color_frame.get_data()),
-                        {color_frame.get_height(), color_frame.get_width(),
-                         metadata_.color_channels_},
-                        metadata_.color_dt_);
+                // Copy frame data to Images. Buffers recycled by
+                // NextFrame(RGBDImage &) are reused.
+                CopyToImage(current_frame.color_, color_frame.get_data(),
+                            color_frame.get_height(), color_frame.get_width(),
+                            metadata_.color_channels_, metadata_.color_dt_);
                 const auto &depth_frame = frames.get_depth_frame();
-                current_frame.depth_ = core::Tensor(
-                        static_cast<const uint16_t *>(depth_frame.get_data()),
-                        {depth_frame.get_height(), depth_frame.get_width()},
-                        metadata_.depth_dt_);
+                CopyToImage(current_frame.depth_, depth_frame.get_data(),
+                            depth_frame.get_height(), depth_frame.get_width(),
+                            1, metadata_.depth_dt_);
                 frame_position_us_[head_fid_ % frame_buffer_.size()] =
                         rs_device.get_position() /
                         1000;  // Convert nanoseconds -> microseconds
@@ -177,6 +200,15 @@ void RSBagReader::fill_frame_buffer() try {
 bool RSBagReader::IsEOF() const { return is_eof_ && tail_fid_ == head_fid_; }
 
 t::geometry::RGBDImage RSBagReader::NextFrame() {
+    // Swapping with an empty frame leaves nothing to reuse in the buffer, so
+    // the returned frame is never overwritten by the frame reader thread.
+    t::geometry::RGBDImage frame;
+    NextFrame(frame);
+    return frame;
+}
+
+bool RSBagReader::NextFrame(t::geometry::RGBDImage &frame,
+                            uint64_t *timestamp) {
     if (!IsOpened()) {
         utility::LogError("Null file handler. Please call Open().");
     }
@@ -192,11 +224,102 @@ t::geometry::RGBDImage RSBagReader::NextFrame() {
     }
     if (is_eof_ && tail_fid_ == head_fid_) {  // no more frames
         utility::LogInfo("EOF reached");
-        return t::geometry::RGBDImage();
-    } else {
-        return frame_buffer_[(tail_fid_++) %  // atomic
-                             frame_buffer_.size()];
+        return false;
+    }
+    auto &buffered_frame = frame_buffer_[tail_fid_ % frame_buffer_.size()];
+    std::swap(frame.color_, buffered_frame.color_);
+    std::swap(frame.depth_, buffered_frame.depth_);
+    if (timestamp != nullptr) {
+        *timestamp = frame_position_us_[tail_fid_ % frame_buffer_.size()];
+    }
+    ++tail_fid_;  // atomic: release the slot only after the swap.
+    return true;
+}
+
+std::vector<std::pair<uint64_t, uint64_t>> RSBagReader::SplitTimeRanges(
+        uint64_t start_time_us, uint64_t end_time_us, size_t num_ranges) {
+    std::vector<std::pair<uint64_t, uint64_t>> ranges;
+    if (num_ranges == 0 || start_time_us >= end_time_us) {
+        return ranges;
+    }
+    const uint64_t duration = end_time_us - start_time_us;
+    for (size_t i = 0; i < num_ranges; ++i) {
+        ranges.emplace_back(start_time_us + duration * i / num_ranges,
+                            start_time_us + duration * (i + 1) / num_ranges);
+    }
+    return ranges;
+}
+
+int64_t RSBagReader::ProcessFramesParallel(
+        const std::string &filename,
+        const std::function<void(size_t,
+                                 uint64_t,
+                                 const t::geometry::RGBDImage &)> &process,
+        size_t num_readers,
+        uint64_t start_time_us,
+        uint64_t end_time_us,
+        size_t buffer_size) {
+    if (num_readers == 0) {
+        num_readers = std::max(1u, std::thread::hardware_concurrency());
+    }
+    // The first reader is opened upfront to read the stream length.
+    std::vector<std::unique_ptr<RSBagReader>> readers(num_readers);
+    readers[0] = std::make_unique<RSBagReader>(buffer_size);
+    if (!readers[0]->Open(filename)) {
+        return -1;
+    }
+    end_time_us = std::min(end_time_us,
+                           readers[0]->GetMetadata().stream_length_usec_);
+    const auto ranges =
+            SplitTimeRanges(start_time_us, end_time_us, num_readers);
+    if (ranges.empty()) {
+        return 0;
+    }
+
+    std::atomic<int64_t> num_frames{0};
+    std::atomic<bool> open_failed{false};
+#pragma omp parallel for num_threads(num_readers) schedule(static, 1)
+    for (int i = 0; i < static_cast<int>(num_readers); ++i) {
+        const uint64_t range_start = ranges[i].first;
+        const uint64_t range_end = ranges[i].second;
+        if (range_start >= range_end) {
+            continue;
+        }
+        auto &reader = readers[i];
+        if (reader == nullptr) {
+            reader = std::make_unique<RSBagReader>(buffer_size);
+            // Seek before the frame reader thread reads the first frame.
+            reader->seek_to_ = range_start;
+            if (!reader->Open(filename)) {
+                utility::LogWarning(
+                        "Reader {} failed to open {}, frames in [{}, {}) us "
+                        "are not processed.",
+                        i, filename, range_start, range_end);
+                open_failed = true;
+                continue;
+            }
+        } else if (range_start > 0) {
+            reader->SeekTimestamp(range_start);
+        }
+
+        t::geometry::RGBDImage frame;
+        uint64_t timestamp = 0;
+        while (reader->NextFrame(frame, &timestamp)) {
+            if (timestamp < range_start) {
+                continue;  // Buffered before the seek took effect.
+            }
+            if (timestamp >= range_end) {
+                break;
+            }
+            process(i, timestamp, frame);
+            ++num_frames;
+        }
+        reader->Close();
+    }
+    if (open_failed) {
+        return -1;
     }
+    return num_frames;
 }
 
 bool RSBagReader::SeekTimestamp(uint64_t timestamp) {
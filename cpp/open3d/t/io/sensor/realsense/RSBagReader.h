@@ -28,6 +28,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <functional>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -111,6 +112,57 @@ public:
     /// Copy next frame from the bag file and return the RGBDImage object.
     virtual t::geometry::RGBDImage NextFrame() override;
 
+    /// Read the next frame into \p frame, recycling its buffers.
+    ///
+    /// The previous color and depth tensors of \p frame are handed back to
+    /// the frame reader thread, which copies an upcoming frame into them
+    /// instead of allocating new memory. The caller must not keep other
+    /// references to the tensors of \p frame across calls.
+    ///
+    /// \param frame Output frame, reused across calls.
+    /// \param timestamp (optional) Output timestamp (in us) of \p frame. It
+    /// is read before the buffer slot is released, unlike GetTimestamp(),
+    /// which may already see a later frame in that slot.
+    /// \return false if there are no more frames.
+    bool NextFrame(t::geometry::RGBDImage &frame,
+                   uint64_t *timestamp = nullptr);
+
+    /// Split the time interval [\p start_time_us, \p end_time_us) into
+    /// \p num_ranges contiguous ranges of (nearly) equal duration.
+    static std::vector<std::pair<uint64_t, uint64_t>> SplitTimeRanges(
+            uint64_t start_time_us, uint64_t end_time_us, size_t num_ranges);
+
+    /// Process the frames of a bag file with several readers in parallel.
+    ///
+    /// The time interval is split into \p num_readers ranges with
+    /// SplitTimeRanges(). Each range is read by its own RSBagReader on a
+    /// separate thread, and every frame with a timestamp in the range is
+    /// passed to \p process as process(range_index, timestamp_us, frame).
+    /// Frames within a range arrive in order while ranges are processed
+    /// concurrently, so \p process must be thread safe. The frame buffers are
+    /// recycled after \p process returns.
+    ///
+    /// \param filename Path to the RSBag file.
+    /// \param process Callback invoked for every frame.
+    /// \param num_readers Number of parallel readers. 0 uses one reader per
+    /// core.
+    /// \param start_time_us Start processing frames from this time (us).
+    /// \param end_time_us Process frames till this time (us).
+    /// \param buffer_size Max number of frames buffered by each reader.
+    /// \return Number of frames processed, or -1 if the file cannot be
+    /// opened by any of the readers. A warning is logged with the time range
+    /// that a reader failed to process.
+    static int64_t ProcessFramesParallel(
+            const std::string &filename,
+            const std::function<void(size_t,
+                                     uint64_t,
+                                     const t::geometry::RGBDImage &)>
+                    &process,
+            size_t num_readers = 0,
+            uint64_t start_time_us = 0,
+            uint64_t end_time_us = UINT64_MAX,
+            size_t buffer_size = DEFAULT_BUFFER_SIZE);
+
     /// Return filename being read
     virtual std::string GetFilename() const override { return filename_; };
 
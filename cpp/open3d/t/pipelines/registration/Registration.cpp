@@ -31,6 +31,7 @@
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace t {
@@ -132,6 +133,7 @@ RegistrationResult RegistrationICP(const geometry::PointCloud &source,
                                    const core::Tensor &init,
                                    const TransformationEstimation &estimation,
                                    const ICPConvergenceCriteria &criteria) {
+    OPEN3D_PROFILE_SCOPE("t::registration::RegistrationICP");
     core::Device device = source.GetDevice();
     core::Dtype dtype = core::Dtype::Float32;
     source.GetPoints().AssertDtype(dtype);
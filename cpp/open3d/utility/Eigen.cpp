@@ -26,6 +26,7 @@
 
 #include "open3d/utility/Eigen.h"
 
+#include <Eigen/Eigenvalues>
 #include <Eigen/Geometry>
 #include <Eigen/Sparse>
 
@@ -300,25 +301,15 @@ Eigen::Vector3d ColorToDouble(const Eigen::Vector3uint8 &rgb) {
     return ColorToDouble(rgb(0), rgb(1), rgb(2));
 }
 
-template <typename IdxType>
-Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3d> &points,
-                                  const std::vector<IdxType> &indices) {
-    Eigen::Matrix3d covariance;
-    Eigen::Matrix<double, 9, 1> cumulants;
-    cumulants.setZero();
-    for (const auto &idx : indices) {
-        const Eigen::Vector3d &point = points[idx];
-        cumulants(0) += point(0);
-        cumulants(1) += point(1);
-        cumulants(2) += point(2);
-        cumulants(3) += point(0) * point(0);
-        cumulants(4) += point(0) * point(1);
-        cumulants(5) += point(0) * point(2);
-        cumulants(6) += point(1) * point(1);
-        cumulants(7) += point(1) * point(2);
-        cumulants(8) += point(2) * point(2);
+std::tuple<Eigen::Vector3d, Eigen::Matrix3d>
+MeanAndCovarianceAccumulator::GetMeanAndCovariance() const {
+    if (count_ == 0) {
+        return std::make_tuple(Eigen::Vector3d::Zero(),
+                               Eigen::Matrix3d::Zero());
     }
-    cumulants /= (double)indices.size();
+    Eigen::Matrix<double, 9, 1> cumulants = cumulants_ / double(count_);
+    Eigen::Vector3d mean = cumulants.head<3>();
+    Eigen::Matrix3d covariance;
     covariance(0, 0) = cumulants(3) - cumulants(0) * cumulants(0);
     covariance(1, 1) = cumulants(6) - cumulants(1) * cumulants(1);
     covariance(2, 2) = cumulants(8) - cumulants(2) * cumulants(2);
@@ -328,43 +319,53 @@ Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3d> &points,
     covariance(2, 0) = covariance(0, 2);
     covariance(1, 2) = cumulants(7) - cumulants(1) * cumulants(2);
     covariance(2, 1) = covariance(1, 2);
-    return covariance;
+    return std::make_tuple(mean, covariance);
+}
+
+Eigen::Matrix3d ComputePrincipalAxes(const Eigen::Matrix3d &covariance) {
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> es(covariance);
+    Eigen::Vector3d evals = es.eigenvalues();
+    Eigen::Matrix3d R = es.eigenvectors();
+    R.col(0) /= R.col(0).norm();
+    R.col(1) /= R.col(1).norm();
+    R.col(2) /= R.col(2).norm();
+
+    if (evals(1) > evals(0)) {
+        std::swap(evals(1), evals(0));
+        Eigen::Vector3d tmp = R.col(1);
+        R.col(1) = R.col(0);
+        R.col(0) = tmp;
+    }
+    if (evals(2) > evals(0)) {
+        std::swap(evals(2), evals(0));
+        Eigen::Vector3d tmp = R.col(2);
+        R.col(2) = R.col(0);
+        R.col(0) = tmp;
+    }
+    if (evals(2) > evals(1)) {
+        std::swap(evals(2), evals(1));
+        Eigen::Vector3d tmp = R.col(2);
+        R.col(2) = R.col(1);
+        R.col(1) = tmp;
+    }
+    return R;
+}
+
+template <typename IdxType>
+Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3d> &points,
+                                  const std::vector<IdxType> &indices) {
+    return std::get<1>(ComputeMeanAndCovariance(points, indices));
 }
 
 template <typename IdxType>
 std::tuple<Eigen::Vector3d, Eigen::Matrix3d> ComputeMeanAndCovariance(
         const std::vector<Eigen::Vector3d> &points,
         const std::vector<IdxType> &indices) {
-    Eigen::Vector3d mean;
-    Eigen::Matrix3d covariance;
-    Eigen::Matrix<double, 9, 1> cumulants;
-    cumulants.setZero();
+    MeanAndCovarianceAccumulator accumulator;
     for (const auto &idx : indices) {
-        const Eigen::Vector3d &point = points[idx];
-        cumulants(0) += point(0);
-        cumulants(1) += point(1);
-        cumulants(2) += point(2);
-        cumulants(3) += point(0) * point(0);
-        cumulants(4) += point(0) * point(1);
-        cumulants(5) += point(0) * point(2);
-        cumulants(6) += point(1) * point(1);
-        cumulants(7) += point(1) * point(2);
-        cumulants(8) += point(2) * point(2);
+        accumulator.Add(points[idx]);
     }
-    cumulants /= (double)indices.size();
-    mean(0) = cumulants(0);
-    mean(1) = cumulants(1);
-    mean(2) = cumulants(2);
-    covariance(0, 0) = cumulants(3) - cumulants(0) * cumulants(0);
-    covariance(1, 1) = cumulants(6) - cumulants(1) * cumulants(1);
-    covariance(2, 2) = cumulants(8) - cumulants(2) * cumulants(2);
-    covariance(0, 1) = cumulants(4) - cumulants(0) * cumulants(1);
-    covariance(1, 0) = covariance(0, 1);
-    covariance(0, 2) = cumulants(5) - cumulants(0) * cumulants(2);
-    covariance(2, 0) = covariance(0, 2);
-    covariance(1, 2) = cumulants(7) - cumulants(1) * cumulants(2);
-    covariance(2, 1) = covariance(1, 2);
-    return std::make_tuple(mean, covariance);
+    return accumulator.GetMeanAndCovariance();
 }
 
 template Eigen::Matrix3d ComputeCovariance(
@@ -28,9 +28,12 @@
 
 #include <Eigen/Core>
 #include <Eigen/StdVector>
+#include <algorithm>
 #include <tuple>
 #include <vector>
 
+#include "open3d/utility/Console.h"
+
 /// @cond
 namespace Eigen {
 
@@ -118,6 +121,113 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
         int iteration_num,
         bool verbose = true);
 
+/// Function to compute JTJ and JTr of a 6-DoF problem with \p kRows residuals
+/// per element.
+/// Input: functor f and number of elements
+/// Output: JTJ, JTr, sum of r^2
+/// Note: f(i, J_r, r, w) fills the kRows Jacobian rows, residuals and weights
+/// of element i. f is called without type erasure, and rows are accumulated
+/// in blocks transposed to structure-of-arrays layout, so that the updates of
+/// the 21 unique JTJ entries are vectorized.
+template <int kRows, typename Functor>
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr6DoF(
+        const Functor &f, int element_num, bool verbose = true) {
+    constexpr int kBlockElements = 16;
+    constexpr int kBlockRows = kBlockElements * kRows;
+    // 21 upper triangular entries of JTJ, JTr and sum of r^2.
+    constexpr int kSums = 21 + 6 + 1;
+    const int block_num = (element_num + kBlockElements - 1) / kBlockElements;
+
+    double sums[kSums] = {0};
+#pragma omp parallel
+    {
+        double sums_private[kSums] = {0};
+        alignas(64) double J[6][kBlockRows];
+        alignas(64) double wJ[6][kBlockRows];
+        alignas(64) double r[kBlockRows];
+        alignas(64) double wr[kBlockRows];
+        Eigen::Vector6d J_r[kRows];
+        double r_i[kRows];
+        double w_i[kRows];
+#pragma omp for nowait schedule(static)
+        for (int b = 0; b < block_num; b++) {
+            const int begin = b * kBlockElements;
+            const int end = std::min(begin + kBlockElements, element_num);
+            int row = 0;
+            for (int i = begin; i < end; i++) {
+                f(i, J_r, r_i, w_i);
+                for (int k = 0; k < kRows; k++, row++) {
+                    for (int j = 0; j < 6; j++) {
+                        J[j][row] = J_r[k](j);
+                        wJ[j][row] = w_i[k] * J_r[k](j);
+                    }
+                    r[row] = r_i[k];
+                    wr[row] = w_i[k] * r_i[k];
+                }
+            }
+            // Zero rows of the last partial block do not contribute.
+            for (; row < kBlockRows; row++) {
+                for (int j = 0; j < 6; j++) {
+                    J[j][row] = 0;
+                    wJ[j][row] = 0;
+                }
+                r[row] = 0;
+                wr[row] = 0;
+            }
+
+            int idx = 0;
+            for (int j0 = 0; j0 < 6; j0++) {
+                for (int j1 = j0; j1 < 6; j1++, idx++) {
+                    double s = 0;
+#pragma omp simd reduction(+ : s)
+                    for (int k = 0; k < kBlockRows; k++) {
+                        s += wJ[j0][k] * J[j1][k];
+                    }
+                    sums_private[idx] += s;
+                }
+            }
+            for (int j = 0; j < 6; j++, idx++) {
+                double s = 0;
+#pragma omp simd reduction(+ : s)
+                for (int k = 0; k < kBlockRows; k++) {
+                    s += J[j][k] * wr[k];
+                }
+                sums_private[idx] += s;
+            }
+            double s = 0;
+#pragma omp simd reduction(+ : s)
+            for (int k = 0; k < kBlockRows; k++) {
+                s += r[k] * r[k];
+            }
+            sums_private[idx] += s;
+        }
+#pragma omp critical
+        {
+            for (int k = 0; k < kSums; k++) {
+                sums[k] += sums_private[k];
+            }
+        }
+    }
+
+    Eigen::Matrix6d JTJ;
+    Eigen::Vector6d JTr;
+    int idx = 0;
+    for (int j0 = 0; j0 < 6; j0++) {
+        for (int j1 = j0; j1 < 6; j1++, idx++) {
+            JTJ(j0, j1) = JTJ(j1, j0) = sums[idx];
+        }
+    }
+    for (int j = 0; j < 6; j++, idx++) {
+        JTr(j) = sums[idx];
+    }
+    double r2_sum = sums[idx];
+    if (verbose) {
+        LogDebug("Residual : {:.2e} (# of elements : {:d})",
+                 r2_sum / (double)element_num, element_num);
+    }
+    return std::make_tuple(std::move(JTJ), std::move(JTr), r2_sum);
+}
+
 Eigen::Matrix3d RotationMatrixX(double radians);
 Eigen::Matrix3d RotationMatrixY(double radians);
 Eigen::Matrix3d RotationMatrixZ(double radians);
@@ -129,6 +239,46 @@ Eigen::Vector3uint8 ColorToUint8(const Eigen::Vector3d &color);
 Eigen::Vector3d ColorToDouble(uint8_t r, uint8_t g, uint8_t b);
 Eigen::Vector3d ColorToDouble(const Eigen::Vector3uint8 &rgb);
 
+/// Accumulates the first and second order cumulants of a set of points.
+/// Accumulators of disjoint subsets can be merged, which allows the mean and
+/// covariance to be reduced in parallel.
+class MeanAndCovarianceAccumulator {
+public:
+    MeanAndCovarianceAccumulator() { cumulants_.setZero(); }
+
+    void Add(const Eigen::Vector3d &point) {
+        cumulants_(0) += point(0);
+        cumulants_(1) += point(1);
+        cumulants_(2) += point(2);
+        cumulants_(3) += point(0) * point(0);
+        cumulants_(4) += point(0) * point(1);
+        cumulants_(5) += point(0) * point(2);
+        cumulants_(6) += point(1) * point(1);
+        cumulants_(7) += point(1) * point(2);
+        cumulants_(8) += point(2) * point(2);
+        count_++;
+    }
+
+    void Merge(const MeanAndCovarianceAccumulator &other) {
+        cumulants_ += other.cumulants_;
+        count_ += other.count_;
+    }
+
+    size_t GetCount() const { return count_; }
+
+    /// Returns the mean and covariance of the added points. Both are zero if
+    /// no point was added.
+    std::tuple<Eigen::Vector3d, Eigen::Matrix3d> GetMeanAndCovariance() const;
+
+private:
+    Eigen::Matrix<double, 9, 1> cumulants_;
+    size_t count_ = 0;
+};
+
+/// Returns the eigenvectors of the symmetric \p covariance as columns, sorted
+/// by decreasing eigenvalue.
+Eigen::Matrix3d ComputePrincipalAxes(const Eigen::Matrix3d &covariance);
+
 /// Function to compute the covariance matrix of a set of points.
 template <typename IdxType>
 Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3d> &points,
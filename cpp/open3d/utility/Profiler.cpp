@@ -0,0 +1,352 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <unordered_map>
+
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace utility {
+
+/// Single-producer event buffer owned by one thread. Events are stored in
+/// fixed-size chunks that are never moved, so that other threads can read the
+/// published prefix [begin_, size_) while the owner keeps appending. Chunks
+/// that only hold cleared events are released by Clear. Collect and Clear
+/// are serialized by the profiler mutex, which guards head_.
+class Profiler::ThreadBuffer {
+public:
+    static constexpr int64_t kChunkSize = 4096;
+
+    struct Chunk {
+        ProfileEvent events_[kChunkSize];
+        std::atomic<Chunk *> next_{nullptr};
+    };
+
+    explicit ThreadBuffer(int thread_id)
+        : thread_id_(thread_id), head_(new Chunk()), tail_(head_) {}
+
+    ~ThreadBuffer() {
+        Chunk *chunk = head_;
+        while (chunk != nullptr) {
+            Chunk *next = chunk->next_.load(std::memory_order_relaxed);
+            delete chunk;
+            chunk = next;
+        }
+    }
+
+    /// Called only by the owning thread.
+    void Push(const char *name,
+              int64_t start_ns,
+              int64_t end_ns,
+              int depth,
+              int64_t max_events) {
+        int64_t n = size_.load(std::memory_order_relaxed);
+        if (n - begin_.load(std::memory_order_relaxed) >= max_events) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        int64_t offset = n % kChunkSize;
+        if (n > 0 && offset == 0) {
+            Chunk *chunk = new Chunk();
+            tail_->next_.store(chunk, std::memory_order_release);
+            tail_ = chunk;
+        }
+        ProfileEvent &event = tail_->events_[offset];
+        event.name_ = name;
+        event.start_ns_ = start_ns;
+        event.end_ns_ = end_ns;
+        event.depth_ = depth;
+        event.thread_id_ = thread_id_;
+        size_.store(n + 1, std::memory_order_release);
+    }
+
+    void Collect(std::vector<ProfileEvent> &events) const {
+        int64_t begin = begin_.load(std::memory_order_acquire);
+        int64_t end = size_.load(std::memory_order_acquire);
+        const Chunk *chunk = head_;
+        for (int64_t i = head_begin_ + kChunkSize; i <= begin;
+             i += kChunkSize) {
+            chunk = chunk->next_.load(std::memory_order_acquire);
+        }
+        for (int64_t i = begin; i < end; ++i) {
+            if (i > begin && i % kChunkSize == 0) {
+                chunk = chunk->next_.load(std::memory_order_acquire);
+            }
+            events.push_back(chunk->events_[i % kChunkSize]);
+        }
+    }
+
+    /// Hide all events published so far and release the chunks that only
+    /// hold hidden events. The chunk holding the last published event is
+    /// kept, as the owner may still be linking the next chunk to it.
+    void Clear() {
+        int64_t size = size_.load(std::memory_order_acquire);
+        begin_.store(size, std::memory_order_release);
+        dropped_.store(0, std::memory_order_relaxed);
+        while (head_begin_ + kChunkSize < size) {
+            Chunk *next = head_->next_.load(std::memory_order_acquire);
+            delete head_;
+            head_ = next;
+            head_begin_ += kChunkSize;
+        }
+    }
+
+    int64_t GetNumDropped() const {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    int thread_id_;
+    Chunk *head_;
+    Chunk *tail_;
+    /// Index of the first event stored in head_.
+    int64_t head_begin_ = 0;
+    std::atomic<int64_t> begin_{0};
+    std::atomic<int64_t> size_{0};
+    std::atomic<int64_t> dropped_{0};
+};
+
+std::atomic<bool> Profiler::enabled_{false};
+thread_local int ScopeProfiler::depth_counter_ = 0;
+
+Profiler::Profiler() { GetTimeInNanoseconds(); }
+
+Profiler::~Profiler() {}
+
+Profiler &Profiler::GetInstance() {
+    static Profiler instance;
+    return instance;
+}
+
+bool Profiler::IsCompiledIn() {
+#ifdef BUILD_PROFILER
+    return true;
+#else
+    return false;
+#endif
+}
+
+void Profiler::SetEnabled(bool enabled) {
+    if (enabled && !IsCompiledIn()) {
+        LogWarning(
+                "[Profiler] Open3D is compiled without profiling "
+                "instrumentation, no scope will be recorded. Please recompile "
+                "Open3D with BUILD_PROFILER=ON.");
+    }
+    enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void Profiler::SetMaxEventsPerThread(int64_t max_events) {
+    if (max_events <= 0) {
+        LogError("[Profiler] max_events must be positive, but got {}.",
+                 max_events);
+    }
+    max_events_per_thread_.store(max_events, std::memory_order_relaxed);
+}
+
+int64_t Profiler::GetTimeInNanoseconds() {
+    static const auto epoch = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now() - epoch)
+            .count();
+}
+
+Profiler::ThreadBuffer *Profiler::GetThreadBuffer() {
+    // The buffer is owned by the profiler so that events recorded by threads
+    // that have exited remain available.
+    thread_local ThreadBuffer *buffer = nullptr;
+    if (buffer == nullptr) {
+        std::lock_guard<std::mutex> lock(buffers_mutex_);
+        buffers_.emplace_back(
+                new ThreadBuffer(static_cast<int>(buffers_.size())));
+        buffer = buffers_.back().get();
+    }
+    return buffer;
+}
+
+void Profiler::Record(const char *name,
+                      int64_t start_ns,
+                      int64_t end_ns,
+                      int depth) {
+    GetThreadBuffer()->Push(
+            name, start_ns, end_ns, depth,
+            max_events_per_thread_.load(std::memory_order_relaxed));
+}
+
+void Profiler::Clear() {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    for (auto &buffer : buffers_) {
+        buffer->Clear();
+    }
+}
+
+std::vector<ProfileEvent> Profiler::GetEvents() const {
+    std::vector<ProfileEvent> events;
+    {
+        std::lock_guard<std::mutex> lock(buffers_mutex_);
+        for (const auto &buffer : buffers_) {
+            buffer->Collect(events);
+        }
+    }
+    // Events are recorded when scopes close; sort parents before children.
+    std::sort(events.begin(), events.end(),
+              [](const ProfileEvent &a, const ProfileEvent &b) {
+                  if (a.thread_id_ != b.thread_id_) {
+                      return a.thread_id_ < b.thread_id_;
+                  }
+                  if (a.start_ns_ != b.start_ns_) {
+                      return a.start_ns_ < b.start_ns_;
+                  }
+                  return a.depth_ < b.depth_;
+              });
+    return events;
+}
+
+int64_t Profiler::GetNumDroppedEvents() const {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    int64_t dropped = 0;
+    for (const auto &buffer : buffers_) {
+        dropped += buffer->GetNumDropped();
+    }
+    return dropped;
+}
+
+std::vector<ProfileSummary> Profiler::GetSummary() const {
+    std::vector<ProfileEvent> events = GetEvents();
+
+    // Self time is the duration minus the durations of the direct children.
+    // Events are sorted per thread by start time, so the children of an event
+    // follow it with a larger depth until the next event of the same or a
+    // smaller depth.
+    std::vector<int64_t> children_ns(events.size(), 0);
+    std::vector<size_t> stack;
+    for (size_t i = 0; i < events.size(); ++i) {
+        while (!stack.empty() &&
+               (events[stack.back()].thread_id_ != events[i].thread_id_ ||
+                events[stack.back()].depth_ >= events[i].depth_)) {
+            stack.pop_back();
+        }
+        if (!stack.empty()) {
+            children_ns[stack.back()] +=
+                    events[i].end_ns_ - events[i].start_ns_;
+        }
+        stack.push_back(i);
+    }
+
+    std::unordered_map<std::string, ProfileSummary> name_to_summary;
+    for (size_t i = 0; i < events.size(); ++i) {
+        const ProfileEvent &event = events[i];
+        double duration_ms = (event.end_ns_ - event.start_ns_) * 1e-6;
+        double self_ms = std::max(0.0, duration_ms - children_ns[i] * 1e-6);
+
+        ProfileSummary &summary = name_to_summary[event.name_];
+        if (summary.count_ == 0) {
+            summary.name_ = event.name_;
+            summary.min_ms_ = duration_ms;
+            summary.max_ms_ = duration_ms;
+        }
+        summary.count_++;
+        summary.total_ms_ += duration_ms;
+        summary.self_ms_ += self_ms;
+        summary.min_ms_ = std::min(summary.min_ms_, duration_ms);
+        summary.max_ms_ = std::max(summary.max_ms_, duration_ms);
+    }
+
+    std::vector<ProfileSummary> summaries;
+    summaries.reserve(name_to_summary.size());
+    for (auto &kv : name_to_summary) {
+        summaries.push_back(std::move(kv.second));
+    }
+    std::sort(summaries.begin(), summaries.end(),
+              [](const ProfileSummary &a, const ProfileSummary &b) {
+                  return a.total_ms_ > b.total_ms_;
+              });
+    return summaries;
+}
+
+void Profiler::PrintSummary() const {
+    std::vector<ProfileSummary> summaries = GetSummary();
+    std::string table =
+            fmt::format("{:<48} {:>8} {:>12} {:>12} {:>10} {:>10}\n", "Scope",
+                        "Count", "Total (ms)", "Self (ms)", "Min (ms)",
+                        "Max (ms)");
+    for (const ProfileSummary &s : summaries) {
+        table += fmt::format(
+                "{:<48} {:>8} {:>12.3f} {:>12.3f} {:>10.3f} {:>10.3f}\n",
+                s.name_, s.count_, s.total_ms_, s.self_ms_, s.min_ms_,
+                s.max_ms_);
+    }
+    int64_t dropped = GetNumDroppedEvents();
+    if (dropped > 0) {
+        table += fmt::format("({} events dropped)\n", dropped);
+    }
+    LogInfo("[Profiler] Summary:\n{}", table);
+}
+
+static std::string EscapeJsonString(const char *str) {
+    std::string escaped;
+    for (const char *c = str; *c != '\0'; ++c) {
+        if (*c == '"' || *c == '\\') {
+            escaped += '\\';
+        }
+        escaped += *c;
+    }
+    return escaped;
+}
+
+std::string Profiler::ToChromeTraceJson() const {
+    std::vector<ProfileEvent> events = GetEvents();
+    std::string json = "{\"traceEvents\":[\n";
+    for (size_t i = 0; i < events.size(); ++i) {
+        const ProfileEvent &event = events[i];
+        json += fmt::format(
+                "{{\"name\":\"{}\",\"cat\":\"open3d\",\"ph\":\"X\","
+                "\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":0,\"tid\":{}}}{}\n",
+                EscapeJsonString(event.name_), event.start_ns_ * 1e-3,
+                (event.end_ns_ - event.start_ns_) * 1e-3, event.thread_id_,
+                i + 1 < events.size() ? "," : "");
+    }
+    json += "],\"displayTimeUnit\":\"ms\"}\n";
+    return json;
+}
+
+bool Profiler::WriteChromeTrace(const std::string &filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        LogWarning("[Profiler] Unable to open file {} for writing.", filename);
+        return false;
+    }
+    file << ToChromeTraceJson();
+    return file.good();
+}
+
+}  // namespace utility
+}  // namespace open3d
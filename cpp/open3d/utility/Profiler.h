@@ -0,0 +1,185 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace open3d {
+namespace utility {
+
+/// A traced scope, as recorded by ScopeProfiler.
+struct ProfileEvent {
+    /// Name of the scope. Must point to a string with static storage
+    /// duration, e.g. a string literal.
+    const char *name_ = nullptr;
+    /// Start and end time in nanoseconds since the profiler epoch.
+    int64_t start_ns_ = 0;
+    int64_t end_ns_ = 0;
+    /// Nesting depth of the scope within its thread, starting from 0.
+    int depth_ = 0;
+    /// Sequential id of the thread that recorded the event.
+    int thread_id_ = 0;
+};
+
+/// Aggregated statistics of all events sharing the same name.
+struct ProfileSummary {
+    std::string name_;
+    int64_t count_ = 0;
+    /// Total wall time spent in the scope, including nested scopes.
+    double total_ms_ = 0;
+    /// Wall time spent in the scope excluding nested traced scopes.
+    double self_ms_ = 0;
+    double min_ms_ = 0;
+    double max_ms_ = 0;
+};
+
+/// \class Profiler
+///
+/// \brief Low-overhead hierarchical tracing of scopes.
+///
+/// Scopes are instrumented with OPEN3D_PROFILE_SCOPE, which is compiled out
+/// unless Open3D is built with BUILD_PROFILER=ON. At runtime, recording is
+/// off until Profiler::GetInstance().SetEnabled(true) is called.
+///
+/// Each thread appends to its own event buffer without locking. The buffers
+/// can be collected at any time, e.g. to export a Chrome trace (open in
+/// chrome://tracing or https://ui.perfetto.dev) or to print a summary.
+class Profiler {
+public:
+    Profiler(const Profiler &) = delete;
+    Profiler &operator=(const Profiler &) = delete;
+    ~Profiler();
+
+    static Profiler &GetInstance();
+
+    /// Returns true if Open3D was compiled with profiling instrumentation.
+    static bool IsCompiledIn();
+
+    static bool IsEnabled() {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+    void SetEnabled(bool enabled);
+
+    /// Maximum number of events kept per thread. Further events are dropped.
+    void SetMaxEventsPerThread(int64_t max_events);
+    int64_t GetMaxEventsPerThread() const {
+        return max_events_per_thread_.load(std::memory_order_relaxed);
+    }
+
+    /// Discard all recorded events. Scopes that are open during the call may
+    /// still be recorded when they close.
+    void Clear();
+
+    /// Returns all recorded events, sorted by thread and start time.
+    std::vector<ProfileEvent> GetEvents() const;
+
+    /// Number of events dropped because a thread buffer was full.
+    int64_t GetNumDroppedEvents() const;
+
+    /// Returns per-name statistics, sorted by decreasing total time.
+    std::vector<ProfileSummary> GetSummary() const;
+
+    /// Print the summary as a table with LogInfo.
+    void PrintSummary() const;
+
+    /// Returns the recorded events in the Chrome trace event JSON format.
+    std::string ToChromeTraceJson() const;
+
+    /// Write the recorded events to \p filename in the Chrome trace event
+    /// JSON format. Returns false if the file cannot be written.
+    bool WriteChromeTrace(const std::string &filename) const;
+
+    /// Nanoseconds elapsed since the profiler epoch.
+    static int64_t GetTimeInNanoseconds();
+
+    /// Record a closed scope in the buffer of the calling thread.
+    void Record(const char *name, int64_t start_ns, int64_t end_ns, int depth);
+
+private:
+    Profiler();
+
+    class ThreadBuffer;
+    ThreadBuffer *GetThreadBuffer();
+
+    static std::atomic<bool> enabled_;
+
+    mutable std::mutex buffers_mutex_;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+    std::atomic<int64_t> max_events_per_thread_{1 << 22};
+};
+
+/// \class ScopeProfiler
+///
+/// \brief Records the lifetime of the enclosing scope with the Profiler.
+/// Use through OPEN3D_PROFILE_SCOPE.
+class ScopeProfiler {
+public:
+    explicit ScopeProfiler(const char *name) : name_(name) {
+        if (Profiler::IsEnabled()) {
+            depth_ = depth_counter_++;
+            start_ns_ = Profiler::GetTimeInNanoseconds();
+        }
+    }
+
+    ~ScopeProfiler() {
+        if (start_ns_ >= 0) {
+            Profiler::GetInstance().Record(name_, start_ns_,
+                                           Profiler::GetTimeInNanoseconds(),
+                                           depth_);
+            --depth_counter_;
+        }
+    }
+
+    ScopeProfiler(const ScopeProfiler &) = delete;
+    ScopeProfiler &operator=(const ScopeProfiler &) = delete;
+
+private:
+    const char *name_;
+    int64_t start_ns_ = -1;
+    int depth_ = 0;
+    static thread_local int depth_counter_;
+};
+
+}  // namespace utility
+}  // namespace open3d
+
+#define OPEN3D_PROFILE_CONCAT_IMPL(a, b) a##b
+#define OPEN3D_PROFILE_CONCAT(a, b) OPEN3D_PROFILE_CONCAT_IMPL(a, b)
+
+/// Trace the enclosing scope under \p name, a string literal.
+#ifdef BUILD_PROFILER
+#define OPEN3D_PROFILE_SCOPE(name)                        \
+    open3d::utility::ScopeProfiler OPEN3D_PROFILE_CONCAT( \
+            open3d_scope_profiler_, __LINE__)(name)
+#else
+#define OPEN3D_PROFILE_SCOPE(name)
+#endif
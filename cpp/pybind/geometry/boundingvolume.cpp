@@ -36,6 +36,18 @@ namespace open3d {
 namespace geometry {
 
 void pybind_boundingvolume(py::module &m) {
+    py::enum_<OrientedBoundingBox::CreationMethod>(m,
+                                                   "OrientedBoundingBoxMethod")
+            .value("ConvexHullPCA",
+                   OrientedBoundingBox::CreationMethod::ConvexHullPCA,
+                   "PCA of the convex hull vertices.")
+            .value("PCA", OrientedBoundingBox::CreationMethod::PCA,
+                   "PCA of all the points, without a convex hull.")
+            .value("MinimumVolume",
+                   OrientedBoundingBox::CreationMethod::MinimumVolume,
+                   "Smallest box with a face flush with a convex hull facet.")
+            .export_values();
+
     py::class_<OrientedBoundingBox, PyGeometry3D<OrientedBoundingBox>,
                std::shared_ptr<OrientedBoundingBox>, Geometry3D>
             oriented_bounding_box(m, "OrientedBoundingBox",
@@ -74,7 +86,15 @@ void pybind_boundingvolume(py::module &m) {
                     "create_from_points",
                     &OrientedBoundingBox::CreateFromPoints,
                     "Creates the bounding box that encloses the set of points.",
-                    "points"_a)
+                    "points"_a,
+                    "method"_a = OrientedBoundingBox::CreationMethod::
+                            ConvexHullPCA)
+            .def_static("create_from_point_indices",
+                        &OrientedBoundingBox::CreateFromPointIndices,
+                        "Creates a bounding box for each list of indices "
+                        "into points.",
+                        "points"_a, "indices"_a,
+                        "method"_a = OrientedBoundingBox::CreationMethod::PCA)
             .def("volume", &OrientedBoundingBox::Volume,
                  "Returns the volume of the bounding box.")
             .def("get_box_points", &OrientedBoundingBox::GetBoxPoints,
@@ -97,9 +117,21 @@ void pybind_boundingvolume(py::module &m) {
             {{"aabox",
               "AxisAlignedBoundingBox object from which OrientedBoundingBox is "
               "created."}});
-    docstring::ClassMethodDocInject(m, "OrientedBoundingBox",
-                                    "create_from_points",
-                                    {{"points", "A list of points."}});
+    docstring::ClassMethodDocInject(
+            m, "OrientedBoundingBox", "create_from_points",
+            {{"points", "A list of points."},
+             {"method",
+              "ConvexHullPCA fits the box to the convex hull with PCA, PCA "
+              "skips the convex hull, and MinimumVolume searches the convex "
+              "hull facets for a smaller box."}});
+    docstring::ClassMethodDocInject(
+            m, "OrientedBoundingBox", "create_from_point_indices",
+            {{"points", "A list of points."},
+             {"indices",
+              "A list of index lists into points, one per bounding box."},
+             {"method",
+              "How each box is fitted. Index lists the convex hull cannot be "
+              "computed for fall back to PCA."}});
 
     py::class_<AxisAlignedBoundingBox, PyGeometry3D<AxisAlignedBoundingBox>,
                std::shared_ptr<AxisAlignedBoundingBox>, Geometry3D>
@@ -0,0 +1,89 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/Distance.h"
+
+#include "pybind/docstring.h"
+#include "pybind/geometry/geometry.h"
+
+namespace open3d {
+namespace geometry {
+
+void pybind_distance(py::module &m) {
+    py::class_<DistanceSummary> distance_summary(
+            m, "DistanceSummary",
+            "Summary statistics of the distances from a source geometry to a "
+            "target geometry and back.");
+    py::detail::bind_default_constructor<DistanceSummary>(distance_summary);
+    py::detail::bind_copy_functions<DistanceSummary>(distance_summary);
+    distance_summary
+            .def_readwrite("mean_source_to_target",
+                           &DistanceSummary::mean_source_to_target_,
+                           "float: Mean distance from the source points to "
+                           "the target.")
+            .def_readwrite("mean_target_to_source",
+                           &DistanceSummary::mean_target_to_source_,
+                           "float: Mean distance from the target points to "
+                           "the source.")
+            .def_readwrite("max_source_to_target",
+                           &DistanceSummary::max_source_to_target_,
+                           "float: Maximum distance from the source points to "
+                           "the target.")
+            .def_readwrite("max_target_to_source",
+                           &DistanceSummary::max_target_to_source_,
+                           "float: Maximum distance from the target points to "
+                           "the source.")
+            .def_readwrite("hausdorff_distance",
+                           &DistanceSummary::hausdorff_distance_,
+                           "float: Symmetric Hausdorff distance.")
+            .def_readwrite("chamfer_distance",
+                           &DistanceSummary::chamfer_distance_,
+                           "float: Chamfer distance, the sum of both mean "
+                           "distances.")
+            .def("__repr__", [](const DistanceSummary &summary) {
+                return fmt::format(
+                        "DistanceSummary with hausdorff_distance={:e}"
+                        ", and chamfer_distance={:e}",
+                        summary.hausdorff_distance_, summary.chamfer_distance_);
+            });
+
+    m.def("compute_distance_summary",
+          py::overload_cast<const PointCloud &, const PointCloud &, double>(
+                  &ComputeDistanceSummary),
+          "Function to compute the Hausdorff and Chamfer distances between "
+          "two point clouds.",
+          "source"_a, "target"_a, "max_distance"_a = 0.0);
+    m.def("compute_distance_summary",
+          py::overload_cast<const PointCloud &, const TriangleMesh &, double>(
+                  &ComputeDistanceSummary),
+          "Function to compute the Hausdorff and Chamfer distances between a "
+          "point cloud and the triangles of a mesh. Distances from the mesh "
+          "to the point cloud are measured from the mesh vertices.",
+          "source"_a, "target"_a, "max_distance"_a = 0.0);
+}
+
+}  // namespace geometry
+}  // namespace open3d
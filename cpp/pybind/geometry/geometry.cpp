@@ -213,6 +213,7 @@ void pybind_geometry(py::module &m) {
     pybind_octree_methods(m_submodule);
     pybind_octree(m_submodule);
     pybind_boundingvolume(m_submodule);
+    pybind_distance(m_submodule);
 }
 
 }  // namespace geometry
@@ -52,6 +52,7 @@ void pybind_image_methods(py::module &m);
 void pybind_octree_methods(py::module &m);
 void pybind_octree(py::module &m);
 void pybind_boundingvolume(py::module &m);
+void pybind_distance(py::module &m);
 
 }  // namespace geometry
 }  // namespace open3d
@@ -124,6 +124,15 @@ void pybind_halfedgetrianglemesh(py::module &m) {
             .def("get_boundaries", &HalfEdgeTriangleMesh::GetBoundaries,
                  "Returns a vector of boundaries. A boundary is a vector of "
                  "vertices.")
+            .def("ordered_half_edges_from_vertex",
+                 &HalfEdgeTriangleMesh::OrderedHalfEdgesFromVertex,
+                 "vertex_index"_a,
+                 "Counter-clockwise ordered half-edges started from a vertex.")
+            .def("one_ring_vertices_from_vertex",
+                 &HalfEdgeTriangleMesh::OneRingVerticesFromVertex,
+                 "vertex_index"_a,
+                 "Counter-clockwise ordered one-ring neighbor vertices of a "
+                 "vertex.")
             .def_static("create_from_triangle_mesh",
                         &HalfEdgeTriangleMesh::CreateFromTriangleMesh, "mesh"_a,
                         "Convert HalfEdgeTriangleMesh from TriangleMesh. "
@@ -131,17 +140,32 @@ void pybind_halfedgetrianglemesh(py::module &m) {
                         "the input mesh is not manifolds")
             .def_readwrite("half_edges", &HalfEdgeTriangleMesh::half_edges_,
                            "List of HalfEdge in the mesh")
-            .def_readwrite(
+            .def_property_readonly(
                     "ordered_half_edge_from_vertex",
-                    &HalfEdgeTriangleMesh::ordered_half_edge_from_vertex_,
+                    &HalfEdgeTriangleMesh::GetOrderedHalfEdgesFromVertices,
                     "Counter-clockwise ordered half-edges started from "
-                    "each vertex");
+                    "each vertex. A read-only copy of "
+                    "ordered_half_edge_offsets and ordered_half_edge_indices")
+            .def_readwrite(
+                    "ordered_half_edge_offsets",
+                    &HalfEdgeTriangleMesh::ordered_half_edge_offsets_,
+                    "Offsets of the ordered half-edges started from each "
+                    "vertex in ordered_half_edge_indices")
+            .def_readwrite(
+                    "ordered_half_edge_indices",
+                    &HalfEdgeTriangleMesh::ordered_half_edge_indices_,
+                    "Concatenated ordered half-edges started from each "
+                    "vertex");
     docstring::ClassMethodDocInject(m, "HalfEdgeTriangleMesh",
                                     "boundary_half_edges_from_vertex");
     docstring::ClassMethodDocInject(m, "HalfEdgeTriangleMesh",
                                     "boundary_vertices_from_vertex");
     docstring::ClassMethodDocInject(m, "HalfEdgeTriangleMesh",
                                     "get_boundaries");
+    docstring::ClassMethodDocInject(m, "HalfEdgeTriangleMesh",
+                                    "ordered_half_edges_from_vertex");
+    docstring::ClassMethodDocInject(m, "HalfEdgeTriangleMesh",
+                                    "one_ring_vertices_from_vertex");
     docstring::ClassMethodDocInject(m, "HalfEdgeTriangleMesh",
                                     "has_half_edges");
     docstring::ClassMethodDocInject(m, "HalfEdgeTriangleMesh",
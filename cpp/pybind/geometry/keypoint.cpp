@@ -45,7 +45,8 @@ void pybind_keypoint_methods(py::module &m) {
           "proposed in Yu Zhong, 'Intrinsic Shape Signatures: A Shape "
           "Descriptor for 3D Object Recognition', 2009.",
           "input"_a, "salient_radius"_a = 0.0, "non_max_radius"_a = 0.0,
-          "gamma_21"_a = 0.975, "gamma_32"_a = 0.975, "min_neighbors"_a = 5);
+          "gamma_21"_a = 0.975, "gamma_32"_a = 0.975, "min_neighbors"_a = 5,
+          "max_cache_bytes"_a = size_t(1) << 30);
 
     docstring::FunctionDocInject(
             m, "compute_iss_keypoints",
@@ -65,7 +66,10 @@ void pybind_keypoint_methods(py::module &m) {
              {"min_neighbors",
               "Minimum number of neighbors that has to be found to "
               "consider a "
-              "keypoint"}});
+              "keypoint"},
+             {"max_cache_bytes",
+              "Memory budget for the radius neighborhoods shared between the "
+              "saliency and the non maxima suppression passes"}});
 }
 
 void pybind_keypoint(py::module &m) {
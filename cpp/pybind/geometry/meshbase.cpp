@@ -94,7 +94,8 @@ void pybind_meshbase(py::module &m) {
                  "Assigns each vertex in the MeshBase the same color.",
                  "color"_a)
             .def("compute_convex_hull", &MeshBase::ComputeConvexHull,
-                 "Computes the convex hull of the triangle mesh.")
+                 "Computes the convex hull of the triangle mesh.",
+                 "parallel"_a = false)
             .def_readwrite("vertices", &MeshBase::vertices_,
                            "``float64`` array of shape ``(num_vertices, 3)``, "
                            "use ``numpy.asarray()`` to access data: Vertex "
@@ -117,7 +118,11 @@ void pybind_meshbase(py::module &m) {
     docstring::ClassMethodDocInject(m, "MeshBase", "normalize_normals");
     docstring::ClassMethodDocInject(m, "MeshBase", "paint_uniform_color",
                                     {{"color", "RGB colors of vertices."}});
-    docstring::ClassMethodDocInject(m, "MeshBase", "compute_convex_hull");
+    docstring::ClassMethodDocInject(
+            m, "MeshBase", "compute_convex_hull",
+            {{"parallel",
+              "Cull interior points and reduce partitions of the vertices to "
+              "their hull vertices in parallel before the final hull."}});
 }
 
 void pybind_meshbase_methods(py::module &m) {}
@@ -31,6 +31,7 @@
 #include "open3d/camera/PinholeCameraIntrinsic.h"
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/RGBDImage.h"
+#include "open3d/geometry/TriangleMesh.h"
 #include "pybind/docstring.h"
 #include "pybind/geometry/geometry.h"
 #include "pybind/geometry/geometry_trampoline.h"
@@ -39,6 +40,34 @@ namespace open3d {
 namespace geometry {
 
 void pybind_pointcloud(py::module &m) {
+    py::class_<ClusterStatistics> cluster_statistics(
+            m, "ClusterStatistics",
+            "Per label statistics of a labeled point cloud, indexed by "
+            "label.");
+    py::detail::bind_default_constructor<ClusterStatistics>(
+            cluster_statistics);
+    py::detail::bind_copy_functions<ClusterStatistics>(cluster_statistics);
+    cluster_statistics
+            .def_readwrite("counts", &ClusterStatistics::counts_,
+                           "List of int: Number of points with each label.")
+            .def_readwrite("centroids", &ClusterStatistics::centroids_,
+                           "``float64`` array of shape ``(num_labels, 3)``: "
+                           "Mean of the points with each label.")
+            .def_readwrite("covariances", &ClusterStatistics::covariances_,
+                           "List of ``float64`` arrays of shape ``(3, 3)``: "
+                           "Covariance of the points with each label.")
+            .def_readwrite("axis_aligned_bounding_boxes",
+                           &ClusterStatistics::axis_aligned_bounding_boxes_,
+                           "List of open3d.geometry.AxisAlignedBoundingBox.")
+            .def_readwrite("oriented_bounding_boxes",
+                           &ClusterStatistics::oriented_bounding_boxes_,
+                           "List of open3d.geometry.OrientedBoundingBox "
+                           "along the principal axes.")
+            .def("__repr__", [](const ClusterStatistics &stats) {
+                return std::string("ClusterStatistics with ") +
+                       std::to_string(stats.counts_.size()) + " labels.";
+            });
+
     py::class_<PointCloud, PyGeometry3D<PointCloud>,
                std::shared_ptr<PointCloud>, Geometry3D>
             pointcloud(m, "PointCloud",
@@ -139,7 +168,12 @@ void pybind_pointcloud(py::module &m) {
                  "For each point in the source point cloud, compute the "
                  "distance to "
                  "the target point cloud.",
-                 "target"_a)
+                 "target"_a, "max_distance"_a = 0.0)
+            .def("compute_triangle_mesh_distance",
+                 &PointCloud::ComputeTriangleMeshDistance,
+                 "For each point in the point cloud, compute the distance to "
+                 "the closest point on the triangles of the mesh.",
+                 "mesh"_a, "max_distance"_a = 0.0)
             .def("compute_mean_and_covariance",
                  &PointCloud::ComputeMeanAndCovariance,
                  "Function to compute the mean and covariance matrix of a "
@@ -156,8 +190,11 @@ void pybind_pointcloud(py::module &m) {
                  "Function to compute the distance from a point to its nearest "
                  "neighbor in the point cloud")
             .def("compute_convex_hull", &PointCloud::ComputeConvexHull,
-                 "Computes the convex hull of the point cloud.")
-            .def("hidden_point_removal", &PointCloud::HiddenPointRemoval,
+                 "Computes the convex hull of the point cloud.",
+                 "parallel"_a = false)
+            .def("hidden_point_removal",
+                 py::overload_cast<const Eigen::Vector3d &, const double>(
+                         &PointCloud::HiddenPointRemoval, py::const_),
                  "Removes hidden points from a point cloud and returns a mesh "
                  "of the remaining points. Based on Katz et al. 'Direct "
                  "Visibility of Point Sets', 2007. Additional information "
@@ -165,12 +202,34 @@ void pybind_pointcloud(py::module &m) {
                  "found in Mehra et. al. 'Visibility of Noisy Point Cloud "
                  "Data', 2010.",
                  "camera_location"_a, "radius"_a)
+            .def("hidden_point_removal_multi_view",
+                 py::overload_cast<const std::vector<Eigen::Vector3d> &,
+                                   const double>(
+                         &PointCloud::HiddenPointRemoval, py::const_),
+                 "Hidden point removal from several viewpoints, processed "
+                 "concurrently. Returns the sorted indices of the visible "
+                 "points for each viewpoint.",
+                 "camera_locations"_a, "radius"_a)
+            .def("hidden_point_removal_z_buffer",
+                 &PointCloud::HiddenPointRemovalZBuffer,
+                 "Approximate hidden point removal with a z-buffer over a "
+                 "spherical grid around each viewpoint, in linear time. "
+                 "Returns the sorted indices of the visible points for each "
+                 "viewpoint.",
+                 "camera_locations"_a, "resolution"_a = 512,
+                 "depth_tolerance"_a = 0.05)
             .def("cluster_dbscan", &PointCloud::ClusterDBSCAN,
                  "Cluster PointCloud using the DBSCAN algorithm  Ester et al., "
                  "'A Density-Based Algorithm for Discovering Clusters in Large "
                  "Spatial Databases with Noise', 1996. Returns a list of point "
                  "labels, -1 indicates noise according to the algorithm.",
                  "eps"_a, "min_points"_a, "print_progress"_a = false)
+            .def("compute_cluster_statistics",
+                 &PointCloud::ComputeClusterStatistics,
+                 "Computes the count, centroid, covariance, axis aligned and "
+                 "oriented bounding box of the points of each label in "
+                 "parallel, without extracting the clusters.",
+                 "labels"_a)
             .def("segment_plane", &PointCloud::SegmentPlane,
                  "Segments a plane in the point cloud using the RANSAC "
                  "algorithm.",
@@ -276,23 +335,49 @@ void pybind_pointcloud(py::module &m) {
             {{"k",
               "Number of k nearest neighbors used in constructing the "
               "Riemannian graph used to propogate normal orientation."}});
-    docstring::ClassMethodDocInject(m, "PointCloud",
-                                    "compute_point_cloud_distance",
-                                    {{"target", "The target point cloud."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "compute_point_cloud_distance",
+            {{"target", "The target point cloud."},
+             {"max_distance",
+              "If positive, the search is bounded by this distance, and "
+              "larger distances are reported as max_distance."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "compute_triangle_mesh_distance",
+            {{"mesh", "The target triangle mesh."},
+             {"max_distance",
+              "If positive, the search is bounded by this distance, and "
+              "larger distances are reported as max_distance."}});
     docstring::ClassMethodDocInject(m, "PointCloud",
                                     "compute_mean_and_covariance");
     docstring::ClassMethodDocInject(m, "PointCloud",
                                     "compute_mahalanobis_distance");
     docstring::ClassMethodDocInject(m, "PointCloud",
                                     "compute_nearest_neighbor_distance");
-    docstring::ClassMethodDocInject(m, "PointCloud", "compute_convex_hull",
-                                    {{"input", "The input point cloud."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "compute_convex_hull",
+            {{"input", "The input point cloud."},
+             {"parallel",
+              "Cull interior points and reduce partitions of the points to "
+              "their hull vertices in parallel before the final hull."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "hidden_point_removal",
             {{"input", "The input point cloud."},
              {"camera_location",
               "All points not visible from that location will be reomved"},
              {"radius", "The radius of the sperical projection"}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "hidden_point_removal_multi_view",
+            {{"camera_locations", "The viewpoints."},
+             {"radius", "The radius of the spherical projection."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "hidden_point_removal_z_buffer",
+            {{"camera_locations", "The viewpoints."},
+             {"resolution",
+              "Number of elevation cells of the spherical grid, which has "
+              "twice as many azimuth cells."},
+             {"depth_tolerance",
+              "A point is visible if its distance is within this relative "
+              "tolerance of the closest point in its grid cell."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "cluster_dbscan",
             {{"eps",
@@ -300,6 +385,11 @@ void pybind_pointcloud(py::module &m) {
              {"min_points", "Minimum number of points to form a cluster."},
              {"print_progress",
               "If true the progress is visualized in the console."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "compute_cluster_statistics",
+            {{"labels",
+              "One label per point, e.g. from cluster_dbscan. Negative labels "
+              "(noise) are ignored."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "segment_plane",
             {{"distance_threshold",
@@ -273,7 +273,8 @@ void pybind_trianglemesh(py::module &m) {
                  "maximum_error"_a = std::numeric_limits<double>::infinity(),
                  "boundary_weight"_a = 1.0)
             .def("compute_convex_hull", &TriangleMesh::ComputeConvexHull,
-                 "Computes the convex hull of the triangle mesh.")
+                 "Computes the convex hull of the triangle mesh.",
+                 "parallel"_a = false)
             .def("cluster_connected_triangles",
                  &TriangleMesh::ClusterConnectedTriangles,
                  "Function that clusters connected triangles, i.e., triangles "
@@ -326,12 +327,28 @@ void pybind_trianglemesh(py::module &m) {
                     "\"Three-Dimensional Alpha Shapes\", 1994.",
                     "pcd"_a, "alpha"_a)
             .def_static("create_from_point_cloud_alpha_shape",
-                        &TriangleMesh::CreateFromPointCloudAlphaShape,
+                        py::overload_cast<const PointCloud &, double,
+                                          std::shared_ptr<TetraMesh>,
+                                          std::vector<size_t> *>(
+                                &TriangleMesh::CreateFromPointCloudAlphaShape),
                         "Alpha shapes are a generalization of the convex hull. "
                         "With decreasing alpha value the shape schrinks and "
                         "creates cavities. See Edelsbrunner and Muecke, "
                         "\"Three-Dimensional Alpha Shapes\", 1994.",
                         "pcd"_a, "alpha"_a, "tetra_mesh"_a, "pt_map"_a)
+            .def_static(
+                    "create_from_point_cloud_alpha_shapes",
+                    [](const PointCloud &pcd,
+                       const std::vector<double> &alphas) {
+                        return TriangleMesh::CreateFromPointCloudAlphaShape(
+                                pcd, alphas);
+                    },
+                    "Alpha shapes for several alpha values from a single "
+                    "Delaunay tetrahedralization. Returns a mesh per alpha "
+                    "value, each equal to the one of "
+                    "create_from_point_cloud_alpha_shape up to the order of "
+                    "the triangles.",
+                    "pcd"_a, "alphas"_a)
             .def_static(
                     "create_from_point_cloud_ball_pivoting",
                     &TriangleMesh::CreateFromPointCloudBallPivoting,
@@ -613,7 +630,11 @@ void pybind_trianglemesh(py::module &m) {
              {"boundary_weight",
               "A weight applied to edge vertices used to preserve "
               "boundaries"}});
-    docstring::ClassMethodDocInject(m, "TriangleMesh", "compute_convex_hull");
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "compute_convex_hull",
+            {{"parallel",
+              "Cull interior points and reduce partitions of the vertices to "
+              "their hull vertices in parallel before the final hull."}});
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "cluster_connected_triangles");
     docstring::ClassMethodDocInject(
@@ -664,6 +685,12 @@ void pybind_trianglemesh(py::module &m) {
               "Otherwise, TetraMesh is computed from pcd."},
              {"pt_map",
               "Optional map from tetra_mesh vertex indices to pcd points."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "create_from_point_cloud_alpha_shapes",
+            {{"pcd",
+              "PointCloud from which the TriangleMesh surfaces are "
+              "reconstructed."},
+             {"alphas", "The alpha values, in any order."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_from_point_cloud_ball_pivoting",
             {{"pcd",
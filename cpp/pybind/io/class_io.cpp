@@ -95,6 +95,14 @@ static const std::unordered_map<std::string, std::string>
                 {"parameters",
                  "The ``PinholeCameraParameters`` object for I/O"},
                 {"pose_graph", "The ``PoseGraph`` object for I/O"},
+                {"node_begin",
+                 "Index of the first node of ``pose_graph`` to append"},
+                {"edge_begin",
+                 "Index of the first edge of ``pose_graph`` to append"},
+                {"begin",
+                 "Index of the first camera of ``trajectory`` to append"},
+                {"float32_information",
+                 "Store information matrices in float32 to reduce file size"},
                 {"feature", "The ``Feature`` object for I/O"},
                 {"print_progress",
                  "If set to true a progress bar is visualized in the console"},
@@ -361,6 +369,21 @@ void pybind_class_io(py::module &m_io) {
     docstring::FunctionDocInject(m_io, "write_pinhole_camera_trajectory",
                                  map_shared_argument_docstrings);
 
+    m_io.def(
+            "append_pinhole_camera_trajectory",
+            [](const std::string &filename,
+               const camera::PinholeCameraTrajectory &trajectory,
+               size_t begin) {
+                py::gil_scoped_release release;
+                return AppendPinholeCameraTrajectoryToBIN(filename, trajectory,
+                                                          begin);
+            },
+            "Function to append the cameras of PinholeCameraTrajectory from "
+            "begin to a binary (.bin) trajectory file",
+            "filename"_a, "trajectory"_a, "begin"_a);
+    docstring::FunctionDocInject(m_io, "append_pinhole_camera_trajectory",
+                                 map_shared_argument_docstrings);
+
     // open3d::registration
     m_io.def(
             "read_feature",
@@ -409,6 +432,23 @@ void pybind_class_io(py::module &m_io) {
     docstring::FunctionDocInject(m_io, "write_pose_graph",
                                  map_shared_argument_docstrings);
 
+    m_io.def(
+            "append_pose_graph",
+            [](const std::string &filename,
+               const pipelines::registration::PoseGraph &pose_graph,
+               size_t node_begin, size_t edge_begin,
+               bool float32_information) {
+                py::gil_scoped_release release;
+                return AppendPoseGraphToBIN(filename, pose_graph, node_begin,
+                                            edge_begin, float32_information);
+            },
+            "Function to append the nodes and edges of PoseGraph from "
+            "node_begin and edge_begin to a binary (.bin) pose graph file",
+            "filename"_a, "pose_graph"_a, "node_begin"_a, "edge_begin"_a,
+            "float32_information"_a = false);
+    docstring::FunctionDocInject(m_io, "append_pose_graph",
+                                 map_shared_argument_docstrings);
+
 #ifdef BUILD_AZURE_KINECT
     m_io.def(
             "read_azure_kinect_sensor_config",
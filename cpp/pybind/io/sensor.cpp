@@ -42,6 +42,14 @@ void pybind_sensor(py::module &m) {
                     {"config", "AzureKinectSensor's config file."},
                     {"timestamp", "Timestamp in the video (usec)."},
                     {"filename", "Path to the mkv file."},
+                    {"build_index",
+                     "Scan the file once to record the timestamp of every "
+                     "capture."},
+                    {"frame_index", "Index of the capture."},
+                    {"num_threads", "Number of threads."},
+                    {"queue_size", "Maximum number of frames decoded ahead."},
+                    {"start", "Index of the first capture."},
+                    {"end", "One past the index of the last capture."},
                     {"enable_record", "Enable recording to mkv file."},
                     {"enable_align_depth_to_color",
                      "Enable aligning WFOV depth image to the color image in "
@@ -132,12 +140,12 @@ void pybind_sensor(py::module &m) {
     // Class mkv reader
     py::class_<MKVReader> azure_kinect_mkv_reader(
             m, "AzureKinectMKVReader", "AzureKinect mkv file reader.");
-    azure_kinect_mkv_reader.def(py::init([]() { return MKVReader(); }));
+    azure_kinect_mkv_reader.def(py::init<>());
     azure_kinect_mkv_reader
             .def("is_opened", &MKVReader::IsOpened,
                  "Check if the mkv file  is opened.")
             .def("open", &MKVReader::Open, "filename"_a,
-                 "Open an mkv playback.")
+                 "build_index"_a = false, "Open an mkv playback.")
             .def("close", &MKVReader::Close, "Close the opened mkv playback.")
             .def("is_eof", &MKVReader::IsEOF,
                  "Check if the mkv file is all read.")
@@ -147,7 +155,24 @@ void pybind_sensor(py::module &m) {
                  "Seek to the timestamp (in us).")
             .def("next_frame", &MKVReader::NextFrame,
                  "Get next frame from the mkv playback and returns the RGBD "
-                 "object.");
+                 "object.")
+            .def("has_frame_index", &MKVReader::HasFrameIndex,
+                 "Check if the frame index has been built.")
+            .def("get_num_frames", &MKVReader::GetNumFrames,
+                 "Number of captures in the file. Requires the frame index.")
+            .def("get_frame_timestamps", &MKVReader::GetFrameTimestamps,
+                 "Timestamps (in us) of every capture. Requires the frame "
+                 "index.")
+            .def("seek_frame", &MKVReader::SeekFrame, "frame_index"_a,
+                 "Seek to the capture with the given index. Requires the "
+                 "frame index.")
+            .def("set_decode_ahead", &MKVReader::SetDecodeAhead,
+                 "num_threads"_a, "queue_size"_a = 8,
+                 "Decode frames ahead of next_frame on worker threads.")
+            .def("read_frames", &MKVReader::ReadFrames, "start"_a, "end"_a,
+                 "num_threads"_a = -1,
+                 "Read and decode a range of captures in parallel. Requires "
+                 "the frame index.");
     docstring::ClassMethodDocInject(m, "AzureKinectMKVReader", "open",
                                     map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "AzureKinectMKVReader", "close",
@@ -160,6 +185,13 @@ void pybind_sensor(py::module &m) {
                                     map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "AzureKinectMKVReader", "next_frame",
                                     map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "AzureKinectMKVReader", "seek_frame",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "AzureKinectMKVReader",
+                                    "set_decode_ahead",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "AzureKinectMKVReader", "read_frames",
+                                    map_shared_argument_docstrings);
 }
 
 }  // namespace io
@@ -423,17 +423,20 @@ must hold true for all edges.)");
                              bool decrease_mu,
                              double maximum_correspondence_distance,
                              int iteration_number, double tuple_scale,
-                             int maximum_tuple_count) {
+                             int maximum_tuple_count,
+                             int feature_search_checks) {
                      return new FastGlobalRegistrationOption(
                              division_factor, use_absolute_scale, decrease_mu,
                              maximum_correspondence_distance, iteration_number,
-                             tuple_scale, maximum_tuple_count);
+                             tuple_scale, maximum_tuple_count,
+                             feature_search_checks);
                  }),
                  "division_factor"_a = 1.4, "use_absolute_scale"_a = false,
                  "decrease_mu"_a = false,
                  "maximum_correspondence_distance"_a = 0.025,
                  "iteration_number"_a = 64, "tuple_scale"_a = 0.95,
-                 "maximum_tuple_count"_a = 1000)
+                 "maximum_tuple_count"_a = 1000,
+                 "feature_search_checks"_a = -1)
             .def_readwrite(
                     "division_factor",
                     &FastGlobalRegistrationOption::division_factor_,
@@ -461,6 +464,12 @@ must hold true for all edges.)");
             .def_readwrite("maximum_tuple_count",
                            &FastGlobalRegistrationOption::maximum_tuple_count_,
                            "float: Maximum tuple numbers.")
+            .def_readwrite(
+                    "feature_search_checks",
+                    &FastGlobalRegistrationOption::feature_search_checks_,
+                    "int: Number of leaves visited by the approximate feature "
+                    "matching with randomized kd-trees. -1 for exact "
+                    "matching.")
             .def("__repr__", [](const FastGlobalRegistrationOption &c) {
                 return fmt::format(
                         ""
@@ -471,11 +480,12 @@ must hold true for all edges.)");
                         "\nmaximum_correspondence_distance={}"
                         "\niteration_number={}"
                         "\ntuple_scale={}"
-                        "\nmaximum_tuple_count={}",
+                        "\nmaximum_tuple_count={}"
+                        "\nfeature_search_checks={}",
                         c.division_factor_, c.use_absolute_scale_,
                         c.decrease_mu_, c.maximum_correspondence_distance_,
                         c.iteration_number_, c.tuple_scale_,
-                        c.maximum_tuple_count_);
+                        c.maximum_tuple_count_, c.feature_search_checks_);
             });
 
     // open3d.registration.RegistrationResult
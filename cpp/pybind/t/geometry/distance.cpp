@@ -0,0 +1,79 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/Distance.h"
+
+#include "pybind/docstring.h"
+#include "pybind/t/geometry/geometry.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+void pybind_distance_methods(py::module &m) {
+    m.def("compute_point_cloud_distance", &distance::ComputePointCloudDistance,
+          "For each point in the source point cloud, compute the distance to "
+          "the target point cloud.",
+          "source"_a, "target"_a, "max_distance"_a = 0.0);
+    m.def("compute_triangle_mesh_distance",
+          &distance::ComputeTriangleMeshDistance,
+          "For each point in the source point cloud, compute the distance to "
+          "the closest point on the triangles of the target mesh.",
+          "source"_a, "target"_a, "max_distance"_a = 0.0);
+    m.def("compute_distance_summary",
+          py::overload_cast<const PointCloud &, const PointCloud &, double>(
+                  &distance::ComputeDistanceSummary),
+          "Function to compute the Hausdorff and Chamfer distances between "
+          "two point clouds.",
+          "source"_a, "target"_a, "max_distance"_a = 0.0);
+    m.def("compute_distance_summary",
+          py::overload_cast<const PointCloud &, const TriangleMesh &, double>(
+                  &distance::ComputeDistanceSummary),
+          "Function to compute the Hausdorff and Chamfer distances between a "
+          "point cloud and the triangles of a mesh.",
+          "source"_a, "target"_a, "max_distance"_a = 0.0);
+
+    for (const char *name :
+         {"compute_point_cloud_distance", "compute_triangle_mesh_distance"}) {
+        docstring::FunctionDocInject(
+                m, name,
+                {{"source", "The source point cloud."},
+                 {"target", "The target geometry."},
+                 {"max_distance",
+                  "If positive, the search is bounded by this distance, and "
+                  "larger distances are reported as max_distance."}});
+    }
+}
+
+void pybind_distance(py::module &m) {
+    py::module m_submodule = m.def_submodule(
+            "distance", "Point cloud and mesh distance computation.");
+    pybind_distance_methods(m_submodule);
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -55,6 +55,8 @@ void pybind_geometry(py::module& m) {
     pybind_trianglemesh(m_submodule);
     pybind_image(m_submodule);
     pybind_tsdf_voxelgrid(m_submodule);
+    pybind_keypoint(m_submodule);
+    pybind_distance(m_submodule);
 }
 
 }  // namespace geometry
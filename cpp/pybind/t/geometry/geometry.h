@@ -56,6 +56,8 @@ void pybind_pointcloud(py::module& m);
 void pybind_trianglemesh(py::module& m);
 void pybind_image(py::module& m);
 void pybind_tsdf_voxelgrid(py::module& m);
+void pybind_keypoint(py::module& m);
+void pybind_distance(py::module& m);
 
 }  // namespace geometry
 }  // namespace t
@@ -85,6 +85,11 @@ void pybind_pointcloud(py::module& m) {
                    "Scale points.");
     pointcloud.def("rotate", &PointCloud::Rotate, "R"_a, "center"_a,
                    "Rotate points and normals (if exist).");
+    pointcloud.def("compute_cluster_statistics",
+                   &PointCloud::ComputeClusterStatistics, "labels"_a,
+                   "Computes per label counts, centroids, covariances, axis "
+                   "aligned and oriented bounding boxes in one call. Negative "
+                   "labels are ignored.");
     pointcloud.def_static(
             "create_from_depth_image", &PointCloud::CreateFromDepthImage,
             "depth"_a, "intrinsics"_a,
@@ -62,6 +62,14 @@ void pybind_tsdf_voxelgrid(py::module& m) {
             py::overload_cast<const Image&, const Image&, const core::Tensor&,
                               const core::Tensor&, float, float>(
                     &TSDFVoxelGrid::Integrate));
+    tsdf_voxelgrid.def(
+            "integrate_batch", &TSDFVoxelGrid::IntegrateBatch,
+            "Integrate a batch of frames known upfront. Voxel blocks of all "
+            "the frames are allocated at once, and each voxel is updated by "
+            "all the frames in order. colors can be empty for depth-only "
+            "integration.",
+            "depths"_a, "colors"_a, "intrinsics"_a, "extrinsics"_a,
+            "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f);
 
     tsdf_voxelgrid.def("extract_surface_points",
                        &TSDFVoxelGrid::ExtractSurfacePoints,
@@ -70,6 +78,25 @@ void pybind_tsdf_voxelgrid(py::module& m) {
                        &TSDFVoxelGrid::ExtractSurfaceMesh,
                        "weight_threshold"_a = 3.0f);
 
+    tsdf_voxelgrid.def(
+            "ray_cast", &TSDFVoxelGrid::RayCast,
+            "Ray cast the surface into a virtual camera. Returns a dict of "
+            "'vertex', 'depth', 'normal' and optionally 'color' images as "
+            "tensors. Vertices and normals are in the camera frame, and depth "
+            "is multiplied by depth_scale.",
+            "intrinsics"_a, "extrinsics"_a, "width"_a, "height"_a,
+            "depth_scale"_a = 1000.0f, "depth_min"_a = 0.1f,
+            "depth_max"_a = 3.0f, "weight_threshold"_a = 3.0f);
+
+    tsdf_voxelgrid.def("save", &TSDFVoxelGrid::Save,
+                       "Save active voxel blocks and parameters to a binary "
+                       "file.",
+                       "file_name"_a);
+    tsdf_voxelgrid.def_static(
+            "load", &TSDFVoxelGrid::Load,
+            "Load a TSDFVoxelGrid saved with save() to the given device.",
+            "file_name"_a, "device"_a = core::Device("CPU:0"));
+
     tsdf_voxelgrid.def("to", &TSDFVoxelGrid::To, "device"_a, "copy"_a = false);
     tsdf_voxelgrid.def("clone", &TSDFVoxelGrid::Clone);
     tsdf_voxelgrid.def("cpu", &TSDFVoxelGrid::CPU);
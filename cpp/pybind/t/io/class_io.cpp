@@ -28,7 +28,9 @@
 #include <unordered_map>
 
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/TriangleMeshIO.h"
 #include "pybind/docstring.h"
 #include "pybind/t/io/io.h"
 
@@ -82,6 +84,9 @@ static const std::unordered_map<std::string, std::string>
                 {"feature", "The ``Feature`` object for I/O"},
                 {"print_progress",
                  "If set to true a progress bar is visualized in the console"},
+                {"enable_post_processing",
+                 "Formats without a tensor reader are read as legacy meshes, "
+                 "with ASSIMP post processing if set to true."},
 };
 
 void pybind_class_io(py::module &m_io) {
@@ -118,6 +123,45 @@ void pybind_class_io(py::module &m_io) {
             "compressed"_a = false, "print_progress"_a = false);
     docstring::FunctionDocInject(m_io, "write_point_cloud",
                                  map_shared_argument_docstrings);
+
+    m_io.def(
+            "read_triangle_mesh",
+            [](const std::string &filename, bool enable_post_processing,
+               bool print_progress) {
+                py::gil_scoped_release release;
+                t::geometry::TriangleMesh mesh;
+                ReadTriangleMesh(filename, mesh, enable_post_processing,
+                                 print_progress);
+                return mesh;
+            },
+            "Function to read TriangleMesh with tensor attributes from file. "
+            "OBJ files are parsed in parallel, with a vertex for each "
+            "distinct v/vt/vn triplet.",
+            "filename"_a, "enable_post_processing"_a = false,
+            "print_progress"_a = false);
+    docstring::FunctionDocInject(m_io, "read_triangle_mesh",
+                                 map_shared_argument_docstrings);
+
+    m_io.def(
+            "write_triangle_mesh",
+            [](const std::string &filename,
+               const t::geometry::TriangleMesh &mesh, bool write_ascii,
+               bool compressed, bool write_vertex_normals,
+               bool write_vertex_colors, bool write_triangle_uvs,
+               bool print_progress) {
+                py::gil_scoped_release release;
+                return WriteTriangleMesh(filename, mesh, write_ascii,
+                                         compressed, write_vertex_normals,
+                                         write_vertex_colors,
+                                         write_triangle_uvs, print_progress);
+            },
+            "Function to write TriangleMesh with tensor attributes to file",
+            "filename"_a, "mesh"_a, "write_ascii"_a = false,
+            "compressed"_a = false, "write_vertex_normals"_a = true,
+            "write_vertex_colors"_a = true, "write_triangle_uvs"_a = true,
+            "print_progress"_a = false);
+    docstring::FunctionDocInject(m_io, "write_triangle_mesh",
+                                 map_shared_argument_docstrings);
 }
 
 }  // namespace io
@@ -56,7 +56,16 @@ void pybind_sensor(py::module &m) {
                      "(default video length) Save frames till this time (us)"},
                     {"buffer_size",
                      "Size of internal frame buffer, increase this if you "
-                     "experience frame drops."}};
+                     "experience frame drops."},
+                    {"process",
+                     "Callback called as process(range_index, timestamp_us, "
+                     "frame) for every frame. Callbacks of different ranges "
+                     "may run concurrently, and frames of a range arrive in "
+                     "order."},
+                    {"num_readers",
+                     "Number of parallel readers. 0 uses one reader per "
+                     "core."},
+                    {"num_ranges", "Number of time ranges."}};
 
     py::enum_<SensorType>(m, "SensorType", "Sensor type")
             .value("AZURE_KINECT", SensorType::AZURE_KINECT)
@@ -209,7 +218,7 @@ void pybind_sensor(py::module &m) {
                  "Seek to the timestamp (in us).")
             .def("get_timestamp", &RSBagReader::GetTimestamp,
                  "Get current timestamp (in us).")
-            .def("next_frame", &RSBagReader::NextFrame,
+            .def("next_frame", py::overload_cast<>(&RSBagReader::NextFrame),
                  "Get next frame from the RS bag playback and returns the RGBD "
                  "object.")
             // Release Python GIL for SaveFrames, since this will take a while
@@ -218,6 +227,46 @@ void pybind_sensor(py::module &m) {
                  "start_time_us"_a = 0, "end_time_us"_a = UINT64_MAX,
                  "Save synchronized and aligned individual frames to "
                  "subfolders")
+            .def_static("split_time_ranges", &RSBagReader::SplitTimeRanges,
+                        "start_time_us"_a, "end_time_us"_a, "num_ranges"_a,
+                        "Split a time interval (us) into contiguous ranges of "
+                        "nearly equal duration.")
+            // Release Python GIL while the readers run. The callback
+            // reacquires it for every frame.
+            .def_static(
+                    "process_frames_parallel",
+                    [](const std::string &filename,
+                       const std::function<void(
+                               size_t, uint64_t,
+                               const t::geometry::RGBDImage &)> &process,
+                       size_t num_readers, uint64_t start_time_us,
+                       uint64_t end_time_us, size_t buffer_size) {
+                        // The frames alias the ring buffers of the readers,
+                        // which are reused once the callback returns. Python
+                        // may keep a reference, so each frame is copied.
+                        return RSBagReader::ProcessFramesParallel(
+                                filename,
+                                [&process](size_t range_index,
+                                           uint64_t timestamp,
+                                           const t::geometry::RGBDImage
+                                                   &frame) {
+                                    process(range_index, timestamp,
+                                            t::geometry::RGBDImage(
+                                                    frame.color_.Clone(),
+                                                    frame.depth_.Clone(),
+                                                    frame.AreAligned()));
+                                },
+                                num_readers, start_time_us, end_time_us,
+                                buffer_size);
+                    },
+                    py::call_guard<py::gil_scoped_release>(), "filename"_a,
+                    "process"_a, "num_readers"_a = 0, "start_time_us"_a = 0,
+                    "end_time_us"_a = UINT64_MAX,
+                    "buffer_size"_a = RSBagReader::DEFAULT_BUFFER_SIZE,
+                    "Process the frames of a bag file with several readers in "
+                    "parallel, each reading its own time range. The callback "
+                    "receives a copy of each frame, so that it can be kept "
+                    "after the callback returns.")
             .def("__repr__", &RSBagReader::ToString);
     docstring::ClassMethodDocInject(m, "RSBagReader", "__init__",
                                     map_shared_argument_docstrings);
@@ -227,6 +276,10 @@ void pybind_sensor(py::module &m) {
                                     map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "RSBagReader", "save_frames",
                                     map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "RSBagReader", "split_time_ranges",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "RSBagReader", "process_frames_parallel",
+                                    map_shared_argument_docstrings);
 
     // Class RealSenseSensorConfig
     py::class_<RealSenseSensorConfig> realsense_sensor_config(
@@ -0,0 +1,112 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/KernelProfiler.h"
+
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class KernelProfilerPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(KernelProfiler,
+                         KernelProfilerPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static const core::kernel::KernelOpStats *FindStats(
+        const std::vector<core::kernel::KernelOpStats> &stats,
+        const std::string &op_name) {
+    for (const core::kernel::KernelOpStats &s : stats) {
+        if (s.op_name_ == op_name) {
+            return &s;
+        }
+    }
+    return nullptr;
+}
+
+TEST_P(KernelProfilerPermuteDevices, RecordOps) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Ones({2, 3}, core::Dtype::Float32, device);
+    core::Tensor b = core::Tensor::Ones({2, 3}, core::Dtype::Float32, device);
+
+    core::kernel::KernelProfiler::SetEnabled(true);
+    core::kernel::KernelProfiler::Reset();
+    core::Tensor c = a + b;
+    c = c + b;
+    core::Tensor d = c.Sum({0, 1});
+    core::kernel::KernelProfiler::SetEnabled(false);
+    core::Tensor e = a + b;
+
+    std::vector<core::kernel::KernelOpStats> stats =
+            core::kernel::KernelProfiler::GetStats();
+    const core::kernel::KernelOpStats *add = FindStats(stats, "BinaryEW::Add");
+    ASSERT_NE(add, nullptr);
+    EXPECT_EQ(add->device_, device.ToString());
+    EXPECT_EQ(add->count_, 2);
+    EXPECT_EQ(add->num_elements_, 12);
+    EXPECT_EQ(add->num_bytes_, 2 * 3 * 6 * 4);
+
+    const core::kernel::KernelOpStats *sum = FindStats(stats, "Reduction::Sum");
+    ASSERT_NE(sum, nullptr);
+    EXPECT_EQ(sum->count_, 1);
+    EXPECT_EQ(sum->num_elements_, 6);
+    EXPECT_EQ(sum->num_bytes_, (6 + 1) * 4);
+
+    EXPECT_NE(core::kernel::KernelProfiler::GetStatsTable().find(
+                      "BinaryEW::Add"),
+              std::string::npos);
+
+    core::kernel::KernelProfiler::Reset();
+    EXPECT_EQ(core::kernel::KernelProfiler::GetStats().size(), 0u);
+}
+
+TEST_P(KernelProfilerPermuteDevices, RecordCopy) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Ones({4}, core::Dtype::Int32, device);
+
+    core::kernel::KernelProfiler::SetEnabled(true);
+    core::kernel::KernelProfiler::Reset();
+    core::Tensor b = a.To(core::Device("CPU:0"), /*copy=*/true);
+    core::kernel::KernelProfiler::SetEnabled(false);
+
+    std::vector<core::kernel::KernelOpStats> stats =
+            core::kernel::KernelProfiler::GetStats();
+    const core::kernel::KernelOpStats *copy = FindStats(stats, "Copy");
+    ASSERT_NE(copy, nullptr);
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        EXPECT_EQ(copy->device_, "CPU:0");
+    } else {
+        EXPECT_EQ(copy->device_, device.ToString() + "->CPU:0");
+    }
+    EXPECT_EQ(copy->num_elements_, 4);
+    EXPECT_EQ(copy->num_bytes_, 2 * 4 * 4);
+    core::kernel::KernelProfiler::Reset();
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,126 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/Distance.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+// Grid of triangles over the unit square in the z = 0 plane.
+geometry::TriangleMesh CreateUnitSquare(int resolution) {
+    geometry::TriangleMesh mesh;
+    for (int i = 0; i <= resolution; i++) {
+        for (int j = 0; j <= resolution; j++) {
+            mesh.vertices_.push_back(Eigen::Vector3d(
+                    double(i) / resolution, double(j) / resolution, 0));
+        }
+    }
+    for (int i = 0; i < resolution; i++) {
+        for (int j = 0; j < resolution; j++) {
+            int v = i * (resolution + 1) + j;
+            mesh.triangles_.push_back(
+                    Eigen::Vector3i(v, v + resolution + 1, v + 1));
+            mesh.triangles_.push_back(Eigen::Vector3i(
+                    v + 1, v + resolution + 1, v + resolution + 2));
+        }
+    }
+    return mesh;
+}
+
+double UnitSquareDistance(const Eigen::Vector3d &p) {
+    double dx = std::max({0.0, -p(0), p(0) - 1});
+    double dy = std::max({0.0, -p(1), p(1) - 1});
+    return std::sqrt(dx * dx + dy * dy + p(2) * p(2));
+}
+
+}  // unnamed namespace
+
+TEST(Distance, ComputeTriangleMeshDistance) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(1000);
+    Rand(pcd.points_, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(2, 2, 1),
+         0);
+    geometry::TriangleMesh mesh = CreateUnitSquare(20);
+
+    std::vector<double> distances = pcd.ComputeTriangleMeshDistance(mesh);
+    ASSERT_EQ(distances.size(), pcd.points_.size());
+    for (size_t i = 0; i < distances.size(); i++) {
+        EXPECT_NEAR(distances[i], UnitSquareDistance(pcd.points_[i]), 1e-12);
+    }
+
+    // Distances beyond max_distance are clamped.
+    distances = pcd.ComputeTriangleMeshDistance(mesh, 0.5);
+    for (size_t i = 0; i < distances.size(); i++) {
+        EXPECT_NEAR(distances[i],
+                    std::min(0.5, UnitSquareDistance(pcd.points_[i])), 1e-12);
+    }
+}
+
+TEST(Distance, ComputePointCloudDistanceMaxDistance) {
+    geometry::PointCloud source, target;
+    source.points_ = {{0, 0, 0}, {0, 0, 1}, {0, 0, 3}};
+    target.points_ = {{0, 0, 0.5}};
+    ExpectEQ(source.ComputePointCloudDistance(target),
+             std::vector<double>({0.5, 0.5, 2.5}));
+    ExpectEQ(source.ComputePointCloudDistance(target, 1.0),
+             std::vector<double>({0.5, 0.5, 1.0}));
+}
+
+TEST(Distance, ComputeDistanceSummary) {
+    geometry::PointCloud source, target;
+    source.points_ = {{0, 0, 0}, {1, 0, 0}, {2, 0, 0}};
+    target.points_ = {{0, 0, 0}, {1, 0, 0}, {5, 0, 0}};
+    geometry::DistanceSummary summary =
+            geometry::ComputeDistanceSummary(source, target);
+    EXPECT_NEAR(summary.mean_source_to_target_, 1.0 / 3, 1e-12);
+    EXPECT_NEAR(summary.mean_target_to_source_, 1.0, 1e-12);
+    EXPECT_NEAR(summary.max_source_to_target_, 1.0, 1e-12);
+    EXPECT_NEAR(summary.max_target_to_source_, 3.0, 1e-12);
+    EXPECT_NEAR(summary.hausdorff_distance_, 3.0, 1e-12);
+    EXPECT_NEAR(summary.chamfer_distance_, 4.0 / 3, 1e-12);
+
+    // Points above the square. The square corner (1, 1) is
+    // sqrt(2 + 0.25^2) away from the closest point (0, 0, 0.25).
+    geometry::TriangleMesh mesh = CreateUnitSquare(4);
+    source.points_ = {{0, 0, 0.5}, {0, 0, 0.25}};
+    summary = geometry::ComputeDistanceSummary(source, mesh);
+    EXPECT_NEAR(summary.max_source_to_target_, 0.5, 1e-12);
+    EXPECT_NEAR(summary.mean_source_to_target_, 0.375, 1e-12);
+    EXPECT_NEAR(summary.max_target_to_source_,
+                std::sqrt(2.0 + 0.25 * 0.25), 1e-12);
+}
+
+}  // namespace tests
+}  // namespace open3d
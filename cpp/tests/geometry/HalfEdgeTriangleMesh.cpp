@@ -185,7 +185,7 @@ void assert_ordreded_neighbor(
         bool allow_rotation = false) {
     std::vector<int> actual_ordered_neighbors;
     for (int half_edge_index :
-         het_mesh->ordered_half_edge_from_vertex_[vertex_index]) {
+         het_mesh->OrderedHalfEdgesFromVertex(vertex_index)) {
         actual_ordered_neighbors.push_back(
                 het_mesh->half_edges_[half_edge_index].vertex_indices_[1]);
     }
@@ -293,6 +293,58 @@ TEST(HalfEdgeTriangleMesh, Constructor_Sphere) {
     EXPECT_FALSE(het_mesh->IsEmpty());
 }
 
+TEST(HalfEdgeTriangleMesh, Constructor_NonManifold) {
+    EXPECT_ANY_THROW(geometry::HalfEdgeTriangleMesh::CreateFromTriangleMesh(
+            get_mesh_two_triangles_flipped()));
+    EXPECT_ANY_THROW(geometry::HalfEdgeTriangleMesh::CreateFromTriangleMesh(
+            get_mesh_two_triangles_invalid_vertex()));
+}
+
+TEST(HalfEdgeTriangleMesh, NoHalfEdges) {
+    geometry::HalfEdgeTriangleMesh het_mesh;
+    het_mesh.vertices_ = get_mesh_two_triangles().vertices_;
+    EXPECT_FALSE(het_mesh.HasHalfEdges());
+    EXPECT_TRUE(het_mesh.GetOrderedHalfEdgesFromVertices().empty());
+    EXPECT_ANY_THROW(het_mesh.GetBoundaries());
+    EXPECT_ANY_THROW(het_mesh.BoundaryHalfEdgesFromVertex(0));
+    EXPECT_ANY_THROW(het_mesh.OneRingVerticesFromVertex(0));
+}
+
+TEST(HalfEdgeTriangleMesh, OrderedHalfEdgeOffsets_PartialHexagon) {
+    auto mesh = get_mesh_partial_hexagon();
+    auto het_mesh =
+            geometry::HalfEdgeTriangleMesh::CreateFromTriangleMesh(mesh);
+    EXPECT_TRUE(het_mesh->HasHalfEdges());
+    ASSERT_EQ(het_mesh->ordered_half_edge_offsets_.size(),
+              het_mesh->vertices_.size() + 1);
+    EXPECT_EQ(het_mesh->ordered_half_edge_indices_.size(),
+              het_mesh->half_edges_.size());
+    for (size_t vertex_index = 0; vertex_index < het_mesh->vertices_.size();
+         ++vertex_index) {
+        std::vector<int> ordered_half_edges(
+                het_mesh->ordered_half_edge_indices_.begin() +
+                        het_mesh->ordered_half_edge_offsets_[vertex_index],
+                het_mesh->ordered_half_edge_indices_.begin() +
+                        het_mesh->ordered_half_edge_offsets_[vertex_index + 1]);
+        EXPECT_EQ(ordered_half_edges,
+                  het_mesh->OrderedHalfEdgesFromVertex(vertex_index));
+        EXPECT_EQ(ordered_half_edges,
+                  het_mesh->GetOrderedHalfEdgesFromVertices()[vertex_index]);
+    }
+    for (size_t half_edge_index = 0;
+         half_edge_index < het_mesh->half_edges_.size(); ++half_edge_index) {
+        const auto& he = het_mesh->half_edges_[half_edge_index];
+        EXPECT_EQ(he.triangle_index_, int(half_edge_index / 3));
+        if (!he.IsBoundary()) {
+            const auto& twin = het_mesh->half_edges_[he.twin_];
+            EXPECT_EQ(twin.twin_, int(half_edge_index));
+            EXPECT_EQ(twin.vertex_indices_,
+                      Eigen::Vector2i(he.vertex_indices_(1),
+                                      he.vertex_indices_(0)));
+        }
+    }
+}
+
 TEST(HalfEdgeTriangleMesh, OrderedHalfEdgesFromVertex_TwoTriangles) {
     auto mesh = get_mesh_two_triangles();
     auto het_mesh =
@@ -455,6 +507,36 @@ TEST(HalfEdgeTriangleMesh, BoundaryVerticesFromVertex_PartialHexagon) {
     ExpectEQ(het_mesh->BoundaryVerticesFromVertex(6), {6, 3, 4, 1, 0, 2, 5});
 }
 
+TEST(HalfEdgeTriangleMesh, OneRingVerticesFromVertex_TwoTriangles) {
+    auto mesh = get_mesh_two_triangles();
+    auto het_mesh =
+            geometry::HalfEdgeTriangleMesh::CreateFromTriangleMesh(mesh);
+    assert_vector_eq(het_mesh->OneRingVerticesFromVertex(0), {2, 1});
+    assert_vector_eq(het_mesh->OneRingVerticesFromVertex(1), {0, 2, 3});
+    assert_vector_eq(het_mesh->OneRingVerticesFromVertex(2), {3, 1, 0});
+    assert_vector_eq(het_mesh->OneRingVerticesFromVertex(3), {1, 2});
+}
+
+TEST(HalfEdgeTriangleMesh, OneRingVerticesFromVertex_Hexagon) {
+    auto mesh = get_mesh_hexagon();
+    auto het_mesh =
+            geometry::HalfEdgeTriangleMesh::CreateFromTriangleMesh(mesh);
+    assert_vector_eq(het_mesh->OneRingVerticesFromVertex(0), {2, 3, 1});
+    assert_vector_eq(het_mesh->OneRingVerticesFromVertex(3),
+                     {0, 2, 5, 6, 4, 1}, true);
+    assert_vector_eq(het_mesh->OneRingVerticesFromVertex(6), {4, 3, 5});
+}
+
+TEST(HalfEdgeTriangleMesh, OneRingVerticesFromVertex_PartialHexagon) {
+    auto mesh = get_mesh_partial_hexagon();
+    auto het_mesh =
+            geometry::HalfEdgeTriangleMesh::CreateFromTriangleMesh(mesh);
+    assert_vector_eq(het_mesh->OneRingVerticesFromVertex(3),
+                     {4, 1, 0, 2, 5, 6});
+    assert_vector_eq(het_mesh->OneRingVerticesFromVertex(4), {1, 3});
+    assert_vector_eq(het_mesh->OneRingVerticesFromVertex(6), {3, 5});
+}
+
 TEST(HalfEdgeTriangleMesh, GetBoundaries_TwoTriangles) {
     auto mesh = get_mesh_two_triangles();
     auto het_mesh =
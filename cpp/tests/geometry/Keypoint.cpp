@@ -0,0 +1,99 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/Keypoint.h"
+
+#include <algorithm>
+
+#include "open3d/geometry/PointCloud.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+// Points on a grid over the surface of the unit box.
+geometry::PointCloud CreateBoxSurface(int resolution) {
+    geometry::PointCloud pcd;
+    const double step = 1.0 / resolution;
+    for (int axis = 0; axis < 3; axis++) {
+        for (int side = 0; side < 2; side++) {
+            for (int u = 0; u <= resolution; u++) {
+                for (int v = 0; v <= resolution; v++) {
+                    Eigen::Vector3d point;
+                    point(axis) = side;
+                    point((axis + 1) % 3) = u * step;
+                    point((axis + 2) % 3) = v * step;
+                    pcd.points_.push_back(point);
+                }
+            }
+        }
+    }
+    return pcd;
+}
+
+}  // namespace
+
+TEST(Keypoint, ComputeISSKeypoints) {
+    const geometry::PointCloud pcd = CreateBoxSurface(40);
+
+    std::vector<size_t> indices = geometry::keypoint::ComputeISSKeypointIndices(
+            pcd, 0.1, 0.08, 0.975, 0.975, 5);
+    EXPECT_FALSE(indices.empty());
+    EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+
+    // Keypoints are close to the edges of the box.
+    for (size_t idx : indices) {
+        const Eigen::Vector3d &p = pcd.points_[idx];
+        int num_boundaries = 0;
+        for (int i = 0; i < 3; i++) {
+            num_boundaries += p(i) < 0.1 || p(i) > 0.9;
+        }
+        EXPECT_GE(num_boundaries, 2);
+    }
+
+    // Results do not depend on the neighborhood cache.
+    std::vector<size_t> indices_uncached =
+            geometry::keypoint::ComputeISSKeypointIndices(
+                    pcd, 0.1, 0.08, 0.975, 0.975, 5, 0);
+    EXPECT_EQ(indices, indices_uncached);
+
+    // Smaller salient radius than non maxima suppression radius.
+    EXPECT_EQ(geometry::keypoint::ComputeISSKeypointIndices(
+                      pcd, 0.08, 0.1, 0.975, 0.975, 5),
+              geometry::keypoint::ComputeISSKeypointIndices(
+                      pcd, 0.08, 0.1, 0.975, 0.975, 5, 0));
+
+    auto keypoints = geometry::keypoint::ComputeISSKeypoints(pcd, 0.1, 0.08);
+    EXPECT_EQ(keypoints->points_.size(), indices.size());
+
+    EXPECT_TRUE(geometry::keypoint::ComputeISSKeypoints(geometry::PointCloud())
+                        ->IsEmpty());
+}
+
+}  // namespace tests
+}  // namespace open3d
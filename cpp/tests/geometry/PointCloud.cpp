@@ -193,6 +193,102 @@ TEST(PointCloud, GetOrientedBoundingBox) {
                                                 {3, 2, 1}})));
 }
 
+TEST(PointCloud, OrientedBoundingBoxCreationMethods) {
+    // Points in a box of extent (4, 2, 1), rotated and translated.
+    std::vector<Eigen::Vector3d> points(200);
+    Rand(points, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(4, 2, 1), 0);
+    for (int i = 0; i < 8; i++) {
+        points.push_back(Eigen::Vector3d(4 * (i & 1), 2 * ((i >> 1) & 1),
+                                         (i >> 2) & 1));
+    }
+    const Eigen::Matrix3d R =
+            geometry::Geometry3D::GetRotationMatrixFromXYZ({0.3, -0.5, 0.8});
+    for (auto& point : points) {
+        point = R * point + Eigen::Vector3d(1, 2, 3);
+    }
+
+    using CreationMethod = geometry::OrientedBoundingBox::CreationMethod;
+    geometry::OrientedBoundingBox hull_obb =
+            geometry::OrientedBoundingBox::CreateFromPoints(
+                    points, CreationMethod::ConvexHullPCA);
+    geometry::OrientedBoundingBox pca_obb =
+            geometry::OrientedBoundingBox::CreateFromPoints(
+                    points, CreationMethod::PCA);
+    geometry::OrientedBoundingBox min_obb =
+            geometry::OrientedBoundingBox::CreateFromPoints(
+                    points, CreationMethod::MinimumVolume);
+
+    EXPECT_NEAR(min_obb.Volume(), 8, 1e-6);
+    ExpectEQ(min_obb.extent_, Eigen::Vector3d(4, 2, 1), 1e-6);
+    Eigen::Vector3d center =
+            R * Eigen::Vector3d(2, 1, 0.5) + Eigen::Vector3d(1, 2, 3);
+    ExpectEQ(min_obb.center_, center, 1e-6);
+    EXPECT_NEAR(min_obb.R_.determinant(), 1, 1e-9);
+    EXPECT_LE(min_obb.Volume(), hull_obb.Volume() + 1e-9);
+    for (const auto& obb : {hull_obb, pca_obb, min_obb}) {
+        for (const auto& point : points) {
+            Eigen::Vector3d local = obb.R_.transpose() * (point - obb.center_);
+            EXPECT_TRUE((local.cwiseAbs() - obb.extent_ / 2).maxCoeff() <
+                        1e-9);
+        }
+    }
+
+    // Unlike the convex hull, PCA accepts planar points.
+    std::vector<Eigen::Vector3d> plane = {
+            {0, 0, 0}, {0, 0, 1}, {0, 1, 0}, {0, 1, 1}};
+    EXPECT_ANY_THROW(
+            geometry::OrientedBoundingBox::CreateFromPoints(plane));
+    EXPECT_ANY_THROW(geometry::OrientedBoundingBox::CreateFromPoints(
+            plane, CreationMethod::MinimumVolume));
+    geometry::OrientedBoundingBox plane_obb =
+            geometry::OrientedBoundingBox::CreateFromPoints(
+                    plane, CreationMethod::PCA);
+    ExpectEQ(plane_obb.center_, Eigen::Vector3d(0, 0.5, 0.5));
+    EXPECT_NEAR(plane_obb.Volume(), 0, 1e-12);
+    EXPECT_ANY_THROW(geometry::OrientedBoundingBox::CreateFromPoints(
+            std::vector<Eigen::Vector3d>(), CreationMethod::PCA));
+}
+
+TEST(PointCloud, OrientedBoundingBoxCreateFromPointIndices) {
+    std::vector<Eigen::Vector3d> points(100);
+    Rand(points, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1), 0);
+    points.push_back({5, 0, 0});
+    points.push_back({5, 1, 0});
+    points.push_back({5, 0, 1});
+    points.push_back({5, 1, 1});
+
+    std::vector<std::vector<size_t>> indices(4);
+    for (size_t i = 0; i < 100; i++) {
+        indices[i % 2].push_back(i);
+    }
+    indices[2] = {100, 101, 102, 103};
+
+    using CreationMethod = geometry::OrientedBoundingBox::CreationMethod;
+    for (auto method : {CreationMethod::PCA, CreationMethod::ConvexHullPCA,
+                        CreationMethod::MinimumVolume}) {
+        std::vector<geometry::OrientedBoundingBox> obbs =
+                geometry::OrientedBoundingBox::CreateFromPointIndices(
+                        points, indices, method);
+        ASSERT_EQ(obbs.size(), indices.size());
+        for (size_t c = 0; c < 2; c++) {
+            std::vector<Eigen::Vector3d> cluster;
+            for (size_t idx : indices[c]) {
+                cluster.push_back(points[idx]);
+            }
+            geometry::OrientedBoundingBox obb =
+                    geometry::OrientedBoundingBox::CreateFromPoints(cluster,
+                                                                    method);
+            ExpectEQ(obbs[c].center_, obb.center_);
+            ExpectEQ(obbs[c].extent_, obb.extent_);
+            ExpectEQ(obbs[c].R_, obb.R_);
+        }
+        // The planar cluster falls back to PCA.
+        ExpectEQ(obbs[2].center_, Eigen::Vector3d(5, 0.5, 0.5));
+        EXPECT_NEAR(obbs[2].Volume(), 0, 1e-12);
+        EXPECT_TRUE(obbs[3].IsEmpty());
+    }
+}
+
 TEST(PointCloud, Transform) {
     std::vector<Eigen::Vector3d> points = {
             {0, 0, 0},
@@ -991,6 +1087,28 @@ TEST(PointCloud, ComputeConvexHull) {
                                                              {7, 4, 6}}));
 }
 
+TEST(PointCloud, ComputeConvexHullParallel) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(100000);
+    Rand(pcd.points_, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1), 0);
+    for (auto &point : pcd.points_) {
+        point *= 1.0 / std::max(1.0, point.norm());
+    }
+
+    std::shared_ptr<geometry::TriangleMesh> mesh;
+    std::shared_ptr<geometry::TriangleMesh> mesh_parallel;
+    std::vector<size_t> pt_map;
+    std::vector<size_t> pt_map_parallel;
+    std::tie(mesh, pt_map) = pcd.ComputeConvexHull(false);
+    std::tie(mesh_parallel, pt_map_parallel) = pcd.ComputeConvexHull(true);
+    ExpectEQ(mesh_parallel->vertices_,
+             ApplyIndices(pcd.points_, pt_map_parallel));
+    EXPECT_EQ(mesh_parallel->triangles_.size(), mesh->triangles_.size());
+    std::sort(pt_map.begin(), pt_map.end());
+    std::sort(pt_map_parallel.begin(), pt_map_parallel.end());
+    EXPECT_EQ(pt_map_parallel, pt_map);
+}
+
 TEST(PointCloud, HiddenPointRemoval) {
     geometry::PointCloud pcd;
     io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.ply", pcd);
@@ -1007,6 +1125,62 @@ TEST(PointCloud, HiddenPointRemoval) {
     EXPECT_EQ(mesh->vertices_.size(), 24581);
 }
 
+TEST(PointCloud, HiddenPointRemovalMultipleViewpoints) {
+    geometry::PointCloud pcd;
+    io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.ply", pcd);
+    pcd = *pcd.UniformDownSample(20);
+
+    std::vector<Eigen::Vector3d> camera_locations = {
+            {0, 0, 5}, {5, 0, 0}, {2, 2, -3}};
+    std::vector<std::vector<size_t>> visible_indices =
+            pcd.HiddenPointRemoval(camera_locations, 500);
+    ASSERT_EQ(visible_indices.size(), camera_locations.size());
+    for (size_t i = 0; i < camera_locations.size(); i++) {
+        std::vector<size_t> pt_map;
+        std::tie(std::ignore, pt_map) =
+                pcd.HiddenPointRemoval(camera_locations[i], 500);
+        std::sort(pt_map.begin(), pt_map.end());
+        EXPECT_EQ(visible_indices[i], pt_map);
+    }
+}
+
+TEST(PointCloud, HiddenPointRemovalZBuffer) {
+    // Spheres of radius 2 and, for z > 0, of radius 1 around the origin,
+    // sampled along the same directions.
+    const int num_directions = 2000;
+    std::vector<Eigen::Vector3d> directions;
+    for (int i = 0; i < num_directions; i++) {
+        double z = 1 - (2 * i + 1) / double(num_directions);
+        double r = std::sqrt(1 - z * z);
+        double phi = i * M_PI * (3 - std::sqrt(5.0));
+        directions.push_back(
+                Eigen::Vector3d(r * std::cos(phi), r * std::sin(phi), z));
+    }
+    geometry::PointCloud pcd;
+    std::vector<size_t> expected;
+    for (const auto &direction : directions) {
+        if (direction(2) < 0) expected.push_back(pcd.points_.size());
+        pcd.points_.push_back(2 * direction);
+    }
+    for (const auto &direction : directions) {
+        if (direction(2) > 0) {
+            expected.push_back(pcd.points_.size());
+            pcd.points_.push_back(direction);
+        }
+    }
+
+    std::vector<std::vector<size_t>> visible_indices =
+            pcd.HiddenPointRemovalZBuffer({{0, 0, 0}, {0, 0, -1000}}, 16, 0.1);
+    ASSERT_EQ(visible_indices.size(), 2u);
+    // From the center, the inner half sphere hides the outer one.
+    EXPECT_EQ(visible_indices[0], expected);
+    // From far away, all the points fall into the same few cells and are
+    // within the depth tolerance.
+    EXPECT_EQ(visible_indices[1].size(), pcd.points_.size());
+
+    EXPECT_ANY_THROW(pcd.HiddenPointRemovalZBuffer({{0, 0, 0}}, 0));
+}
+
 TEST(PointCloud, ClusterDBSCAN) {
     geometry::PointCloud pcd;
     io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.ply", pcd);
@@ -1021,6 +1195,56 @@ TEST(PointCloud, ClusterDBSCAN) {
     EXPECT_EQ(cluster_sum, 398580);
 }
 
+TEST(PointCloud, ComputeClusterStatistics) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(40000);
+    Rand(pcd.points_, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1),
+         0);
+    // Label 2 has no points, and -1 is noise. Labels 0 and 1 have more than
+    // 10000 points each, so that they are reduced over several ranges.
+    std::vector<int> labels(pcd.points_.size());
+    for (size_t i = 0; i < labels.size(); i++) {
+        labels[i] = i % 7 == 0 ? -1 : (i % 5 == 2 ? 3 : int(i % 2));
+    }
+
+    geometry::ClusterStatistics stats = pcd.ComputeClusterStatistics(labels);
+    ASSERT_EQ(stats.counts_.size(), 4u);
+    ASSERT_EQ(stats.oriented_bounding_boxes_.size(), 4u);
+    EXPECT_EQ(stats.counts_[2], 0u);
+    EXPECT_TRUE(stats.axis_aligned_bounding_boxes_[2].IsEmpty());
+    EXPECT_TRUE(stats.oriented_bounding_boxes_[2].IsEmpty());
+    for (int label : {0, 1, 3}) {
+        std::vector<size_t> indices;
+        for (size_t i = 0; i < labels.size(); i++) {
+            if (labels[i] == label) indices.push_back(i);
+        }
+        auto cluster = pcd.SelectByIndex(indices);
+        Eigen::Vector3d mean;
+        Eigen::Matrix3d covariance;
+        std::tie(mean, covariance) = cluster->ComputeMeanAndCovariance();
+        auto aabb = cluster->GetAxisAlignedBoundingBox();
+        auto obb = geometry::OrientedBoundingBox::CreateFromPoints(
+                cluster->points_,
+                geometry::OrientedBoundingBox::CreationMethod::PCA);
+
+        if (label != 3) {
+            EXPECT_GT(indices.size(), 10000u);
+        }
+        EXPECT_EQ(stats.counts_[label], indices.size());
+        ExpectEQ(stats.centroids_[label], mean);
+        ExpectEQ(stats.covariances_[label], covariance);
+        ExpectEQ(stats.axis_aligned_bounding_boxes_[label].min_bound_,
+                 aabb.min_bound_);
+        ExpectEQ(stats.axis_aligned_bounding_boxes_[label].max_bound_,
+                 aabb.max_bound_);
+        ExpectEQ(stats.oriented_bounding_boxes_[label].center_, obb.center_);
+        ExpectEQ(stats.oriented_bounding_boxes_[label].extent_, obb.extent_);
+        ExpectEQ(stats.oriented_bounding_boxes_[label].R_, obb.R_);
+    }
+
+    EXPECT_ANY_THROW(pcd.ComputeClusterStatistics(std::vector<int>(3, 0)));
+}
+
 TEST(PointCloud, SegmentPlane) {
     geometry::PointCloud pcd;
     io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.pcd", pcd);
@@ -26,8 +26,12 @@
 
 #include "open3d/geometry/TriangleMesh.h"
 
+#include <limits>
+
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/Qhull.h"
+#include "open3d/geometry/TetraMesh.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -1915,6 +1919,43 @@ TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     ExpectMeshEQ(*mesh_es, mesh_gt);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudAlphaShapes) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(200);
+    Rand(pcd.points_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1), 0);
+    pcd.colors_.resize(200);
+    Rand(pcd.colors_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1), 1);
+
+    std::shared_ptr<geometry::TetraMesh> tetra_mesh;
+    std::vector<size_t> pt_map;
+    std::tie(tetra_mesh, pt_map) =
+            geometry::Qhull::ComputeDelaunayTetrahedralization(pcd.points_);
+
+    const std::vector<double> alphas = {
+            0.3, 0.05, 10, 0.1, std::numeric_limits<double>::infinity()};
+    auto meshes = geometry::TriangleMesh::CreateFromPointCloudAlphaShape(
+            pcd, alphas, tetra_mesh, &pt_map);
+    ASSERT_EQ(meshes.size(), alphas.size());
+    for (size_t idx = 0; idx < alphas.size(); ++idx) {
+        auto mesh_gt = geometry::TriangleMesh::CreateFromPointCloudAlphaShape(
+                pcd, alphas[idx], tetra_mesh, &pt_map);
+        ExpectEQ(meshes[idx]->vertices_, mesh_gt->vertices_);
+        ExpectEQ(meshes[idx]->vertex_colors_, mesh_gt->vertex_colors_);
+        std::vector<Eigen::Vector3i> triangles = meshes[idx]->triangles_;
+        std::vector<Eigen::Vector3i> triangles_gt = mesh_gt->triangles_;
+        auto triangle_less = [](const Eigen::Vector3i &t0,
+                                const Eigen::Vector3i &t1) {
+            return std::lexicographical_compare(t0.data(), t0.data() + 3,
+                                                t1.data(), t1.data() + 3);
+        };
+        std::sort(triangles.begin(), triangles.end(), triangle_less);
+        std::sort(triangles_gt.begin(), triangles_gt.end(), triangle_less);
+        ExpectEQ(triangles, triangles_gt);
+    }
+    EXPECT_GT(meshes[2]->triangles_.size(), 0);
+    EXPECT_GT(meshes[4]->triangles_.size(), 0);
+}
+
 TEST(TriangleMesh, CreateMeshSphere) {
     std::vector<Eigen::Vector3d> ref_vertices = {
             {0.000000, 0.000000, 1.000000},
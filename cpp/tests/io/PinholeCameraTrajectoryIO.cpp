@@ -24,6 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+
+#include <cstdio>
+
+#include "open3d/camera/PinholeCameraTrajectory.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -50,5 +55,45 @@ TEST(PinholeCameraTrajectoryIO, DISABLED_WritePinholeCameraTrajectoryToLOG) {
     NotImplemented();
 }
 
+TEST(PinholeCameraTrajectoryIO, ReadWritePinholeCameraTrajectoryBIN) {
+    std::string file_name =
+            std::string(TEST_DATA_DIR) + "/temp_camera_trajectory.bin";
+    std::remove(file_name.c_str());
+    camera::PinholeCameraTrajectory src;
+    for (int i = 0; i < 100; i++) {
+        camera::PinholeCameraParameters parameters;
+        parameters.intrinsic_ = camera::PinholeCameraIntrinsic(
+                camera::PinholeCameraIntrinsicParameters::
+                        PrimeSenseDefault);
+        parameters.extrinsic_ = Eigen::Matrix4d::Identity();
+        parameters.extrinsic_.block<3, 1>(0, 3) = Eigen::Vector3d(i, -i, 0.5);
+        src.parameters_.push_back(parameters);
+    }
+
+    camera::PinholeCameraTrajectory dst;
+    EXPECT_TRUE(io::WritePinholeCameraTrajectory(file_name, src));
+    EXPECT_TRUE(io::ReadPinholeCameraTrajectory(file_name, dst));
+    ASSERT_EQ(src.parameters_.size(), dst.parameters_.size());
+
+    // Appending the tail after the first half reproduces the trajectory.
+    camera::PinholeCameraTrajectory half;
+    half.parameters_.assign(src.parameters_.begin(),
+                            src.parameters_.begin() + 50);
+    EXPECT_TRUE(io::WritePinholeCameraTrajectoryToBIN(file_name, half));
+    EXPECT_TRUE(io::AppendPinholeCameraTrajectoryToBIN(file_name, src, 50));
+    EXPECT_TRUE(io::ReadPinholeCameraTrajectoryFromBIN(file_name, dst));
+    ASSERT_EQ(src.parameters_.size(), dst.parameters_.size());
+    for (size_t i = 0; i < src.parameters_.size(); i++) {
+        const auto &p0 = src.parameters_[i];
+        const auto &p1 = dst.parameters_[i];
+        EXPECT_EQ(p0.intrinsic_.width_, p1.intrinsic_.width_);
+        EXPECT_EQ(p0.intrinsic_.height_, p1.intrinsic_.height_);
+        ExpectEQ(p0.intrinsic_.intrinsic_matrix_,
+                 p1.intrinsic_.intrinsic_matrix_);
+        ExpectEQ(p0.extrinsic_, p1.extrinsic_);
+    }
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -24,6 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/io/PoseGraphIO.h"
+
+#include <cstdio>
+#include <vector>
+
+#include "open3d/pipelines/registration/PoseGraph.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -35,5 +41,119 @@ TEST(PoseGraphIO, DISABLED_ReadPoseGraph) { NotImplemented(); }
 
 TEST(PoseGraphIO, DISABLED_WritePoseGraph) { NotImplemented(); }
 
+static pipelines::registration::PoseGraph CreateTestPoseGraph(int num_nodes) {
+    pipelines::registration::PoseGraph pose_graph;
+    for (int i = 0; i < num_nodes; i++) {
+        Eigen::Matrix4d pose = Eigen::Matrix4d::Identity();
+        pose.block<3, 1>(0, 3) = Eigen::Vector3d(i, 0.5 * i, -0.25 * i);
+        pose_graph.nodes_.push_back(
+                pipelines::registration::PoseGraphNode(pose));
+    }
+    for (int i = 0; i + 1 < num_nodes; i++) {
+        Eigen::Matrix6d information = Eigen::Matrix6d::Identity() * (i + 1);
+        information(0, 5) = information(5, 0) = 0.5;
+        pose_graph.edges_.push_back(pipelines::registration::PoseGraphEdge(
+                i, i + 1, pose_graph.nodes_[i].pose_, information, i % 2 == 0,
+                0.1 * i));
+    }
+    return pose_graph;
+}
+
+static void ExpectPoseGraphEQ(
+        const pipelines::registration::PoseGraph &pose_graph0,
+        const pipelines::registration::PoseGraph &pose_graph1,
+        double information_tolerance = 0.0) {
+    ASSERT_EQ(pose_graph0.nodes_.size(), pose_graph1.nodes_.size());
+    ASSERT_EQ(pose_graph0.edges_.size(), pose_graph1.edges_.size());
+    for (size_t i = 0; i < pose_graph0.nodes_.size(); i++) {
+        ExpectEQ(pose_graph0.nodes_[i].pose_, pose_graph1.nodes_[i].pose_);
+    }
+    for (size_t i = 0; i < pose_graph0.edges_.size(); i++) {
+        const auto &edge0 = pose_graph0.edges_[i];
+        const auto &edge1 = pose_graph1.edges_[i];
+        EXPECT_EQ(edge0.source_node_id_, edge1.source_node_id_);
+        EXPECT_EQ(edge0.target_node_id_, edge1.target_node_id_);
+        EXPECT_EQ(edge0.uncertain_, edge1.uncertain_);
+        EXPECT_EQ(edge0.confidence_, edge1.confidence_);
+        ExpectEQ(edge0.transformation_, edge1.transformation_);
+        ExpectEQ(edge0.information_, edge1.information_,
+                 information_tolerance);
+    }
+}
+
+TEST(PoseGraphIO, ReadWritePoseGraphBIN) {
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_pose_graph.bin";
+    pipelines::registration::PoseGraph src = CreateTestPoseGraph(5000);
+
+    pipelines::registration::PoseGraph dst;
+    EXPECT_TRUE(io::WritePoseGraph(file_name, src));
+    EXPECT_TRUE(io::ReadPoseGraph(file_name, dst));
+    ExpectPoseGraphEQ(src, dst);
+
+    EXPECT_TRUE(io::WritePoseGraphToBIN(file_name, src, true));
+    EXPECT_TRUE(io::ReadPoseGraphFromBIN(file_name, dst));
+    ExpectPoseGraphEQ(src, dst, 1e-6);
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+}
+
+TEST(PoseGraphIO, AppendPoseGraphToBIN) {
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_pose_graph.bin";
+    std::remove(file_name.c_str());
+    pipelines::registration::PoseGraph src = CreateTestPoseGraph(10);
+
+    // Append the pose graph as it grows, as done during reconstruction.
+    pipelines::registration::PoseGraph partial;
+    size_t num_nodes = 0, num_edges = 0;
+    for (size_t i = 0; i < src.nodes_.size(); i += 3) {
+        for (size_t j = i; j < std::min(i + 3, src.nodes_.size()); j++) {
+            partial.nodes_.push_back(src.nodes_[j]);
+            if (j > 0) partial.edges_.push_back(src.edges_[j - 1]);
+        }
+        EXPECT_TRUE(io::AppendPoseGraphToBIN(file_name, partial, num_nodes,
+                                             num_edges));
+        num_nodes = partial.nodes_.size();
+        num_edges = partial.edges_.size();
+    }
+
+    pipelines::registration::PoseGraph dst;
+    EXPECT_TRUE(io::ReadPoseGraphFromBIN(file_name, dst));
+    ExpectPoseGraphEQ(src, dst);
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+}
+
+TEST(PoseGraphIO, ReadTruncatedPoseGraphBIN) {
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_pose_graph.bin";
+    pipelines::registration::PoseGraph src = CreateTestPoseGraph(10);
+    EXPECT_TRUE(io::WritePoseGraphToBIN(file_name, src));
+
+    // Drop the end of the trailing edge block, as an interrupted append would.
+    std::vector<char> bytes;
+    FILE *fid = std::fopen(file_name.c_str(), "rb");
+    ASSERT_NE(fid, nullptr);
+    char c;
+    while (std::fread(&c, 1, 1, fid) == 1) bytes.push_back(c);
+    std::fclose(fid);
+    fid = std::fopen(file_name.c_str(), "wb");
+    ASSERT_NE(fid, nullptr);
+    std::fwrite(bytes.data(), 1, bytes.size() - 100, fid);
+    std::fclose(fid);
+
+    pipelines::registration::PoseGraph dst;
+    EXPECT_TRUE(io::ReadPoseGraphFromBIN(file_name, dst));
+    src.edges_.clear();
+    ExpectPoseGraphEQ(src, dst);
+
+    // A corrupted record count in the first block cannot come from an
+    // interrupted append, and must fail the read rather than drop the file.
+    fid = std::fopen(file_name.c_str(), "r+b");
+    ASSERT_NE(fid, nullptr);
+    const uint32_t count = 0xffffffff;
+    std::fseek(fid, 8 + 4 + 4, SEEK_SET);
+    std::fwrite(&count, sizeof(uint32_t), 1, fid);
+    std::fclose(fid);
+    EXPECT_FALSE(io::ReadPoseGraphFromBIN(file_name, dst));
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/io/TriangleMeshIO.h"
 #include "tests/UnitTest.h"
@@ -46,5 +48,60 @@ TEST(FileSTL, WriteReadTriangleMeshFromSTL) {
     ExpectEQ(tm_gt.triangles_, tm_test.triangles_);
 }
 
+TEST(FileSTL, WriteReadTriangleMeshFromSTLWelded) {
+    geometry::TriangleMesh tm_gt;
+    tm_gt.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+    tm_gt.triangles_ = {{0, 2, 1}, {0, 1, 3}, {0, 3, 2}, {1, 2, 3}};
+    tm_gt.ComputeTriangleNormals();
+
+    for (bool write_ascii : {false, true}) {
+        std::string file_name =
+                std::string(TEST_DATA_DIR) + "/temp_tetrahedron.stl";
+        EXPECT_TRUE(io::WriteTriangleMesh(file_name, tm_gt, write_ascii));
+
+        geometry::TriangleMesh tm_test;
+        EXPECT_TRUE(io::ReadTriangleMesh(file_name, tm_test, false));
+        EXPECT_EQ(tm_test.vertices_.size(), 12);
+        ExpectEQ(tm_test.triangle_normals_, tm_gt.triangle_normals_, 1e-6);
+
+        // Welding restores the shared vertices in the order of their first
+        // use.
+        EXPECT_TRUE(io::ReadTriangleMesh(file_name, tm_test, true));
+        ExpectEQ(tm_test.vertices_, std::vector<Eigen::Vector3d>{{0, 0, 0},
+                                                                 {0, 1, 0},
+                                                                 {1, 0, 0},
+                                                                 {0, 0, 1}});
+        ExpectEQ(tm_test.triangles_, std::vector<Eigen::Vector3i>{{0, 1, 2},
+                                                                  {0, 2, 3},
+                                                                  {0, 3, 1},
+                                                                  {2, 1, 3}});
+        ExpectEQ(tm_test.triangle_normals_, tm_gt.triangle_normals_, 1e-6);
+        EXPECT_EQ(std::remove(file_name.c_str()), 0);
+    }
+}
+
+TEST(FileSTL, ReadPaddedBinarySTL) {
+    geometry::TriangleMesh tm_gt;
+    tm_gt.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+    tm_gt.triangles_ = {{0, 2, 1}, {0, 1, 3}, {0, 3, 2}, {1, 2, 3}};
+    tm_gt.ComputeTriangleNormals();
+
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_padded.stl";
+    EXPECT_TRUE(io::WriteTriangleMesh(file_name, tm_gt, false));
+    FILE *file = std::fopen(file_name.c_str(), "ab");
+    ASSERT_NE(file, nullptr);
+    const char padding[16] = {0};
+    EXPECT_EQ(std::fwrite(padding, 1, sizeof(padding), file), sizeof(padding));
+    std::fclose(file);
+
+    // Bytes after the last record are ignored.
+    geometry::TriangleMesh tm_test;
+    EXPECT_TRUE(io::ReadTriangleMesh(file_name, tm_test, true));
+    EXPECT_EQ(tm_test.vertices_.size(), 4);
+    EXPECT_EQ(tm_test.triangles_.size(), 4);
+    ExpectEQ(tm_test.triangle_normals_, tm_gt.triangle_normals_, 1e-6);
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -24,6 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/FastGlobalRegistration.h"
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/pipelines/registration/Registration.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -39,5 +44,41 @@ TEST(FastGlobalRegistration, DISABLED_Constructor) { NotImplemented(); }
 
 TEST(FastGlobalRegistration, DISABLED_MemberData) { NotImplemented(); }
 
+// Source is target moved by the inverse of a known transformation, with
+// distinct random features shared by corresponding points, so that the
+// registration has to recover that transformation.
+void ExpectRecoveredTransformation(int feature_search_checks) {
+    geometry::PointCloud target;
+    target.points_.resize(1000);
+    Rand(target.points_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1),
+         0);
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.6, Eigen::Vector3d(1, 2, 3).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.3, -0.2, 0.5);
+    geometry::PointCloud source = target;
+    source.Transform(transformation.inverse());
+
+    pipelines::registration::Feature target_feature;
+    target_feature.Resize(33, int(target.points_.size()));
+    Rand(target_feature.data_.data(), target_feature.data_.size(), 0, 100, 1);
+    pipelines::registration::Feature source_feature = target_feature;
+
+    pipelines::registration::FastGlobalRegistrationOption option;
+    option.feature_search_checks_ = feature_search_checks;
+    auto result = pipelines::registration::FastGlobalRegistration(
+            source, target, source_feature, target_feature, option);
+    ExpectEQ(Eigen::Matrix4d(result.transformation_), transformation, 1e-4);
+}
+
+TEST(FastGlobalRegistration, RecoverTransformationExactSearch) {
+    ExpectRecoveredTransformation(-1);
+}
+
+TEST(FastGlobalRegistration, RecoverTransformationApproximateSearch) {
+    ExpectRecoveredTransformation(64);
+}
+
 }  // namespace tests
 }  // namespace open3d
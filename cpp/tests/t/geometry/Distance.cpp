@@ -0,0 +1,69 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/Distance.h"
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class DistancePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Distance,
+                         DistancePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(DistancePermuteDevices, ComputeDistances) {
+    core::Device device = GetParam();
+    t::geometry::PointCloud source(core::Tensor::Init<float>(
+            {{0.25, 0.25, 0.5}, {2, 0.5, 0}, {0.5, 0.5, 3}}, device));
+    t::geometry::PointCloud target(
+            core::Tensor::Init<float>({{0.25, 0.25, 0}, {1, 0.5, 0}}, device));
+    t::geometry::TriangleMesh mesh(
+            core::Tensor::Init<float>(
+                    {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}}, device),
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {2, 1, 3}}, device));
+
+    core::Tensor distances =
+            t::geometry::distance::ComputePointCloudDistance(source, target);
+    EXPECT_EQ(distances.GetDevice(), device);
+    EXPECT_TRUE(distances.AllClose(core::Tensor::Init<double>(
+            {0.5, 1, std::sqrt(0.125 + 9)}, device)));
+
+    distances = t::geometry::distance::ComputeTriangleMeshDistance(source, mesh,
+                                                                   2.0);
+    EXPECT_TRUE(distances.AllClose(
+            core::Tensor::Init<double>({0.5, 1, 2}, device)));
+
+    open3d::geometry::DistanceSummary summary =
+            t::geometry::distance::ComputeDistanceSummary(source, mesh);
+    EXPECT_NEAR(summary.hausdorff_distance_, 3.0, 1e-6);
+}
+
+}  // namespace tests
+}  // namespace open3d
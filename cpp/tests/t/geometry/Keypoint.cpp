@@ -0,0 +1,92 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/Keypoint.h"
+
+#include <numeric>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/Keypoint.h"
+#include "open3d/geometry/PointCloud.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class KeypointPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Keypoint,
+                         KeypointPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(KeypointPermuteDevices, ComputeISSKeypoints) {
+    core::Device device = GetParam();
+
+    // Points on a grid over three faces of the unit box.
+    std::vector<float> points;
+    const int resolution = 30;
+    for (int axis = 0; axis < 3; axis++) {
+        for (int u = 0; u <= resolution; u++) {
+            for (int v = 0; v <= resolution; v++) {
+                float point[3];
+                point[axis] = 0;
+                point[(axis + 1) % 3] = float(u) / resolution;
+                point[(axis + 2) % 3] = float(v) / resolution;
+                points.insert(points.end(), point, point + 3);
+            }
+        }
+    }
+    const int64_t n = points.size() / 3;
+    std::vector<int64_t> labels(n);
+    std::iota(labels.begin(), labels.end(), 0);
+
+    t::geometry::PointCloud pcd(core::Tensor(points, {n, 3},
+                                             core::Dtype::Float32, device));
+    pcd.SetPointAttr("labels",
+                     core::Tensor(labels, {n}, core::Dtype::Int64, device));
+
+    t::geometry::PointCloud keypoints =
+            t::geometry::keypoint::ComputeISSKeypoints(pcd, 0.12, 0.1);
+    EXPECT_EQ(keypoints.GetDevice(), device);
+    EXPECT_TRUE(keypoints.HasPointAttr("labels"));
+
+    // Same keypoints as the legacy point cloud, with their attributes.
+    std::vector<size_t> indices = geometry::keypoint::ComputeISSKeypointIndices(
+            pcd.ToLegacyPointCloud(), 0.12, 0.1);
+    std::vector<int64_t> kp_labels =
+            keypoints.GetPointAttr("labels").ToFlatVector<int64_t>();
+    EXPECT_FALSE(kp_labels.empty());
+    EXPECT_EQ(kp_labels, std::vector<int64_t>(indices.begin(), indices.end()));
+    EXPECT_TRUE(keypoints.GetPoints().AllClose(
+            pcd.GetPoints().IndexGet({keypoints.GetPointAttr("labels")})));
+
+    EXPECT_TRUE(t::geometry::keypoint::ComputeISSKeypoints(
+                        t::geometry::PointCloud(device))
+                        .IsEmpty());
+}
+
+}  // namespace tests
+}  // namespace open3d
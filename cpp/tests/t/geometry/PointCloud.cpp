@@ -389,5 +389,39 @@ TEST_P(PointCloudPermuteDevices, Has) {
     EXPECT_TRUE(pcd.HasPointColors());
 }
 
+TEST_P(PointCloudPermuteDevices, ComputeClusterStatistics) {
+    core::Device device = GetParam();
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>({{0, 0, 0},
+                                                           {2, 0, 0},
+                                                           {0, 4, 0},
+                                                           {2, 4, 0},
+                                                           {5, 5, 5},
+                                                           {9, 9, 9}},
+                                                          device));
+    core::Tensor labels =
+            core::Tensor::Init<int64_t>({0, 0, 0, 0, 1, -1}, device);
+
+    std::unordered_map<std::string, core::Tensor> stats =
+            pcd.ComputeClusterStatistics(labels);
+    EXPECT_TRUE(stats.at("counts").AllClose(
+            core::Tensor::Init<int64_t>({4, 1}, device)));
+    EXPECT_TRUE(stats.at("centroids").AllClose(
+            core::Tensor::Init<double>({{1, 2, 0}, {5, 5, 5}}, device)));
+    EXPECT_TRUE(stats.at("min_bounds").AllClose(
+            core::Tensor::Init<double>({{0, 0, 0}, {5, 5, 5}}, device)));
+    EXPECT_TRUE(stats.at("max_bounds").AllClose(
+            core::Tensor::Init<double>({{2, 4, 0}, {5, 5, 5}}, device)));
+    EXPECT_TRUE(stats.at("obb_centers").AllClose(
+            core::Tensor::Init<double>({{1, 2, 0}, {5, 5, 5}}, device)));
+    EXPECT_TRUE(stats.at("obb_extents").AllClose(
+            core::Tensor::Init<double>({{4, 2, 0}, {0, 0, 0}}, device)));
+    EXPECT_EQ(stats.at("covariances").GetShape(),
+              core::SizeVector({2, 3, 3}));
+    EXPECT_EQ(stats.at("obb_rotations").GetDevice(), device);
+
+    EXPECT_ANY_THROW(pcd.ComputeClusterStatistics(
+            core::Tensor::Init<int64_t>({0, 0}, device)));
+}
+
 }  // namespace tests
 }  // namespace open3d
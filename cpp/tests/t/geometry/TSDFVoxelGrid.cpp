@@ -26,6 +26,13 @@
 
 #include "open3d/t/geometry/TSDFVoxelGrid.h"
 
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <set>
+#include <tuple>
+
 #include "core/CoreTest.h"
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/Tensor.h"
@@ -33,6 +40,7 @@
 #include "open3d/io/PinholeCameraTrajectoryIO.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/pipelines/registration/Registration.h"
+#include "open3d/t/geometry/kernel/TSDFVoxelGrid.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -43,21 +51,23 @@ INSTANTIATE_TEST_SUITE_P(TSDFVoxelGrid,
                          TSDFVoxelGridPermuteDevices,
                          testing::ValuesIn(PermuteDevices::TestCases()));
 
-TEST_P(TSDFVoxelGridPermuteDevices, Integrate) {
-    core::Device device = GetParam();
+// Frames of the RGBD test sequence with the PrimeSense intrinsics.
+struct RGBDSequence {
+    core::Tensor intrinsic_;
+    std::vector<t::geometry::Image> depths_;
+    std::vector<t::geometry::Image> colors_;
+    std::vector<core::Tensor> extrinsics_;
+};
 
-    float voxel_size = 0.008;
-    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
-                                           {"weight", core::Dtype::UInt16},
-                                           {"color", core::Dtype::UInt16}},
-                                          voxel_size, 0.04f, 16, 1000, device);
+static RGBDSequence LoadRGBDSequence(const core::Device& device) {
+    RGBDSequence sequence;
 
     // Intrinsics
     camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
             camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
     auto focal_length = intrinsic.GetFocalLength();
     auto principal_point = intrinsic.GetPrincipalPoint();
-    core::Tensor intrinsic_t = core::Tensor(
+    sequence.intrinsic_ = core::Tensor(
             std::vector<float>({static_cast<float>(focal_length.first), 0,
                                 static_cast<float>(principal_point.first), 0,
                                 static_cast<float>(focal_length.second),
@@ -76,24 +86,140 @@ TEST_P(TSDFVoxelGridPermuteDevices, Integrate) {
         std::shared_ptr<geometry::Image> depth_legacy = io::CreateImageFromFile(
                 fmt::format("{}/RGBD/depth/{:05d}.png",
                             std::string(TEST_DATA_DIR), i));
-
         std::shared_ptr<geometry::Image> color_legacy = io::CreateImageFromFile(
                 fmt::format("{}/RGBD/color/{:05d}.jpg",
                             std::string(TEST_DATA_DIR), i));
 
-        t::geometry::Image depth =
-                t::geometry::Image::FromLegacyImage(*depth_legacy, device);
-        t::geometry::Image color =
-                t::geometry::Image::FromLegacyImage(*color_legacy, device);
+        sequence.depths_.push_back(
+                t::geometry::Image::FromLegacyImage(*depth_legacy, device));
+        sequence.colors_.push_back(
+                t::geometry::Image::FromLegacyImage(*color_legacy, device));
 
         Eigen::Matrix4f extrinsic =
                 trajectory->parameters_[i].extrinsic_.cast<float>();
-        core::Tensor extrinsic_t =
+        sequence.extrinsics_.push_back(
                 core::eigen_converter::EigenMatrixToTensor(extrinsic).To(
-                        device);
+                        device));
+    }
+    return sequence;
+}
 
-        voxel_grid.Integrate(depth, color, intrinsic_t, extrinsic_t);
+// Integrates the frames of \p sequence one by one.
+static void IntegrateRGBDSequence(t::geometry::TSDFVoxelGrid& voxel_grid,
+                                  const RGBDSequence& sequence) {
+    for (size_t i = 0; i < sequence.depths_.size(); ++i) {
+        voxel_grid.Integrate(sequence.depths_[i], sequence.colors_[i],
+                             sequence.intrinsic_, sequence.extrinsics_[i]);
     }
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, Constructor) {
+    core::Device device = GetParam();
+    using AttrDtypeMap = std::unordered_map<std::string, core::Dtype>;
+
+    // Supported voxel layouts.
+    std::vector<AttrDtypeMap> layouts = {
+            {{"tsdf", core::Dtype::Float32}, {"weight", core::Dtype::Float32}},
+            {{"tsdf", core::Dtype::UInt16}, {"weight", core::Dtype::UInt16}},
+            {{"tsdf", core::Dtype::Float32},
+             {"weight", core::Dtype::Float32},
+             {"color", core::Dtype::Float32}},
+            {{"tsdf", core::Dtype::Float32},
+             {"weight", core::Dtype::UInt16},
+             {"color", core::Dtype::UInt16}},
+            {{"tsdf", core::Dtype::UInt16},
+             {"weight", core::Dtype::UInt8},
+             {"color", core::Dtype::UInt8}}};
+    for (const AttrDtypeMap& layout : layouts) {
+        EXPECT_NO_THROW(t::geometry::TSDFVoxelGrid(layout, 0.008f, 0.04f, 16,
+                                                   10, device));
+    }
+
+    // Missing attributes and unsupported dtype combinations.
+    EXPECT_ANY_THROW(t::geometry::TSDFVoxelGrid(
+            {{"tsdf", core::Dtype::Float32}}, 0.008f, 0.04f, 16, 10, device));
+    EXPECT_ANY_THROW(t::geometry::TSDFVoxelGrid(
+            {{"tsdf", core::Dtype::Float32}, {"weight", core::Dtype::UInt16}},
+            0.008f, 0.04f, 16, 10, device));
+    EXPECT_ANY_THROW(t::geometry::TSDFVoxelGrid(
+            {{"tsdf", core::Dtype::UInt16},
+             {"weight", core::Dtype::UInt8},
+             {"color", core::Dtype::Float32}},
+            0.008f, 0.04f, 16, 10, device));
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, Touch) {
+    core::Device device = GetParam();
+
+    // Slanted plane with a few holes, observed by a small camera.
+    const int64_t width = 64, height = 48;
+    std::vector<uint16_t> depth_data(width * height);
+    for (int64_t v = 0; v < height; ++v) {
+        for (int64_t u = 0; u < width; ++u) {
+            depth_data[v * width + u] =
+                    u % 7 == 0 ? 0 : static_cast<uint16_t>(800 + 5 * u + 3 * v);
+        }
+    }
+    t::geometry::Image depth(
+            core::Tensor(depth_data, {height, width, 1}, core::Dtype::UInt16,
+                         device));
+    core::Tensor intrinsic =
+            core::Tensor(std::vector<float>({50, 0, 32, 0, 50, 24, 0, 0, 1}),
+                         {3, 3}, core::Dtype::Float32);
+    core::Tensor points = t::geometry::PointCloud::CreateFromDepthImage(
+                                  depth, intrinsic)
+                                  .GetPoints()
+                                  .Contiguous();
+
+    const int64_t resolution = 16;
+    const float voxel_size = 0.008f, sdf_trunc = 0.04f;
+    core::Tensor block_coords;
+    t::geometry::kernel::tsdf::Touch(points, block_coords, resolution,
+                                     voxel_size, sdf_trunc);
+    EXPECT_EQ(block_coords.GetDevice(), device);
+    std::vector<int> coords =
+            block_coords.To(core::Device("CPU:0")).ToFlatVector<int>();
+    std::set<std::tuple<int, int, int>> touched;
+    for (size_t i = 0; i < coords.size(); i += 3) {
+        touched.emplace(coords[i], coords[i + 1], coords[i + 2]);
+    }
+    EXPECT_EQ(touched.size(), coords.size() / 3);
+
+    // Brute force: blocks overlapping the cube of half size sdf_trunc around
+    // each point.
+    const float block_size = voxel_size * resolution;
+    std::vector<float> points_data =
+            points.To(core::Device("CPU:0")).ToFlatVector<float>();
+    std::set<std::tuple<int, int, int>> expected;
+    for (size_t i = 0; i < points_data.size(); i += 3) {
+        int lo[3], hi[3];
+        for (int k = 0; k < 3; ++k) {
+            lo[k] = static_cast<int>(
+                    std::floor((points_data[i + k] - sdf_trunc) / block_size));
+            hi[k] = static_cast<int>(
+                    std::floor((points_data[i + k] + sdf_trunc) / block_size));
+        }
+        for (int xb = lo[0]; xb <= hi[0]; ++xb) {
+            for (int yb = lo[1]; yb <= hi[1]; ++yb) {
+                for (int zb = lo[2]; zb <= hi[2]; ++zb) {
+                    expected.emplace(xb, yb, zb);
+                }
+            }
+        }
+    }
+    EXPECT_GT(expected.size(), 1u);
+    EXPECT_EQ(touched, expected);
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, Integrate) {
+    core::Device device = GetParam();
+
+    float voxel_size = 0.008;
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          voxel_size, 0.04f, 16, 1000, device);
+    IntegrateRGBDSequence(voxel_grid, LoadRGBDSequence(device));
 
     auto pcd = voxel_grid.ExtractSurfacePoints().ToLegacyPointCloud();
     auto pcd_gt = *io::CreatePointCloudFromFile(std::string(TEST_DATA_DIR) +
@@ -107,5 +233,206 @@ TEST_P(TSDFVoxelGridPermuteDevices, Integrate) {
     EXPECT_NEAR(result.fitness_, 1.0, 1e-5);
     EXPECT_NEAR(result.inlier_rmse_, 0, 1e-5);
 }
+
+TEST_P(TSDFVoxelGridPermuteDevices, IntegrateQuantized) {
+    core::Device device = GetParam();
+    using AttrDtypeMap = std::unordered_map<std::string, core::Dtype>;
+
+    float voxel_size = 0.008;
+    RGBDSequence sequence = LoadRGBDSequence(device);
+    auto extract = [&](const AttrDtypeMap& layout) {
+        t::geometry::TSDFVoxelGrid voxel_grid(layout, voxel_size, 0.04f, 16,
+                                              1000, device);
+        IntegrateRGBDSequence(voxel_grid, sequence);
+        return voxel_grid.ExtractSurfacePoints();
+    };
+
+    // Quantized layouts against the Float32 layouts with the same
+    // attributes. The quantized TSDF has a step of 1 / kTSDFFactor in [-1, 1],
+    // so surface points move by a small fraction of a voxel, and colors are
+    // rounded to 8 bits.
+    std::vector<std::pair<AttrDtypeMap, AttrDtypeMap>> layouts = {
+            {{{"tsdf", core::Dtype::UInt16}, {"weight", core::Dtype::UInt16}},
+             {{"tsdf", core::Dtype::Float32},
+              {"weight", core::Dtype::Float32}}},
+            {{{"tsdf", core::Dtype::UInt16},
+              {"weight", core::Dtype::UInt8},
+              {"color", core::Dtype::UInt8}},
+             {{"tsdf", core::Dtype::Float32},
+              {"weight", core::Dtype::Float32},
+              {"color", core::Dtype::Float32}}}};
+    for (const auto& layout : layouts) {
+        t::geometry::PointCloud pcd = extract(layout.first);
+        t::geometry::PointCloud pcd_ref = extract(layout.second);
+
+        auto result = pipelines::registration::EvaluateRegistration(
+                pcd.ToLegacyPointCloud(), pcd_ref.ToLegacyPointCloud(),
+                0.1 * voxel_size);
+        EXPECT_NEAR(result.fitness_, 1.0, 1e-3);
+        EXPECT_LT(result.inlier_rmse_, 0.01 * voxel_size);
+
+        if (layout.first.count("color") != 0) {
+            core::Tensor mean_color = pcd.GetPointColors().Mean({0});
+            core::Tensor mean_color_ref = pcd_ref.GetPointColors().Mean({0});
+            EXPECT_TRUE(mean_color.AllClose(mean_color_ref, 0, 1.0 / 255));
+        }
+    }
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, IntegrateBatch) {
+    core::Device device = GetParam();
+
+    float voxel_size = 0.008;
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          voxel_size, 0.04f, 16, 1000, device);
+    RGBDSequence sequence = LoadRGBDSequence(device);
+
+    voxel_grid.IntegrateBatch(sequence.depths_, sequence.colors_,
+                              sequence.intrinsic_, sequence.extrinsics_);
+
+    // Frames also update blocks allocated by the other frames in the batch,
+    // so the result is close to, but not identical with sequential
+    // integration.
+    auto pcd = voxel_grid.ExtractSurfacePoints().ToLegacyPointCloud();
+    auto pcd_gt = *io::CreatePointCloudFromFile(std::string(TEST_DATA_DIR) +
+                                                "/RGBD/example_tsdf_pcd.ply");
+    auto result = pipelines::registration::EvaluateRegistration(pcd, pcd_gt,
+                                                                voxel_size);
+    EXPECT_NEAR(result.fitness_, 1.0, 1e-2);
+    EXPECT_LT(result.inlier_rmse_, 1e-3);
+
+    // Mismatched inputs.
+    EXPECT_ANY_THROW(voxel_grid.IntegrateBatch(
+            sequence.depths_, sequence.colors_, sequence.intrinsic_,
+            std::vector<core::Tensor>(sequence.extrinsics_.begin() + 1,
+                                      sequence.extrinsics_.end())));
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, SaveLoad) {
+    core::Device device = GetParam();
+    const std::string file_name =
+            std::string(TEST_DATA_DIR) + "/temp_voxel_grid.tsdf";
+
+    float voxel_size = 0.008;
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          voxel_size, 0.04f, 16, 1000, device);
+    IntegrateRGBDSequence(voxel_grid, LoadRGBDSequence(device));
+
+    voxel_grid.Save(file_name);
+    t::geometry::TSDFVoxelGrid voxel_grid_load =
+            t::geometry::TSDFVoxelGrid::Load(file_name, device);
+    EXPECT_EQ(voxel_grid_load.GetDevice(), device);
+
+    // Block order may change after re-insertion, so compare statistics of
+    // the extracted surfaces.
+    t::geometry::PointCloud pcd = voxel_grid.ExtractSurfacePoints();
+    t::geometry::PointCloud pcd_load = voxel_grid_load.ExtractSurfacePoints();
+    EXPECT_EQ(pcd.GetPoints().GetLength(), pcd_load.GetPoints().GetLength());
+    EXPECT_TRUE(pcd.GetPoints().Sum({0}).AllClose(
+            pcd_load.GetPoints().Sum({0}), 1e-5, 1e-2));
+    EXPECT_TRUE(pcd.GetPointColors().Sum({0}).AllClose(
+            pcd_load.GetPointColors().Sum({0}), 1e-5, 1e-2));
+
+    // Files whose header disagrees with their size are rejected. The number
+    // of blocks is the last int64_t of the 48-byte header.
+    std::vector<char> bytes;
+    FILE* fp = std::fopen(file_name.c_str(), "rb");
+    ASSERT_NE(fp, nullptr);
+    for (int c = std::fgetc(fp); c != EOF; c = std::fgetc(fp)) {
+        bytes.push_back(static_cast<char>(c));
+    }
+    std::fclose(fp);
+    int64_t num_blocks;
+    std::memcpy(&num_blocks, bytes.data() + 40, sizeof(num_blocks));
+    auto expect_load_fails = [&](int64_t corrupted_num_blocks, size_t size) {
+        std::vector<char> corrupted(bytes.begin(), bytes.begin() + size);
+        std::memcpy(corrupted.data() + 40, &corrupted_num_blocks,
+                    sizeof(corrupted_num_blocks));
+        FILE* fp = std::fopen(file_name.c_str(), "wb");
+        ASSERT_NE(fp, nullptr);
+        std::fwrite(corrupted.data(), 1, corrupted.size(), fp);
+        std::fclose(fp);
+        EXPECT_ANY_THROW(t::geometry::TSDFVoxelGrid::Load(file_name, device));
+    };
+    expect_load_fails(-1, bytes.size());
+    expect_load_fails(num_blocks + 1, bytes.size());
+    expect_load_fails(num_blocks - 1, bytes.size());
+    expect_load_fails(std::numeric_limits<int64_t>::max(), bytes.size());
+    expect_load_fails(num_blocks, bytes.size() - 1);
+
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+
+    EXPECT_ANY_THROW(t::geometry::TSDFVoxelGrid::Load(
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log"));
+    EXPECT_ANY_THROW(t::geometry::TSDFVoxelGrid::Load("not_a_file.tsdf"));
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, RayCast) {
+    core::Device device = GetParam();
+
+    float voxel_size = 0.008;
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          voxel_size, 0.04f, 16, 1000, device);
+    RGBDSequence sequence = LoadRGBDSequence(device);
+    IntegrateRGBDSequence(voxel_grid, sequence);
+
+    // Ray cast from the first viewpoint and compare with its depth input.
+    int width = sequence.depths_[0].GetCols();
+    int height = sequence.depths_[0].GetRows();
+    std::unordered_map<std::string, core::Tensor> maps =
+            voxel_grid.RayCast(sequence.intrinsic_, sequence.extrinsics_[0],
+                               width, height);
+    ASSERT_EQ(maps.count("vertex"), 1);
+    ASSERT_EQ(maps.count("depth"), 1);
+    ASSERT_EQ(maps.count("normal"), 1);
+    ASSERT_EQ(maps.count("color"), 1);
+    EXPECT_EQ(maps.at("vertex").GetShape(),
+              core::SizeVector({height, width, 3}));
+    EXPECT_EQ(maps.at("depth").GetShape(),
+              core::SizeVector({height, width, 1}));
+    EXPECT_EQ(maps.at("normal").GetShape(),
+              core::SizeVector({height, width, 3}));
+    EXPECT_EQ(maps.at("color").GetShape(),
+              core::SizeVector({height, width, 3}));
+    EXPECT_EQ(maps.at("depth").GetDevice(), device);
+
+    std::vector<float> depth_raycast =
+            maps.at("depth").To(core::Device("CPU:0")).ToFlatVector<float>();
+    std::vector<float> vertex_raycast =
+            maps.at("vertex").To(core::Device("CPU:0")).ToFlatVector<float>();
+    std::vector<float> normal_raycast =
+            maps.at("normal").To(core::Device("CPU:0")).ToFlatVector<float>();
+    std::vector<uint16_t> depth_input = sequence.depths_[0]
+                                                .AsTensor()
+                                                .To(core::Device("CPU:0"))
+                                                .ToFlatVector<uint16_t>();
+
+    int64_t num_valid = 0, num_consistent = 0;
+    for (int64_t i = 0; i < width * height; ++i) {
+        if (depth_raycast[i] <= 0 || depth_input[i] == 0) continue;
+        ++num_valid;
+        // Within 2 voxels of the observation.
+        if (std::abs(depth_raycast[i] - depth_input[i]) < 16.0f) {
+            ++num_consistent;
+        }
+        // Vertex map is consistent with depth map, normals are unit length.
+        EXPECT_NEAR(vertex_raycast[3 * i + 2] * 1000.0f, depth_raycast[i],
+                    1e-2);
+        float n2 = normal_raycast[3 * i + 0] * normal_raycast[3 * i + 0] +
+                   normal_raycast[3 * i + 1] * normal_raycast[3 * i + 1] +
+                   normal_raycast[3 * i + 2] * normal_raycast[3 * i + 2];
+        if (n2 > 0) {
+            EXPECT_NEAR(n2, 1.0, 1e-4);
+        }
+    }
+    EXPECT_GT(num_valid, width * height / 4);
+    EXPECT_GT(num_consistent, num_valid * 0.9);
+}
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,128 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/TriangleMeshIO.h"
+
+#include <cstdio>
+#include <fstream>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/TriangleMeshIO.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(TriangleMeshIO, ReadTriangleMeshFromOBJ) {
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_mesh.obj";
+    {
+        std::ofstream file(file_name);
+        file << "# quad and triangle with shared corners\n"
+                "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nv 2 2 2\n"
+                "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n"
+                "vn 0 0 1\n"
+                "f 1/1/1 2/2/1 3/3/1 4/4/1\n"
+                "f -5/-2/-1 -3/-3/-1 -2/-1/-1";
+    }
+
+    t::geometry::TriangleMesh mesh;
+    EXPECT_TRUE(t::io::ReadTriangleMesh(file_name, mesh));
+    // Positions 0 and 2 are used with two texture coordinates, and position
+    // 4 is not referenced.
+    EXPECT_TRUE(mesh.GetVertices().AllClose(
+            core::Tensor::Init<float>({{0, 0, 0},
+                                       {0, 0, 0},
+                                       {1, 0, 0},
+                                       {1, 1, 0},
+                                       {1, 1, 0},
+                                       {0, 1, 0},
+                                       {2, 2, 2}})));
+    EXPECT_TRUE(mesh.GetVertexAttr("texture_uvs")
+                        .AllClose(core::Tensor::Init<float>({{0, 0},
+                                                             {1, 1},
+                                                             {1, 0},
+                                                             {1, 0},
+                                                             {1, 1},
+                                                             {0, 1},
+                                                             {0, 0}})));
+    EXPECT_TRUE(mesh.GetVertexNormals().AllClose(
+            core::Tensor::Init<float>({{0, 0, 1},
+                                       {0, 0, 1},
+                                       {0, 0, 1},
+                                       {0, 0, 1},
+                                       {0, 0, 1},
+                                       {0, 0, 1},
+                                       {0, 0, 0}})));
+    EXPECT_TRUE(mesh.GetTriangles().AllClose(core::Tensor::Init<int64_t>(
+            {{0, 2, 4}, {0, 4, 5}, {1, 3, 5}})));
+
+    open3d::geometry::TriangleMesh legacy_mesh;
+    EXPECT_TRUE(t::io::ReadTriangleMeshFromOBJ(file_name, legacy_mesh, false));
+    EXPECT_EQ(legacy_mesh.vertices_.size(), 5);
+    ExpectEQ(legacy_mesh.triangles_,
+             std::vector<Eigen::Vector3i>{{0, 1, 2}, {0, 2, 3}, {0, 2, 3}});
+    ExpectEQ(legacy_mesh.triangle_uvs_[6], Eigen::Vector2d(1, 1));
+    // Position 4 has no normal.
+    EXPECT_FALSE(legacy_mesh.HasVertexNormals());
+
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+}
+
+TEST(TriangleMeshIO, ReadTriangleMeshFromOBJLegacy) {
+    std::string file_name = std::string(TEST_DATA_DIR) + "/monkey/monkey.obj";
+    open3d::geometry::TriangleMesh reference;
+    EXPECT_TRUE(open3d::io::ReadTriangleMesh(file_name, reference));
+
+    open3d::geometry::TriangleMesh legacy_mesh;
+    EXPECT_TRUE(t::io::ReadTriangleMeshFromOBJ(file_name, legacy_mesh, false));
+    ExpectEQ(legacy_mesh.vertices_, reference.vertices_, 1e-6);
+    ExpectEQ(legacy_mesh.triangles_, reference.triangles_);
+    ExpectEQ(legacy_mesh.vertex_normals_, reference.vertex_normals_, 1e-6);
+    ExpectEQ(legacy_mesh.triangle_uvs_, reference.triangle_uvs_, 1e-6);
+
+    // Corners of the tensor mesh have the same positions.
+    t::geometry::TriangleMesh mesh;
+    EXPECT_TRUE(t::io::ReadTriangleMesh(file_name, mesh));
+    core::Tensor triangles = mesh.GetTriangles();
+    ASSERT_EQ(triangles.GetLength(), int64_t(reference.triangles_.size()));
+    core::Tensor corners = mesh.GetVertices().IndexGet(
+            {triangles.Reshape({-1})});
+    std::vector<Eigen::Vector3d> reference_corners;
+    for (const auto &triangle : reference.triangles_) {
+        for (int k = 0; k < 3; k++) {
+            reference_corners.push_back(reference.vertices_[triangle(k)]);
+        }
+    }
+    EXPECT_TRUE(corners.AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    reference_corners, core::Dtype::Float32,
+                    core::Device("CPU:0"))));
+}
+
+}  // namespace tests
+}  // namespace open3d
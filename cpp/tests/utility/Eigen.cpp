@@ -26,6 +26,8 @@
 
 #include "open3d/utility/Eigen.h"
 
+#include <Eigen/Dense>
+
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -258,6 +260,85 @@ TEST(Eigen, ComputeJTJandJTr_vector) {
     ExpectEQ(ref_JTJ, JTJ);
 }
 
+TEST(Eigen, ComputeJTJandJTr6DoF) {
+    Eigen::Matrix6d ref_JTJ;
+    ref_JTJ << 2.819131, 0.023929, -0.403568, 1.276125, 0.437555, -1.123875,
+            0.023929, 2.817778, 0.086121, 1.133195, -0.124291, -0.695210,
+            -0.403568, 0.086121, 3.435509, -0.094671, 0.466959, -0.215179,
+            1.276125, 1.133195, -0.094671, 3.826990, -0.235632, -0.917586,
+            0.437555, -0.124291, 0.466959, -0.235632, 2.802768, -0.496025,
+            -1.123875, -0.695210, -0.215179, -0.917586, -0.496025, 2.951511;
+
+    Eigen::Vector6d ref_JTr;
+    ref_JTr << 0.477778, -0.262092, -0.162745, -0.545752, -0.643791, -0.883007;
+
+    auto testFunction = [&](int i, Eigen::Vector6d *J_r, double *r,
+                            double *w) {
+        std::vector<double> v(6);
+        Rand(v, -1.0, 1.0, i);
+
+        for (int k = 0; k < 6; k++) J_r[0](k) = v[k];
+
+        r[0] = (double)(i % 6) / 6;
+        w[0] = 1.0;
+    };
+
+    int iteration_num = 10;
+
+    Eigen::Matrix6d JTJ = Eigen::Matrix6d::Zero();
+    Eigen::Vector6d JTr = Eigen::Vector6d::Zero();
+    double r = 0.0;
+
+    std::tie(JTJ, JTr, r) =
+            utility::ComputeJTJandJTr6DoF<1>(testFunction, iteration_num);
+
+    ExpectEQ(ref_JTr, JTr);
+    ExpectEQ(ref_JTJ, JTJ);
+}
+
+TEST(Eigen, ComputeJTJandJTr6DoF_rows) {
+    auto fill = [](int i, int s, Eigen::Vector6d &J_r, double &r, double &w) {
+        std::vector<double> v(6);
+        Rand(v, -1.0, 1.0, i * 2 + s);
+
+        for (int k = 0; k < 6; k++) J_r(k) = v[k];
+
+        r = (double)((i + s) % 6) / 6;
+        w = 0.5 + 0.25 * s;
+    };
+
+    auto testFunction = [&](int i, Eigen::Vector6d *J_r, double *r,
+                            double *w) {
+        for (int s = 0; s < 2; s++) fill(i, s, J_r[s], r[s], w[s]);
+    };
+
+    auto refFunction =
+            [&](int i,
+                std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
+                std::vector<double> &r, std::vector<double> &w) {
+                J_r.resize(2);
+                r.resize(2);
+                w.resize(2);
+                for (int s = 0; s < 2; s++) fill(i, s, J_r[s], r[s], w[s]);
+            };
+
+    int iteration_num = 37;
+
+    Eigen::Matrix6d ref_JTJ, JTJ;
+    Eigen::Vector6d ref_JTr, JTr;
+    double ref_r, r;
+
+    std::tie(ref_JTJ, ref_JTr, ref_r) =
+            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
+                    refFunction, iteration_num);
+    std::tie(JTJ, JTr, r) =
+            utility::ComputeJTJandJTr6DoF<2>(testFunction, iteration_num);
+
+    ExpectEQ(ref_JTr, JTr);
+    ExpectEQ(ref_JTJ, JTJ);
+    EXPECT_NEAR(ref_r, r, 1e-12);
+}
+
 TEST(Eigen, ColorToUint8Round) {
     auto rgb = utility::ColorToUint8({.001, .999, .501});
     EXPECT_EQ(rgb(0), 0);
@@ -291,5 +372,43 @@ TEST(Eigen, ColorToUint8ToDouble) {
     }
 }
 
+TEST(Eigen, MeanAndCovarianceAccumulatorMerge) {
+    std::vector<Eigen::Vector3d> points(1000);
+    Rand(points, Eigen::Vector3d(-1, -2, -3), Eigen::Vector3d(3, 2, 1), 0);
+    std::vector<size_t> indices(points.size());
+    for (size_t i = 0; i < indices.size(); i++) indices[i] = i;
+    Eigen::Vector3d mean;
+    Eigen::Matrix3d covariance;
+    std::tie(mean, covariance) =
+            utility::ComputeMeanAndCovariance(points, indices);
+
+    utility::MeanAndCovarianceAccumulator first, second;
+    for (size_t i = 0; i < points.size(); i++) {
+        (i < 300 ? first : second).Add(points[i]);
+    }
+    first.Merge(second);
+    EXPECT_EQ(first.GetCount(), points.size());
+    ExpectEQ(std::get<0>(first.GetMeanAndCovariance()), mean);
+    ExpectEQ(std::get<1>(first.GetMeanAndCovariance()), covariance);
+
+    utility::MeanAndCovarianceAccumulator empty;
+    std::tie(mean, covariance) = empty.GetMeanAndCovariance();
+    EXPECT_TRUE(mean.isZero());
+    EXPECT_TRUE(covariance.isZero());
+}
+
+TEST(Eigen, ComputePrincipalAxes) {
+    Eigen::Matrix3d R_ref = utility::RotationMatrixZ(0.3) *
+                            utility::RotationMatrixX(-1.1);
+    Eigen::Matrix3d covariance =
+            R_ref * Eigen::Vector3d(4, 2, 1).asDiagonal() * R_ref.transpose();
+    Eigen::Matrix3d R = utility::ComputePrincipalAxes(covariance);
+    EXPECT_NEAR(std::abs(R.determinant()), 1, 1e-12);
+    // Each axis matches the reference up to its sign.
+    for (int i = 0; i < 3; i++) {
+        EXPECT_NEAR(std::abs(R.col(i).dot(R_ref.col(i))), 1, 1e-12);
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
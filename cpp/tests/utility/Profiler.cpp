@@ -0,0 +1,143 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Profiler.h"
+
+#include <thread>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+// ScopeProfiler is used directly so that the tests do not depend on
+// BUILD_PROFILER, which only controls the OPEN3D_PROFILE_SCOPE macro.
+
+TEST(Profiler, RecordNestedScopes) {
+    utility::Profiler &profiler = utility::Profiler::GetInstance();
+    profiler.SetEnabled(true);
+    profiler.Clear();
+    {
+        utility::ScopeProfiler outer("outer");
+        for (int i = 0; i < 3; ++i) {
+            utility::ScopeProfiler inner("inner");
+        }
+    }
+    profiler.SetEnabled(false);
+    {
+        utility::ScopeProfiler ignored("ignored");
+    }
+
+    std::vector<utility::ProfileEvent> events = profiler.GetEvents();
+    ASSERT_EQ(events.size(), 4u);
+    EXPECT_STREQ(events[0].name_, "outer");
+    EXPECT_EQ(events[0].depth_, 0);
+    for (int i = 1; i < 4; ++i) {
+        EXPECT_STREQ(events[i].name_, "inner");
+        EXPECT_EQ(events[i].depth_, 1);
+        EXPECT_GE(events[i].start_ns_, events[0].start_ns_);
+        EXPECT_LE(events[i].end_ns_, events[0].end_ns_);
+    }
+
+    std::vector<utility::ProfileSummary> summary = profiler.GetSummary();
+    ASSERT_EQ(summary.size(), 2u);
+    EXPECT_EQ(summary[0].name_, "outer");
+    EXPECT_EQ(summary[0].count_, 1);
+    EXPECT_EQ(summary[1].name_, "inner");
+    EXPECT_EQ(summary[1].count_, 3);
+    EXPECT_NEAR(summary[0].self_ms_,
+                summary[0].total_ms_ - summary[1].total_ms_, 1e-6);
+
+    profiler.Clear();
+    EXPECT_EQ(profiler.GetEvents().size(), 0u);
+}
+
+TEST(Profiler, MultipleThreads) {
+    utility::Profiler &profiler = utility::Profiler::GetInstance();
+    profiler.SetEnabled(true);
+    profiler.Clear();
+
+    const int num_threads = 4;
+    const int num_events = 10000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([]() {
+            for (int i = 0; i < num_events; ++i) {
+                utility::ScopeProfiler scope("work");
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    profiler.SetEnabled(false);
+
+    std::vector<utility::ProfileEvent> events = profiler.GetEvents();
+    EXPECT_EQ(events.size(), size_t(num_threads * num_events));
+    std::vector<utility::ProfileSummary> summary = profiler.GetSummary();
+    ASSERT_EQ(summary.size(), 1u);
+    EXPECT_EQ(summary[0].count_, num_threads * num_events);
+    profiler.Clear();
+}
+
+TEST(Profiler, RecordAfterClear) {
+    utility::Profiler &profiler = utility::Profiler::GetInstance();
+    profiler.SetEnabled(true);
+    profiler.Clear();
+
+    // Clear releases the chunks of cleared events, recording has to continue
+    // in the remaining ones across several rounds.
+    const int num_rounds = 3;
+    const int num_events = 10000;
+    for (int round = 0; round < num_rounds; ++round) {
+        for (int i = 0; i < num_events + round; ++i) {
+            utility::ScopeProfiler scope("work");
+        }
+        std::vector<utility::ProfileEvent> events = profiler.GetEvents();
+        EXPECT_EQ(events.size(), size_t(num_events + round));
+        profiler.Clear();
+        EXPECT_EQ(profiler.GetEvents().size(), 0u);
+    }
+    profiler.SetEnabled(false);
+}
+
+TEST(Profiler, ChromeTraceJson) {
+    utility::Profiler &profiler = utility::Profiler::GetInstance();
+    profiler.SetEnabled(true);
+    profiler.Clear();
+    { utility::ScopeProfiler scope("scope \"quoted\""); }
+    profiler.SetEnabled(false);
+
+    std::string json = profiler.ToChromeTraceJson();
+    EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"scope \\\"quoted\\\"\""),
+              std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+    profiler.Clear();
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -105,6 +105,50 @@ def test_RSBagReader():
     # os.remove("L515_test_s.bag")  # Permission error in Windows
 
 
+# @pytest.mark.skipif(not hasattr(o3d.t.io, 'RSBagReader'))
+@pytest.mark.skip(reason="Hangs in Github Actions, but succeeds locally")
+def test_RSBagReader_process_frames_parallel():
+
+    shutil.unpack_archive(test_data_dir +
+                          "/RGBD/other_formats/L515_test_s.bag.tar.xz")
+
+    # Serial pass over all frames.
+    bag_reader = o3d.t.io.RSBagReader()
+    bag_reader.open("L515_test_s.bag")
+    stream_length_usec = bag_reader.metadata.stream_length_usec
+    serial_frames = []
+    im_rgbd = bag_reader.next_frame()
+    while not bag_reader.is_eof():
+        serial_frames.append(
+            (bag_reader.get_timestamp(), np.asarray(im_rgbd.depth).copy()))
+        im_rgbd = bag_reader.next_frame()
+    bag_reader.close()
+    assert len(serial_frames) == 6
+
+    # Each reader seeks to the start of its own range, and every frame must
+    # be processed exactly once.
+    for num_readers in (1, 2, 3):
+        parallel_frames = []
+
+        def process(range_index, timestamp, frame):
+            parallel_frames.append(
+                (range_index, timestamp, np.asarray(frame.depth)))
+
+        num_frames = o3d.t.io.RSBagReader.process_frames_parallel(
+            "L515_test_s.bag", process, num_readers)
+        assert num_frames == len(serial_frames)
+        assert len(parallel_frames) == len(serial_frames)
+
+        parallel_frames.sort(key=lambda f: f[1])
+        ranges = o3d.t.io.RSBagReader.split_time_ranges(
+            0, stream_length_usec, num_readers)
+        for parallel, serial in zip(parallel_frames, serial_frames):
+            range_index, timestamp, depth = parallel
+            assert timestamp == serial[0]
+            assert ranges[range_index][0] <= timestamp < ranges[range_index][1]
+            np.testing.assert_array_equal(depth, serial[1])
+
+
 # Test recording from a RealSense camera, if one is connected
 @pytest.mark.skipif(not hasattr(o3d.t.io, 'RealSenseSensor'),
                     reason="Not built with librealsense")